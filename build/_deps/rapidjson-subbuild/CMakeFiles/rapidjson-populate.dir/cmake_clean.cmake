@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rapidjson-populate"
+  "CMakeFiles/rapidjson-populate-complete"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-build"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-configure"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-download"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-install"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-mkdir"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-patch"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-test"
+  "rapidjson-populate-prefix/src/rapidjson-populate-stamp/rapidjson-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/rapidjson-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -57,6 +57,23 @@ if(BUILD_CPP_TEST)
   endif()
 endif()
 
+# Google Benchmark
+if(BUILD_BENCHMARK)
+  find_package(benchmark 1.5)
+  if(NOT benchmark_FOUND)
+    message(STATUS "Did not find Google Benchmark in the system root. Fetching Google Benchmark now...")
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    FetchContent_Declare(
+      benchmark
+      GIT_REPOSITORY https://github.com/google/benchmark.git
+      GIT_TAG        v1.7.1
+    )
+    FetchContent_MakeAvailable(benchmark)
+    set_property(DIRECTORY ${benchmark_SOURCE_DIR} PROPERTY EXCLUDE_FROM_ALL YES)
+  endif()
+endif()
+
 # fmtlib
 if(BUILD_CPP_TEST)
   find_package(fmt 10.1)
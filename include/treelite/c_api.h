@@ -39,6 +39,12 @@ typedef void* TreeliteModelHandle;
 typedef void* TreeliteModelBuilderHandle;
 /*! \brief Handle to a configuration of GTIL predictor */
 typedef void* TreeliteGTILConfigHandle;
+/*! \brief Handle to a reusable GTIL prediction session */
+typedef void* TreeliteGTILPredictSessionHandle;
+/*! \brief Handle to prediction statistics collected by GTIL */
+typedef void* TreeliteGTILPredictionStatsHandle;
+/*! \brief Handle to a model reader providing lazy per-tree loading */
+typedef void* TreeliteModelReaderHandle;
 /*! \} */
 
 /*!
@@ -87,6 +93,27 @@ TREELITE_DLL int TreeliteLoadXGBoostModel(
  */
 TREELITE_DLL int TreeliteLoadXGBoostModelFromString(
     char const* json_str, size_t length, char const* config_json, TreeliteModelHandle* out);
+/*!
+ * \brief Load a model file generated by XGBoost (dmlc/xgboost), stored in the UBJSON format.
+ * \param filename Name of model file
+ * \param config_json Null-terminated JSON string consisting key-value pairs; used for configuring
+ *                    the model parser
+ * \param out Loaded model
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteLoadXGBoostModelUBJSON(
+    char const* filename, char const* config_json, TreeliteModelHandle* out);
+/*!
+ * \brief Load an XGBoost model from a UBJSON byte sequence
+ * \param ubjson_str Byte sequence containing the XGBoost model, in the UBJSON format
+ * \param length Length of the byte sequence
+ * \param config_json Null-terminated JSON string consisting key-value pairs; used for configuring
+ *                    the model parser
+ * \param out Loaded model
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteLoadXGBoostModelFromUBJSONString(
+    char const* ubjson_str, size_t length, char const* config_json, TreeliteModelHandle* out);
 /*!
  * \brief Load a model file generated by LightGBM (Microsoft/LightGBM). The
  *        model file must contain a decision tree ensemble.
@@ -399,6 +426,35 @@ TREELITE_DLL int TreeliteModelBuilderStartTree(TreeliteModelBuilderHandle model_
  * \return 0 for success, -1 for failure
  */
 TREELITE_DLL int TreeliteModelBuilderEndTree(TreeliteModelBuilderHandle model_builder);
+/*!
+ * \brief Ingest a whole tree at once from per-node arrays, as a fast alternative to the
+ *        per-node protocol (TreeliteModelBuilderStartTree / TreeliteModelBuilderStartNode /
+ *        ... / TreeliteModelBuilderEndNode / TreeliteModelBuilderEndTree). Nodes are
+ *        identified by their position in the arrays: element i of each array describes
+ *        node i, and node 0 is the root. A node is a leaf if its left child is -1.
+ * \param model_builder Model builder object
+ * \param num_nodes Number of nodes in the tree
+ * \param left_child Index of each node's left child; -1 for leaf nodes. Array of num_nodes
+ *                   elements.
+ * \param right_child Index of each node's right child; -1 for leaf nodes. Array of num_nodes
+ *                    elements.
+ * \param split_index Feature ID of each test node; ignored for leaf nodes. Array of num_nodes
+ *                    elements.
+ * \param threshold Threshold of each test node; ignored for leaf nodes. Array of num_nodes
+ *                  elements.
+ * \param default_left Whether each test node maps missing values to its left child; ignored
+ *                     for leaf nodes. Array of num_nodes elements.
+ * \param cmp Comparison operator, shared by all test nodes in the tree
+ * \param leaf_value Leaf outputs; either num_nodes values (scalar leaf output) or
+ *                   num_nodes * [leaf vector length] values in row-major order (vector leaf
+ *                   output). Entries for test nodes are ignored.
+ * \param leaf_value_len Number of elements in the leaf_value array
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelBuilderBulkTree(TreeliteModelBuilderHandle model_builder,
+    int32_t num_nodes, int32_t const* left_child, int32_t const* right_child,
+    int32_t const* split_index, double const* threshold, int const* default_left, char const* cmp,
+    double const* leaf_value, size_t leaf_value_len);
 /*!
  * \brief Start a new node
  * \param model_builder Model builder object
@@ -547,6 +603,76 @@ TREELITE_DLL int TreeliteQueryNumTree(TreeliteModelHandle model, size_t* out);
  * \return 0 for success, -1 for failure
  */
 TREELITE_DLL int TreeliteQueryNumFeature(TreeliteModelHandle model, int* out);
+/*!
+ * \brief Query the resident memory footprint of the model, in bytes, broken down by
+ *        component. Each figure counts the elements actually stored in the corresponding
+ *        arrays, summed over all trees; allocator slack is not counted. Useful for capacity
+ *        planning, e.g. to see how much of a deployment's memory goes to node statistics
+ *        (which can be dropped at load time), or to alert when a retrained model's
+ *        footprint jumps.
+ * \param model Model to query
+ * \param out_node_structure Node structure arrays: node types, child indices, split
+ *                           indices, flags, operators
+ * \param out_thresholds Split thresholds
+ * \param out_leaf_outputs Scalar leaf values and leaf vectors, with their offset arrays
+ * \param out_category_lists Category lists of categorical test nodes, with their offset
+ *                           arrays
+ * \param out_node_stats Node statistics: data counts, sums of Hessians, gains, and their
+ *                       presence flags
+ * \param out_metadata Model-level metadata: task arrays, base scores, and strings
+ * \param out_total Sum of all components
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteQueryMemoryFootprint(TreeliteModelHandle model,
+    uint64_t* out_node_structure, uint64_t* out_thresholds, uint64_t* out_leaf_outputs,
+    uint64_t* out_category_lists, uint64_t* out_node_stats, uint64_t* out_metadata,
+    uint64_t* out_total);
+/*!
+ * \brief Get read-only pointers into the node arrays of one tree, for bulk zero-copy
+ *        introspection. Tooling that only needs thresholds, child indices, or leaf values
+ *        can read the arrays directly instead of round-tripping the model through
+ *        \ref TreeliteDumpAsJSON. All node-indexed arrays have (*out_num_nodes) elements;
+ *        a node's leaf vector, if any, occupies elements
+ *        [out_leaf_vector_begin[nid], out_leaf_vector_end[nid]) of (*out_leaf_vector).
+ *        The pointers borrow the model's storage: they are valid while the model is alive
+ *        and unmodified.
+ * \param model Model to inspect
+ * \param tree_id ID of the tree to inspect
+ * \param out_num_nodes Number of nodes in the tree
+ * \param out_node_type Node type of each node, as the integer value of
+ *                      \ref treelite::TreeNodeType
+ * \param out_cleft ID of each node's left child; -1 for a leaf
+ * \param out_cright ID of each node's right child; -1 for a leaf
+ * \param out_split_index Feature index of each test node
+ * \param out_threshold Split threshold of each numerical test node. Typed as the model's
+ *                      threshold type (float32 or float64; query \ref TreeliteGetInputType)
+ * \param out_leaf_value Scalar output of each leaf node, typed as the model's leaf output
+ *                       type
+ * \param out_leaf_vector Concatenated leaf vectors, typed as the model's leaf output type
+ * \param out_leaf_vector_begin Start offset of each node's leaf vector
+ * \param out_leaf_vector_end Past-the-end offset of each node's leaf vector
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteGetTreeArrays(TreeliteModelHandle model, uint64_t tree_id,
+    int32_t* out_num_nodes, int8_t const** out_node_type, int32_t const** out_cleft,
+    int32_t const** out_cright, int32_t const** out_split_index, void const** out_threshold,
+    void const** out_leaf_value, void const** out_leaf_vector,
+    uint64_t const** out_leaf_vector_begin, uint64_t const** out_leaf_vector_end);
+/*!
+ * \brief Get read-only pointers into the node-statistics arrays of one tree, complementing
+ *        \ref TreeliteGetTreeArrays. Each pointer is set to NULL when the loader recorded
+ *        no values for the field; where a value is present for some nodes only, the slots
+ *        of the other nodes are unspecified. The pointers borrow the model's storage: they
+ *        are valid while the model is alive and unmodified.
+ * \param model Model to inspect
+ * \param tree_id ID of the tree to inspect
+ * \param out_data_count Number of training data points that passed through each node
+ * \param out_sum_hess Sum of Hessians of the training data points at each node
+ * \param out_gain Loss reduction (gain) of each test node's split
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteGetTreeStatsArrays(TreeliteModelHandle model, uint64_t tree_id,
+    uint64_t const** out_data_count, double const** out_sum_hess, double const** out_gain);
 /*!
  * \brief Concatenate multiple model objects into a single model object by copying
  *        all member trees into the destination model object
@@ -556,6 +682,18 @@ TREELITE_DLL int TreeliteQueryNumFeature(TreeliteModelHandle model, int* out);
  */
 TREELITE_DLL int TreeliteConcatenateModelObjects(
     TreeliteModelHandle const* objs, size_t len, TreeliteModelHandle* out);
+/*!
+ * \brief Concatenate multiple model objects into a single model object by moving all member
+ *        trees out of the source model objects. Unlike \ref TreeliteConcatenateModelObjects,
+ *        no tree data is copied. The source model objects are consumed: they are freed and
+ *        their handles set to NULL, even when an error occurs.
+ * \param objs Pointer to the beginning of the list of model objects
+ * \param len Number of model objects
+ * \param out Used to save the concatenated model
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteConcatenateModelObjectsAndFree(
+    TreeliteModelHandle* objs, size_t len, TreeliteModelHandle* out);
 /*!
  * \brief Delete model from memory
  * \param handle Model to remove
@@ -584,6 +722,150 @@ TREELITE_DLL int TreeliteSerializeModelToFile(TreeliteModelHandle handle, char c
  * \return 0 for success, -1 for failure
  */
 TREELITE_DLL int TreeliteDeserializeModelFromFile(char const* filename, TreeliteModelHandle* out);
+/*!
+ * \brief Serialize (persist) a model object to disk, compressing the tree section with the
+ *        given codec. Compression is applied per array, so parallel and lazy loaders keep
+ *        working; decompression at load is parallelized per tree. Compressed checkpoints
+ *        require Treelite 4.4 or later to read.
+ * \param handle Handle to the model object
+ * \param filename Name of the file to which to serialize the model
+ * \param codec Compression codec; one of "uncompressed", "lz4"
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteSerializeModelToFileWithCodec(
+    TreeliteModelHandle handle, char const* filename, char const* codec);
+/*!
+ * \brief Serialize (persist) a model object to disk, reserving header capacity for a model
+ *        of up to reserve_num_tree trees, so that \ref TreeliteAppendTreesToCheckpoint can
+ *        later extend the checkpoint in place. The reservation costs 16 bytes of padding
+ *        per reserved tree and is skipped by readers.
+ * \param handle Handle to the model object
+ * \param filename Name of the file to which to serialize the model
+ * \param codec Compression codec; one of "uncompressed", "lz4"
+ * \param reserve_num_tree Number of trees to reserve header capacity for
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteSerializeModelToFileWithTreeCapacity(TreeliteModelHandle handle,
+    char const* filename, char const* codec, uint64_t reserve_num_tree);
+/*!
+ * \brief Append a model's newest trees to an existing checkpoint file, making the
+ *        checkpoint cost proportional to the delta. The file must have been written by the
+ *        running Treelite version and hold a strict prefix of the model's trees. Only the
+ *        new trees' records are encoded and appended; the header, tree count and offset
+ *        table are rewritten in place, consuming space reserved via
+ *        \ref TreeliteSerializeModelToFileWithTreeCapacity. Fails if the reserved capacity
+ *        is exhausted.
+ * \param handle Handle to the model object
+ * \param filename Path to the checkpoint file to extend
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteAppendTreesToCheckpoint(TreeliteModelHandle handle, char const* filename);
+/*!
+ * \brief Deserialize (load) a model object from disk, skipping the node-statistics arrays
+ *        (data counts, sums of Hessians, gains). Inference does not read the statistics,
+ *        and skipping them cuts the resident model size accordingly; the loaded model
+ *        reports no statistics for any node.
+ * \param filename Name of the file from which to deserialize the model. The file should be created
+ *                 by a call to \ref TreeliteSerializeModelToFile.
+ * \param out Handle to the model object
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteDeserializeModelFromFileWithoutNodeStats(
+    char const* filename, TreeliteModelHandle* out);
+/*!
+ * \brief Deserialize (load) a model object by memory-mapping the file, instead of reading it
+ *        into heap-allocated buffers. Loading is near-instant regardless of model size, peak
+ *        memory stays at one copy of the model, and the pages are shared through the OS page
+ *        cache with other processes mapping the same file. The mapping is private
+ *        (copy-on-write) and is held until the model is freed; the file must not be modified
+ *        while the model is in use.
+ * \param filename Name of the file from which to deserialize the model. The file should be created
+ *                 by a call to \ref TreeliteSerializeModelToFile.
+ * \param out Handle to the model object
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteDeserializeModelFromMappedFile(
+    char const* filename, TreeliteModelHandle* out);
+/*!
+ * \brief Publish a model object into a named shared memory region. Other processes on the
+ *        host can then call \ref TreeliteAttachModelFromSharedMemory to construct model
+ *        objects over the region, so only one physical copy of the model exists per host and
+ *        worker startup becomes an attach instead of a parse. On POSIX the region persists
+ *        until \ref TreeliteRemoveSharedMemory is called; on Windows it lives for as long as
+ *        some process holds it open (for example, the publishing model).
+ * \param handle Handle to the model object
+ * \param name Name of the shared memory region
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteSerializeModelToSharedMemory(
+    TreeliteModelHandle handle, char const* name);
+/*!
+ * \brief Construct a model object over a shared memory region previously published with
+ *        \ref TreeliteSerializeModelToSharedMemory. The node arrays point directly into the
+ *        region instead of being copied to the heap, so attaching is near-instant and all
+ *        attached processes share the publisher's single physical copy. The region is mapped
+ *        read-only and is held until the model is freed.
+ * \param name Name of the shared memory region
+ * \param out Handle to the model object
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteAttachModelFromSharedMemory(char const* name, TreeliteModelHandle* out);
+/*!
+ * \brief Remove a named shared memory region, so that new attaches fail. Processes already
+ *        attached keep their mappings until they free their models. No-op on Windows, where
+ *        the region is reclaimed once the last holder releases it.
+ * \param name Name of the shared memory region
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteRemoveSharedMemory(char const* name);
+/*!
+ * \brief Open a model file for lazy per-tree loading. The file is memory-mapped and only its
+ *        header is parsed; trees are materialized on demand via
+ *        \ref TreeliteModelReaderLoadModel and \ref TreeliteModelReaderExtendModel. The file
+ *        must have been created by Treelite 4.4 or later, as the reader requires the per-tree
+ *        offset table emitted by \ref TreeliteSerializeModelToFile.
+ * \param filename Name of the file to open
+ * \param out Handle to the model reader
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelReaderOpen(char const* filename, TreeliteModelReaderHandle* out);
+/*!
+ * \brief Query the number of trees stored in the file opened by a model reader
+ * \param handle Handle to the model reader
+ * \param out Number of trees in the file
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelReaderGetNumTree(TreeliteModelReaderHandle handle, uint64_t* out);
+/*!
+ * \brief Load a model containing only the first tree_limit trees of the file. Time and memory
+ *        spent are proportional to tree_limit, not to the size of the file. The model remains
+ *        valid after the reader is closed.
+ * \param handle Handle to the model reader
+ * \param tree_limit Number of trees to load; must not exceed the number of trees in the file
+ * \param out Handle to the model object
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelReaderLoadModel(
+    TreeliteModelReaderHandle handle, uint64_t tree_limit, TreeliteModelHandle* out);
+/*!
+ * \brief Extend a partially loaded model in place, so that it contains the first tree_limit
+ *        trees of the file. The model must have been produced by
+ *        \ref TreeliteModelReaderLoadModel on the same reader. No-op if the model already
+ *        contains tree_limit or more trees.
+ * \param handle Handle to the model reader
+ * \param model Handle to the model object to extend
+ * \param tree_limit Number of trees the model should contain after the call
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelReaderExtendModel(
+    TreeliteModelReaderHandle handle, TreeliteModelHandle model, uint64_t tree_limit);
+/*!
+ * \brief Close a model reader. Models loaded from it remain valid; they keep the underlying
+ *        file mapping alive.
+ * \param handle Handle to the model reader
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteModelReaderClose(TreeliteModelReaderHandle handle);
 /*!
  * \brief Serialize (persist) a model object to a byte sequence
  * \param handle Handle to the model object
@@ -647,19 +929,231 @@ TREELITE_DLL int TreeliteGTILDeleteConfig(TreeliteGTILConfigHandle handle);
 TREELITE_DLL int TreeliteGTILGetOutputShape(TreeliteModelHandle model, uint64_t num_row,
     TreeliteGTILConfigHandle config, uint64_t const** out, uint64_t* out_ndim);
 
+/*!
+ * \brief Warm up a model before serving traffic: pre-fault the memory backing it and run
+ *        one block of synthetic rows through the configured prediction path, so the first
+ *        real predictions run at steady-state speed instead of paying page-fault and
+ *        cold-cache costs. Call after loading, before the load balancer sends traffic.
+ * \param model Treelite Model object
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILWarmup(TreeliteModelHandle model, TreeliteGTILConfigHandle config);
+
 /*!
  * \brief Predict with a 2D dense array
  * \param model Treelite Model object
  * \param input The 2D data array, laid out in row-major layout
  * \param num_row Number of rows in the data matrix.
  * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
- *               the amount of buffer you should allocate for this parameter.
+ *               the amount of buffer you should allocate for this parameter. The output is
+ *               typed per the model's leaf output type: passing "float32" input against a
+ *               float64 model is supported (mixed precision), and the output is then float64.
  * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
  * \return 0 for success; -1 for failure
  */
 TREELITE_DLL int TreeliteGTILPredict(TreeliteModelHandle model, void const* input,
     char const* input_type, uint64_t num_row, void* output, TreeliteGTILConfigHandle config);
 
+/*!
+ * \brief Predict with a 2D dense array and an Arrow-style validity bitmap. Cells whose
+ *        bit is cleared are treated as missing values regardless of their payload, so
+ *        feature pipelines that track missingness out of band need not write NaN into the
+ *        value buffer.
+ * \param model Treelite Model object
+ * \param input The 2D data array, laid out in row-major layout
+ * \param input_type Data type of data matrix. Must be "float32" or "float64"
+ * \param validity Validity bitmap with one bit per cell, in row-major order,
+ *                 least-significant bit first: cell k maps to bit (k % 8) of byte (k / 8),
+ *                 and a set bit marks the cell valid. Pass NULL to assert that every cell
+ *                 is valid; prediction then runs traversal kernels with the per-node
+ *                 missing-value check compiled out, and feeding NaN under that guarantee
+ *                 yields unspecified predictions.
+ * \param num_row Number of rows in the data matrix.
+ * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
+ *               the amount of buffer you should allocate for this parameter. As with
+ *               \ref TreeliteGTILPredict, "float32" input against a float64 model yields
+ *               float64 output.
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictWithValidity(TreeliteModelHandle model, void const* input,
+    char const* input_type, uint8_t const* validity, uint64_t num_row, void* output,
+    TreeliteGTILConfigHandle config);
+
+/*!
+ * \brief Predict with a strided 2D dense array, so rows embedded in larger fixed-stride
+ *        records (e.g. wire-format buffers with features at a known offset) can be scored
+ *        in place, without a compacting copy
+ * \param model Treelite Model object
+ * \param input Pointer to the first feature of the first row
+ * \param input_type Data type of data matrix. Must be "float32" or "float64"
+ * \param num_row Number of rows in the data matrix.
+ * \param row_stride Distance between the first features of consecutive rows, in elements
+ *                   of input_type. Pass num_feature for a contiguous row-major matrix.
+ * \param elem_stride Distance between consecutive features within a row, in elements of
+ *                    input_type. Pass 1 for a contiguous row-major matrix.
+ * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
+ *               the amount of buffer you should allocate for this parameter. As with
+ *               \ref TreeliteGTILPredict, "float32" input against a float64 model yields
+ *               float64 output.
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictStrided(TreeliteModelHandle model, void const* input,
+    char const* input_type, uint64_t num_row, uint64_t row_stride, uint64_t elem_stride,
+    void* output, TreeliteGTILConfigHandle config);
+
+/*!
+ * \brief Predict with a sparse matrix in CSR (compressed sparse row) format. Features that
+ *        are not stored in a row are treated as missing values.
+ * \param model Treelite Model object
+ * \param data Stored entries, of length row_ptr[num_row]
+ * \param input_type Data type of data. Must be "float32" or "float64"
+ * \param col_ind Feature index of each stored entry
+ * \param row_ptr Offsets into data / col_ind delimiting each row; has (num_row + 1) elements
+ * \param num_row Number of rows in the data matrix.
+ * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
+ *               the amount of buffer you should allocate for this parameter.
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictSparse(TreeliteModelHandle model, void const* data,
+    char const* input_type, uint64_t const* col_ind, uint64_t const* row_ptr, uint64_t num_row,
+    void* output, TreeliteGTILConfigHandle config);
+
+/*!
+ * \brief Predict one leaf ID per tree, with integer-typed output. Unlike predicting with
+ *        predict_type "leaf_id", the IDs are written as int32_t directly, avoiding the
+ *        int-to-float conversion and halving the output footprint for double-precision
+ *        models.
+ * \param model Treelite Model object
+ * \param input The 2D data array, laid out in row-major layout
+ * \param input_type Data type of data matrix. Must be "float32" or "float64"
+ * \param num_row Number of rows in the data matrix.
+ * \param output Pointer to buffer to store the output; must hold (num_row * num_tree)
+ *               elements
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictLeaf(TreeliteModelHandle model, void const* input,
+    char const* input_type, uint64_t num_row, int32_t* output, TreeliteGTILConfigHandle config);
+
+/*!
+ * \brief Create a reusable prediction session, resolving all per-call setup once for a given
+ *        model + configuration pair. Use it when issuing many (small) batches against the same
+ *        model, where the fixed per-call overhead of \ref TreeliteGTILPredict matters.
+ *        The model and configuration must outlive the session.
+ * \param model Treelite Model object
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \param out Created session
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILCreatePredictSession(TreeliteModelHandle model,
+    TreeliteGTILConfigHandle config, TreeliteGTILPredictSessionHandle* out);
+
+/*!
+ * \brief Predict with a batch of data, using a prediction session.
+ * \param session Prediction session, created by \ref TreeliteGTILCreatePredictSession
+ * \param input The 2D data array, laid out in row-major layout
+ * \param input_type Data type of data matrix. Must be "float32" or "float64"
+ * \param num_row Number of rows in the data matrix.
+ * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
+ *               the amount of buffer you should allocate for this parameter.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictWithSession(TreeliteGTILPredictSessionHandle session,
+    void const* input, char const* input_type, uint64_t num_row, void* output);
+
+/*!
+ * \brief Delete a GTIL prediction session from memory
+ * \param session Handle to the session to be deleted
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILDeletePredictSession(TreeliteGTILPredictSessionHandle session);
+
+/*!
+ * \brief Predict with a 2D dense array, while collecting traversal statistics: total depth
+ *        traversed, missing-value branch frequency, categorical node visits, and per-tree
+ *        node visits. Statistics are collected for the "default" and "raw" prediction types;
+ *        the other types predict normally and report zero counters.
+ * \param model Treelite Model object
+ * \param input The 2D data array, laid out in row-major layout
+ * \param input_type Data type of data matrix. Must be "float32" or "float64"
+ * \param num_row Number of rows in the data matrix.
+ * \param output Pointer to buffer to store the output. Call \ref TreeliteGTILGetOutputShape to get
+ *               the amount of buffer you should allocate for this parameter.
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \param out_stats Collected statistics; free with \ref TreeliteGTILDeletePredictionStats
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictWithStats(TreeliteModelHandle model, void const* input,
+    char const* input_type, uint64_t num_row, void* output, TreeliteGTILConfigHandle config,
+    TreeliteGTILPredictionStatsHandle* out_stats);
+
+/*!
+ * \brief Query the aggregate counters of a prediction statistics object.
+ * \param stats Statistics object, created by \ref TreeliteGTILPredictWithStats
+ * \param out_num_row Number of rows predicted
+ * \param out_num_tree_traversal Number of (row, tree) traversals
+ * \param out_num_node_visit Total number of test nodes visited, i.e. total depth traversed
+ * \param out_num_missing_branch Node visits that took the default (missing-value) child
+ * \param out_num_categorical_visit Node visits to categorical test nodes
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictionStatsGetCounters(TreeliteGTILPredictionStatsHandle stats,
+    uint64_t* out_num_row, uint64_t* out_num_tree_traversal, uint64_t* out_num_node_visit,
+    uint64_t* out_num_missing_branch, uint64_t* out_num_categorical_visit);
+
+/*!
+ * \brief Query the number of node visits attributed to each tree.
+ * \param stats Statistics object, created by \ref TreeliteGTILPredictWithStats
+ * \param out Pointer to the per-tree visit counts; valid until the statistics object is deleted
+ * \param out_len Number of elements, equal to the number of trees
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictionStatsGetPerTreeNodeVisits(
+    TreeliteGTILPredictionStatsHandle stats, uint64_t const** out, uint64_t* out_len);
+
+/*!
+ * \brief Delete a prediction statistics object from memory
+ * \param stats Handle to the statistics object to be deleted
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILDeletePredictionStats(TreeliteGTILPredictionStatsHandle stats);
+
+/*!
+ * \brief Callback producing up to max_rows input rows into buffer (row-major, num_feature
+ *        columns per row, typed per the input_type given to \ref TreeliteGTILPredictStream).
+ *        Returns the number of rows produced; 0 signals the end of the stream.
+ */
+typedef uint64_t (*TreeliteGTILChunkReadFunc)(void* user_context, void* buffer, uint64_t max_rows);
+
+/*! \brief Callback receiving the predictions for one chunk of num_row rows */
+typedef void (*TreeliteGTILChunkWriteFunc)(
+    void* user_context, void const* output, uint64_t num_row);
+
+/*!
+ * \brief Predict over a stream of input chunks, for inputs too large to hold in memory.
+ *        Chunks are double-buffered: while one chunk is being traversed, the next chunk is
+ *        read and the previous predictions are written back on a background thread, so input
+ *        materialization, traversal, and output write-back overlap. The reader is called
+ *        until it returns 0; the writer receives chunks in order. Both callbacks run off the
+ *        calling thread and must not call back into the same model concurrently.
+ * \param model Treelite Model object
+ * \param input_type Data type of the input rows. Must be "float32" or "float64"
+ * \param chunk_rows Number of rows per chunk; the output handed to the writer is shaped as
+ *                   \ref TreeliteGTILGetOutputShape for the chunk's row count
+ * \param read_func Callback producing input chunks
+ * \param write_func Callback receiving prediction chunks
+ * \param user_context Opaque pointer passed through to both callbacks
+ * \param config Configuration of GTIL predictor. Set this by calling \ref TreeliteGTILParseConfig.
+ * \return 0 for success; -1 for failure
+ */
+TREELITE_DLL int TreeliteGTILPredictStream(TreeliteModelHandle model, char const* input_type,
+    uint64_t chunk_rows, TreeliteGTILChunkReadFunc read_func,
+    TreeliteGTILChunkWriteFunc write_func, void* user_context, TreeliteGTILConfigHandle config);
+
 /*! \} */
 
 /*!
@@ -686,6 +1180,24 @@ TREELITE_DLL int TreeliteRegisterLogCallback(void (*callback)(char const*));
  */
 TREELITE_DLL int TreeliteRegisterWarningCallback(void (*callback)(char const*));
 
+/*!
+ * \brief Turn phase-level tracing on or off globally. While enabled, prediction, model
+ *        loading, and serialization accumulate a per-call breakdown of where wall time
+ *        went (traversal, averaging, post-processing, parsing, ...), queryable with
+ *        \ref TreeliteGetTraceReport. Off by default; the overhead when off is negligible.
+ * \param enable Whether to enable tracing
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteEnableTracing(int enable);
+
+/*!
+ * \brief Fetch the phase breakdown of the last traced call made from the calling thread,
+ *        as a JSON array of {"phase", "num_invocation", "total_sec"} objects.
+ * \param out_report JSON string; valid until the next Treelite call from this thread
+ * \return 0 for success, -1 for failure
+ */
+TREELITE_DLL int TreeliteGetTraceReport(char const** out_report);
+
 #ifdef __cplusplus
 extern "C" {
 extern char const* TREELITE_VERSION;
@@ -1,7 +1,9 @@
 /*!
  * Copyright (c) 2023 by Contributors
  * \file contiguous_array.h
- * \brief A simple array container, with owned or non-owned (externally allocated) buffer
+ * \brief A simple array container, with owned or non-owned (externally allocated) buffer.
+ *        Owned buffers are cache-line aligned (with hugepage backing for large arrays);
+ *        see detail/aligned_alloc.h for the allocation policy.
  * \author Hyunsu Cho
  */
 
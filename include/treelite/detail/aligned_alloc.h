@@ -0,0 +1,99 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file aligned_alloc.h
+ * \brief Cache-line-aligned, hugepage-capable allocation for the tree array buffers
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_ALIGNED_ALLOC_H_
+#define TREELITE_DETAIL_ALIGNED_ALLOC_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace treelite::detail {
+
+/*!
+ * \brief Alignment of every owned buffer: one cache line, so vectorized kernels can use
+ *        aligned loads on the node arrays and no buffer straddles a line at its head.
+ */
+constexpr std::size_t kAllocAlignment = 64;
+/*!
+ * \brief Allocations of at least one huge page (2 MiB on x86-64) are aligned to the huge
+ *        page size and, on Linux, advised to transparent hugepage backing. Multi-GB models
+ *        spend a measurable fraction of traversal time in dTLB misses with 4 KiB pages;
+ *        2 MiB pages cut the number of translations by three orders of magnitude.
+ */
+constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+/*! \brief Alignment used for an allocation of the given size */
+inline std::size_t AllocAlignmentFor(std::size_t nbytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (nbytes >= kHugePageSize) {
+    return kHugePageSize;
+  }
+#endif
+  return kAllocAlignment;
+}
+
+/*!
+ * \brief Allocate nbytes with the policy above. Returns nullptr on failure; the buffer
+ *        must be released with AlignedFree.
+ */
+inline void* AlignedMalloc(std::size_t nbytes) {
+  if (nbytes == 0) {
+    nbytes = 1;  // like malloc(0), return a unique pointer that can be freed
+  }
+  std::size_t const alignment = AllocAlignmentFor(nbytes);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  std::size_t const padded = (nbytes + alignment - 1) / alignment * alignment;
+#if defined(_MSC_VER)
+  void* ptr = _aligned_malloc(padded, alignment);
+#else
+  void* ptr = std::aligned_alloc(alignment, padded);
+#endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (ptr && alignment == kHugePageSize) {
+    // Best effort: the kernel may decline (THP disabled, fragmentation); the buffer is
+    // correct either way
+    madvise(ptr, padded, MADV_HUGEPAGE);
+  }
+#endif
+  return ptr;
+}
+
+/*! \brief Release a buffer obtained from AlignedMalloc / AlignedRealloc */
+inline void AlignedFree(void* ptr) {
+#if defined(_MSC_VER)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+/*!
+ * \brief Grow (or shrink) a buffer obtained from AlignedMalloc, preserving its contents.
+ *        There is no aligned counterpart of realloc, so this allocates fresh and copies;
+ *        old_nbytes must be the byte size the buffer was allocated with. Like realloc,
+ *        returns nullptr and leaves the old buffer intact on failure.
+ */
+inline void* AlignedRealloc(void* ptr, std::size_t old_nbytes, std::size_t new_nbytes) {
+  void* newbuf = AlignedMalloc(new_nbytes);
+  if (newbuf && ptr) {
+    std::memcpy(newbuf, ptr, std::min(old_nbytes, new_nbytes));
+  }
+  if (newbuf) {
+    AlignedFree(ptr);
+  }
+  return newbuf;
+}
+
+}  // namespace treelite::detail
+
+#endif  // TREELITE_DETAIL_ALIGNED_ALLOC_H_
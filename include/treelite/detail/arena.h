@@ -0,0 +1,90 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file arena.h
+ * \brief Slab arena servicing the per-tree array allocations of a model
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_ARENA_H_
+#define TREELITE_DETAIL_ARENA_H_
+
+#include <treelite/detail/aligned_alloc.h>
+#include <treelite/logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace treelite::detail {
+
+/*!
+ * \brief Slab allocator backing the ContiguousArray buffers of a loaded model. Each Tree owns
+ *        some twenty arrays; servicing them from large slabs instead of individual mallocs
+ *        keeps a model's trees packed into few, mostly consecutive pages, improving load time
+ *        and traversal locality. Arrays reference arena memory as foreign buffers, so the
+ *        arena must outlive them; Model keeps its arena alive via a shared_ptr. Individual
+ *        allocations are never freed; all slabs are released when the arena is destroyed.
+ *        Allocation is thread-safe, so trees can be decoded in parallel.
+ */
+class Arena {
+ public:
+  // One huge page per slab, so the aligned allocator gives every slab hugepage backing
+  static constexpr std::size_t kDefaultSlabSize = kHugePageSize;
+
+  explicit Arena(std::size_t slab_nbytes = kDefaultSlabSize) : slab_nbytes_(slab_nbytes) {}
+  ~Arena() = default;
+  Arena(Arena const&) = delete;
+  Arena& operator=(Arena const&) = delete;
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  /*!
+   * \brief Allocate nbytes bytes with the given alignment. The memory remains valid until
+   *        the arena is destroyed.
+   */
+  void* Allocate(std::size_t nbytes, std::size_t alignment) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto cur = reinterpret_cast<std::uintptr_t>(cur_);
+    std::size_t const padding = (alignment - cur % alignment) % alignment;
+    if (cur_ == nullptr || padding + nbytes > remaining_) {
+      // Oversized requests get a dedicated slab, so the padding always fits a regular one
+      std::size_t const new_slab_nbytes = std::max(slab_nbytes_, nbytes + alignment);
+      char* slab = static_cast<char*>(AlignedMalloc(new_slab_nbytes));
+      TREELITE_CHECK(slab) << "Could not allocate arena slab";
+      slabs_.emplace_back(slab);
+      cur_ = slabs_.back().get();
+      remaining_ = new_slab_nbytes;
+      cur = reinterpret_cast<std::uintptr_t>(cur_);
+      return Carve((alignment - cur % alignment) % alignment, nbytes);
+    }
+    return Carve(padding, nbytes);
+  }
+
+ private:
+  void* Carve(std::size_t padding, std::size_t nbytes) {
+    cur_ += padding;
+    remaining_ -= padding + nbytes;
+    void* ptr = cur_;
+    cur_ += nbytes;
+    return ptr;
+  }
+
+  struct SlabDeleter {
+    void operator()(char* ptr) const {
+      AlignedFree(ptr);
+    }
+  };
+
+  std::size_t slab_nbytes_;
+  std::vector<std::unique_ptr<char, SlabDeleter>> slabs_;
+  char* cur_{nullptr};
+  std::size_t remaining_{0};
+  std::mutex mutex_;
+};
+
+}  // namespace treelite::detail
+
+#endif  // TREELITE_DETAIL_ARENA_H_
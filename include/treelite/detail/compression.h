@@ -0,0 +1,173 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file compression.h
+ * \brief Self-contained LZ4 block codec, used to compress array payloads in serialized models.
+ *        Implements the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+ *        with a greedy single-probe matcher, so compressed blocks are readable by any
+ *        conforming LZ4 decoder. No external dependency is required.
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_COMPRESSION_H_
+#define TREELITE_DETAIL_COMPRESSION_H_
+
+#include <treelite/logging.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace treelite::detail::compression {
+
+/*! \brief Upper bound on the size of an LZ4 block encoding nbytes of input */
+inline std::uint64_t MaxCompressedSize(std::uint64_t nbytes) {
+  return nbytes + nbytes / 255 + 16;
+}
+
+/*!
+ * \brief Compress a buffer into the LZ4 block format.
+ * \param src Input buffer
+ * \param src_len Length of the input buffer, in bytes
+ * \param dst Output buffer; must hold at least MaxCompressedSize(src_len) bytes
+ * \return Size of the compressed block, in bytes
+ */
+inline std::uint64_t CompressLZ4(char const* src_, std::uint64_t src_len, char* dst_) {
+  auto const* src = reinterpret_cast<unsigned char const*>(src_);
+  auto* dst = reinterpret_cast<unsigned char*>(dst_);
+  constexpr std::uint64_t kMinMatch = 4;  // matches must be at least 4 bytes
+  constexpr std::uint64_t kLastLiterals = 5;  // the last 5 bytes are always literals
+  constexpr std::uint64_t kMFLimit = 12;  // matches must start 12+ bytes before the end
+  constexpr std::uint64_t kMaxOffset = 65535;  // match offsets are 16-bit
+  constexpr int kHashLog = 13;
+
+  std::uint64_t op = 0;
+  auto write_length = [&](std::uint64_t len) {
+    while (len >= 255) {
+      dst[op++] = 255;
+      len -= 255;
+    }
+    dst[op++] = static_cast<unsigned char>(len);
+  };
+  auto emit_literals = [&](std::uint64_t begin, std::uint64_t len, unsigned char* token) {
+    if (len >= 15) {
+      *token = static_cast<unsigned char>(15 << 4);
+      write_length(len - 15);
+    } else {
+      *token = static_cast<unsigned char>(len << 4);
+    }
+    std::memcpy(dst + op, src + begin, len);
+    op += len;
+  };
+
+  std::uint64_t ip = 0, anchor = 0;
+  if (src_len >= kMFLimit && src_len <= std::numeric_limits<std::uint32_t>::max()) {
+    // Hash table of candidate match positions; a stored value v refers to position v - 1,
+    // so that zero-initialized slots read as empty
+    std::vector<std::uint32_t> hash_table(std::uint64_t(1) << kHashLog, 0);
+    auto hash = [](std::uint32_t seq) { return (seq * 2654435761U) >> (32 - kHashLog); };
+
+    std::uint64_t const match_limit = src_len - kMFLimit;
+    while (ip <= match_limit) {
+      std::uint32_t seq;
+      std::memcpy(&seq, src + ip, sizeof(seq));
+      std::uint32_t const h = hash(seq);
+      std::uint64_t const cand = hash_table[h];
+      hash_table[h] = static_cast<std::uint32_t>(ip + 1);
+      std::uint32_t cand_seq = 0;
+      if (cand == 0 || ip + 1 - cand > kMaxOffset
+          || (std::memcpy(&cand_seq, src + cand - 1, sizeof(cand_seq)), cand_seq != seq)) {
+        ++ip;
+        continue;
+      }
+      std::uint64_t const match = cand - 1;
+      std::uint64_t match_len = kMinMatch;
+      while (ip + match_len < src_len - kLastLiterals && src[match + match_len] == src[ip + match_len]) {
+        ++match_len;
+      }
+
+      unsigned char token;
+      std::uint64_t const token_pos = op++;
+      emit_literals(anchor, ip - anchor, &token);
+      std::uint64_t const offset = ip - match;
+      dst[op++] = static_cast<unsigned char>(offset & 0xFF);
+      dst[op++] = static_cast<unsigned char>(offset >> 8);
+      if (match_len - kMinMatch >= 15) {
+        token |= 15;
+        write_length(match_len - kMinMatch - 15);
+      } else {
+        token |= static_cast<unsigned char>(match_len - kMinMatch);
+      }
+      dst[token_pos] = token;
+      ip += match_len;
+      anchor = ip;
+    }
+  }
+
+  // Final sequence: remaining bytes as literals, with no match part
+  unsigned char token;
+  std::uint64_t const token_pos = op++;
+  emit_literals(anchor, src_len - anchor, &token);
+  dst[token_pos] = token;
+  return op;
+}
+
+/*!
+ * \brief Decompress an LZ4 block. The size of the decompressed output must be known exactly.
+ * \param src Compressed block
+ * \param src_len Size of the compressed block, in bytes
+ * \param dst Output buffer
+ * \param dst_len Expected size of the decompressed output, in bytes
+ */
+inline void DecompressLZ4(
+    char const* src_, std::uint64_t src_len, char* dst_, std::uint64_t dst_len) {
+  auto const* src = reinterpret_cast<unsigned char const*>(src_);
+  auto* dst = reinterpret_cast<unsigned char*>(dst_);
+  std::uint64_t ip = 0, op = 0;
+  while (ip < src_len) {
+    unsigned char const token = src[ip++];
+    std::uint64_t literal_len = token >> 4;
+    if (literal_len == 15) {
+      unsigned char b;
+      do {
+        TREELITE_CHECK_LT(ip, src_len) << "Corrupted LZ4 block";
+        b = src[ip++];
+        literal_len += b;
+      } while (b == 255);
+    }
+    TREELITE_CHECK(literal_len <= src_len - ip && literal_len <= dst_len - op)
+        << "Corrupted LZ4 block";
+    std::memcpy(dst + op, src + ip, literal_len);
+    ip += literal_len;
+    op += literal_len;
+    if (ip == src_len) {
+      break;  // the last sequence carries literals only
+    }
+
+    TREELITE_CHECK_LE(ip + 2, src_len) << "Corrupted LZ4 block";
+    std::uint64_t const offset = static_cast<std::uint64_t>(src[ip])
+                                 | (static_cast<std::uint64_t>(src[ip + 1]) << 8);
+    ip += 2;
+    TREELITE_CHECK(offset > 0 && offset <= op) << "Corrupted LZ4 block";
+    std::uint64_t match_len = (token & 15) + 4;
+    if ((token & 15) == 15) {
+      unsigned char b;
+      do {
+        TREELITE_CHECK_LT(ip, src_len) << "Corrupted LZ4 block";
+        b = src[ip++];
+        match_len += b;
+      } while (b == 255);
+    }
+    TREELITE_CHECK_LE(match_len, dst_len - op) << "Corrupted LZ4 block";
+    // Matches may overlap their own output; copy byte by byte
+    for (std::uint64_t i = 0; i < match_len; ++i) {
+      dst[op + i] = dst[op - offset + i];
+    }
+    op += match_len;
+  }
+  TREELITE_CHECK_EQ(op, dst_len) << "Corrupted LZ4 block: unexpected decompressed size";
+}
+
+}  // namespace treelite::detail::compression
+
+#endif  // TREELITE_DETAIL_COMPRESSION_H_
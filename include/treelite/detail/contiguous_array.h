@@ -7,6 +7,7 @@
 #ifndef TREELITE_DETAIL_CONTIGUOUS_ARRAY_H_
 #define TREELITE_DETAIL_CONTIGUOUS_ARRAY_H_
 
+#include <treelite/detail/aligned_alloc.h>
 #include <treelite/logging.h>
 
 #include <algorithm>
@@ -23,13 +24,13 @@ ContiguousArray<T>::ContiguousArray()
 template <typename T>
 ContiguousArray<T>::~ContiguousArray() {
   if (buffer_ && owned_buffer_) {
-    std::free(buffer_);
+    detail::AlignedFree(buffer_);
   }
 }
 
 template <typename T>
 ContiguousArray<T>::ContiguousArray(std::vector<T> const& other) {
-  buffer_ = static_cast<T*>(std::malloc(sizeof(T) * other.capacity()));
+  buffer_ = static_cast<T*>(detail::AlignedMalloc(sizeof(T) * other.capacity()));
   TREELITE_CHECK(buffer_) << "Could not allocate buffer";
   std::memcpy(buffer_, other.data(), sizeof(T) * other.size());
   size_ = other.size();
@@ -40,9 +41,9 @@ ContiguousArray<T>::ContiguousArray(std::vector<T> const& other) {
 template <typename T>
 ContiguousArray<T>& ContiguousArray<T>::operator=(std::vector<T> const& other) {
   if (buffer_ && owned_buffer_) {
-    std::free(buffer_);
+    detail::AlignedFree(buffer_);
   }
-  buffer_ = static_cast<T*>(std::malloc(sizeof(T) * other.capacity()));
+  buffer_ = static_cast<T*>(detail::AlignedMalloc(sizeof(T) * other.capacity()));
   TREELITE_CHECK(buffer_) << "Could not allocate buffer";
   std::memcpy(buffer_, other.data(), sizeof(T) * other.size());
   size_ = other.size();
@@ -64,7 +65,7 @@ ContiguousArray<T>::ContiguousArray(ContiguousArray&& other) noexcept
 template <typename T>
 ContiguousArray<T>& ContiguousArray<T>::operator=(ContiguousArray&& other) noexcept {
   if (buffer_ && owned_buffer_) {
-    std::free(buffer_);
+    detail::AlignedFree(buffer_);
   }
   buffer_ = other.buffer_;
   size_ = other.size_;
@@ -79,7 +80,7 @@ template <typename T>
 inline ContiguousArray<T> ContiguousArray<T>::Clone() const {
   ContiguousArray clone;
   if (buffer_) {
-    clone.buffer_ = static_cast<T*>(std::malloc(sizeof(T) * capacity_));
+    clone.buffer_ = static_cast<T*>(detail::AlignedMalloc(sizeof(T) * capacity_));
     TREELITE_CHECK(clone.buffer_) << "Could not allocate memory for the clone";
     std::memcpy(clone.buffer_, buffer_, sizeof(T) * size_);
   } else {
@@ -96,7 +97,7 @@ inline ContiguousArray<T> ContiguousArray<T>::Clone() const {
 template <typename T>
 inline void ContiguousArray<T>::UseForeignBuffer(void* prealloc_buf, std::size_t size) {
   if (buffer_ && owned_buffer_) {
-    std::free(buffer_);
+    detail::AlignedFree(buffer_);
   }
   buffer_ = static_cast<T*>(prealloc_buf);
   size_ = size;
@@ -147,7 +148,8 @@ inline bool ContiguousArray<T>::Empty() const {
 template <typename T>
 inline void ContiguousArray<T>::Reserve(std::size_t newsize) {
   TREELITE_CHECK(owned_buffer_) << "Cannot resize when using a foreign buffer; clone first";
-  T* newbuf = static_cast<T*>(std::realloc(static_cast<void*>(buffer_), sizeof(T) * newsize));
+  T* newbuf = static_cast<T*>(detail::AlignedRealloc(
+      static_cast<void*>(buffer_), sizeof(T) * capacity_, sizeof(T) * newsize));
   TREELITE_CHECK(newbuf) << "Could not expand buffer";
   buffer_ = newbuf;
   capacity_ = newsize;
@@ -0,0 +1,99 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file mmap_file.h
+ * \brief RAII wrapper for a memory-mapped file
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_MMAP_FILE_H_
+#define TREELITE_DETAIL_MMAP_FILE_H_
+
+#include <treelite/logging.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace treelite::detail {
+
+/*!
+ * \brief A file mapped into memory for the lifetime of this object. The mapping is private
+ *        (copy-on-write): readers share the page cache with other processes mapping the same
+ *        file, while any in-memory modification stays local and never touches the file.
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(std::filesystem::path const& filepath) {
+    auto path = std::filesystem::weakly_canonical(filepath);
+    TREELITE_CHECK(std::filesystem::exists(path)) << "Path " << filepath << " does not exist";
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    TREELITE_CHECK(file != INVALID_HANDLE_VALUE) << "Could not open file " << filepath;
+    LARGE_INTEGER file_size;
+    TREELITE_CHECK(GetFileSizeEx(file, &file_size)) << "Could not query size of " << filepath;
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    TREELITE_CHECK_GT(size_, 0) << "Cannot map an empty file " << filepath;
+    mapping_ = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);  // the mapping keeps its own reference
+    TREELITE_CHECK(mapping_) << "Could not create file mapping for " << filepath;
+    addr_ = MapViewOfFile(mapping_, FILE_MAP_COPY, 0, 0, 0);
+    TREELITE_CHECK(addr_) << "Could not map file " << filepath;
+#else
+    int fd = open(path.string().c_str(), O_RDONLY);
+    TREELITE_CHECK_GE(fd, 0) << "Could not open file " << filepath;
+    struct stat file_stat;
+    TREELITE_CHECK_EQ(fstat(fd, &file_stat), 0) << "Could not query size of " << filepath;
+    size_ = static_cast<std::size_t>(file_stat.st_size);
+    TREELITE_CHECK_GT(size_, 0) << "Cannot map an empty file " << filepath;
+    addr_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping keeps its own reference
+    TREELITE_CHECK(addr_ != MAP_FAILED) << "Could not map file " << filepath;
+#endif
+  }
+
+  explicit MappedFile(std::string const& filename)
+      : MappedFile(std::filesystem::u8path(filename)) {}
+
+  ~MappedFile() {
+#ifdef _WIN32
+    UnmapViewOfFile(addr_);
+    CloseHandle(mapping_);
+#else
+    munmap(addr_, size_);
+#endif
+  }
+
+  MappedFile(MappedFile const&) = delete;
+  MappedFile& operator=(MappedFile const&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  void* Data() const {
+    return addr_;
+  }
+  std::size_t Size() const {
+    return size_;
+  }
+
+ private:
+  void* addr_{nullptr};
+  std::size_t size_{0};
+#ifdef _WIN32
+  HANDLE mapping_{nullptr};
+#endif
+};
+
+}  // namespace treelite::detail
+
+#endif  // TREELITE_DETAIL_MMAP_FILE_H_
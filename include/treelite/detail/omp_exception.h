@@ -9,39 +9,61 @@
 
 #include <treelite/error.h>
 
+#include <atomic>
 #include <exception>
-#include <mutex>
+#include <utility>
 
 namespace treelite {
 
 /*!
- * \brief OMP Exception class catches, saves and rethrows exception from OMP blocks
+ * \brief OMP Exception class catches, saves and rethrows exception from OMP blocks.
+ *        Capture is lock-free: the first thread whose functor throws wins a
+ *        compare-exchange on an atomic flag and stores its exception, so the happy path
+ *        costs nothing beyond the try block, and schedulers can poll Stopped() once per
+ *        chunk to stop claiming work after a failure.
  */
 class OMPException {
  private:
-  // exception_ptr member to store the exception
-  std::exception_ptr omp_exception_;
-  // mutex to be acquired during catch to set the exception_ptr
-  std::mutex mutex_;
+  // set once by the first thread whose functor throws
+  std::atomic<bool> captured_{false};
+  // exception_ptr member to store the exception; written only by the thread that won the
+  // compare-exchange, and read in Rethrow() after the parallel region has joined
+  std::exception_ptr omp_exception_{nullptr};
 
  public:
+  /*!
+   * \brief Whether an exception has been captured. A single relaxed atomic load;
+   *        schedulers poll this once per chunk so the remaining chunks exit early.
+   */
+  bool Stopped() const {
+    return captured_.load(std::memory_order_relaxed);
+  }
+
   /*!
    * \brief Parallel OMP blocks should be placed within Run to save exception
    */
   template <typename Function, typename... Parameters>
-  void Run(Function f, Parameters... params) {
+  void Run(Function&& f, Parameters&&... params) {
+    if (Stopped()) {
+      return;
+    }
     try {
-      f(params...);
+      f(std::forward<Parameters>(params)...);
     } catch (treelite::Error& ex) {
-      std::lock_guard<std::mutex> lock(mutex_);
-      if (!omp_exception_) {
-        omp_exception_ = std::current_exception();
-      }
+      Capture();
     } catch (std::exception& ex) {
-      std::lock_guard<std::mutex> lock(mutex_);
-      if (!omp_exception_) {
-        omp_exception_ = std::current_exception();
-      }
+      Capture();
+    }
+  }
+
+  /*!
+   * \brief Save the exception currently in flight; the first caller wins. Must be
+   *        called from within a catch block.
+   */
+  void Capture() {
+    bool expected = false;
+    if (captured_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      omp_exception_ = std::current_exception();
     }
   }
 
@@ -199,10 +199,7 @@ inline void WriteStringToStream(std::string* str, std::ostream& os) {
   os.write(str->data(), sizeof(char) * str->length());
 }
 
-inline void SkipOptionalFieldInStream(std::istream& is) {
-  std::string field_name;
-  ReadStringFromStream(&field_name, is);
-
+inline void SkipOptionalFieldContentInStream(std::istream& is) {
   std::uint64_t elem_size, nelem;
   ReadScalarFromStream(&elem_size, is);
   ReadScalarFromStream(&nelem, is);
@@ -212,6 +209,12 @@ inline void SkipOptionalFieldInStream(std::istream& is) {
   is.seekg(static_cast<std::streamoff>(nbytes), std::ios::cur);
 }
 
+inline void SkipOptionalFieldInStream(std::istream& is) {
+  std::string field_name;
+  ReadStringFromStream(&field_name, is);
+  SkipOptionalFieldContentInStream(is);
+}
+
 }  // namespace treelite::detail::serializer
 
 #endif  // TREELITE_DETAIL_SERIALIZER_H_
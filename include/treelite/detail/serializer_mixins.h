@@ -9,9 +9,14 @@
 #define TREELITE_DETAIL_SERIALIZER_MIXINS_H_
 
 #include <treelite/contiguous_array.h>
+#include <treelite/detail/arena.h>
+#include <treelite/detail/compression.h>
 #include <treelite/detail/serializer.h>
+#include <treelite/enum/codec.h>
 #include <treelite/pybuffer_frame.h>
 
+#include <cstdint>
+#include <cstring>
 #include <istream>
 #include <ostream>
 #include <string>
@@ -59,14 +64,376 @@ class StreamDeserializerMixIn {
     ReadArrayFromStream(field, is_);
   }
 
+  template <typename T>
+  void SkipArray(ContiguousArray<T>* field) {
+    field->Clear();
+    std::uint64_t nelem;
+    ReadScalarFromStream(&nelem, is_);
+    is_.seekg(static_cast<std::streamoff>(sizeof(T) * nelem), std::ios::cur);
+  }
+
   void SkipOptionalField() {
     SkipOptionalFieldInStream(is_);
   }
 
+  void SkipOptionalFieldContent() {
+    SkipOptionalFieldContentInStream(is_);
+  }
+
  private:
   std::istream& is_;
 };
 
+/*!
+ * \brief Serializer mix-in that writes nothing and only counts the bytes the stream format
+ *        would produce. Used to compute the per-tree offset table without serializing twice.
+ */
+class CountingSerializerMixIn {
+ public:
+  CountingSerializerMixIn() = default;
+
+  template <typename T>
+  void SerializeScalar(T*) {
+    nbytes_ += sizeof(T);
+  }
+
+  void SerializeString(std::string* field) {
+    nbytes_ += sizeof(std::uint64_t) + field->length();
+  }
+
+  template <typename T>
+  void SerializeArray(ContiguousArray<T>* field) {
+    nbytes_ += sizeof(std::uint64_t) + sizeof(T) * field->Size();
+  }
+
+  std::uint64_t GetByteCount() const {
+    return nbytes_;
+  }
+
+ private:
+  std::uint64_t nbytes_{0};
+};
+
+/*!
+ * \brief Serializer mix-in writing to a fixed extent of an in-memory buffer. The extent must
+ *        be sized up front (e.g. with CountingSerializerMixIn); writing past it is an error.
+ *        Disjoint extents of one buffer can be written from different threads concurrently.
+ */
+class BufferSerializerMixIn {
+ public:
+  BufferSerializerMixIn(char* base, std::size_t size)
+      : cur_(base), end_(base + size) {}
+
+  template <typename T>
+  void SerializeScalar(T* field) {
+    Append(field, sizeof(T));
+  }
+
+  void SerializeString(std::string* field) {
+    std::uint64_t str_len = field->length();
+    SerializeScalar(&str_len);
+    Append(field->data(), field->length());
+  }
+
+  template <typename T>
+  void SerializeArray(ContiguousArray<T>* field) {
+    auto nelem = static_cast<std::uint64_t>(field->Size());
+    SerializeScalar(&nelem);
+    Append(field->Data(), sizeof(T) * field->Size());
+  }
+
+  /*! \brief Number of bytes written so far */
+  std::size_t Tell() const {
+    return cur_ - begin_;
+  }
+
+ private:
+  void Append(void const* ptr, std::size_t nbytes) {
+    TREELITE_CHECK_LE(nbytes, static_cast<std::size_t>(end_ - cur_))
+        << "Buffer extent too small for the serialized output";
+    std::memcpy(cur_, ptr, nbytes);
+    cur_ += nbytes;
+  }
+
+  char* cur_;
+  char* end_;
+  char* begin_{cur_};
+};
+
+/*!
+ * \brief Deserializer mix-in reading from a contiguous in-memory buffer. When kCopyArrays is
+ *        false, arrays are not copied: each ContiguousArray is pointed at its extent of the
+ *        buffer via UseForeignBuffer, as long as the extent is suitably aligned for the
+ *        element type (misaligned arrays fall back to an owned copy), and the buffer must
+ *        outlive the deserialized model. When kCopyArrays is true, every array is copied
+ *        into an owned allocation, for use with buffers of transient lifetime; an optional
+ *        arena services these copies from large slabs instead of individual mallocs, and
+ *        must then outlive the deserialized model.
+ */
+template <bool kCopyArrays>
+class BufferDeserializerMixIn {
+ public:
+  BufferDeserializerMixIn(void* base, std::size_t size, Arena* arena = nullptr)
+      : cur_(static_cast<char*>(base)), end_(static_cast<char*>(base) + size), arena_(arena) {}
+
+  template <typename T>
+  void DeserializeScalar(T* field) {
+    std::memcpy(field, Consume(sizeof(T)), sizeof(T));
+  }
+
+  void DeserializeString(std::string* field) {
+    std::uint64_t str_len;
+    DeserializeScalar(&str_len);
+    if (str_len == 0) {
+      return;  // handle empty string
+    }
+    *field = std::string(Consume(str_len), str_len);
+  }
+
+  template <typename T>
+  void DeserializeArray(ContiguousArray<T>* field) {
+    std::uint64_t nelem;
+    DeserializeScalar(&nelem);
+    field->Clear();
+    if (nelem == 0) {
+      return;  // handle empty arrays
+    }
+    char* buf = Consume(sizeof(T) * nelem);
+    if (!kCopyArrays && reinterpret_cast<std::uintptr_t>(buf) % alignof(T) == 0) {
+      field->UseForeignBuffer(buf, nelem);
+    } else if (arena_) {
+      void* mem = arena_->Allocate(sizeof(T) * nelem, alignof(T));
+      std::memcpy(mem, buf, sizeof(T) * nelem);
+      field->UseForeignBuffer(mem, nelem);
+    } else {
+      field->Resize(nelem);
+      std::memcpy(field->Data(), buf, sizeof(T) * nelem);
+    }
+  }
+
+  template <typename T>
+  void SkipArray(ContiguousArray<T>* field) {
+    field->Clear();
+    std::uint64_t nelem;
+    DeserializeScalar(&nelem);
+    Consume(sizeof(T) * nelem);
+  }
+
+  void SkipOptionalField() {
+    std::string field_name;
+    DeserializeString(&field_name);
+    SkipOptionalFieldContent();
+  }
+
+  void SkipOptionalFieldContent() {
+    std::uint64_t elem_size, nelem;
+    DeserializeScalar(&elem_size);
+    DeserializeScalar(&nelem);
+    Consume(elem_size * nelem);
+  }
+
+  /*! \brief Position of the read cursor, relative to the start of the buffer */
+  std::size_t Tell() const {
+    return cur_ - begin_;
+  }
+
+ private:
+  char* Consume(std::uint64_t nbytes) {
+    TREELITE_CHECK_LE(nbytes, static_cast<std::uint64_t>(end_ - cur_))
+        << "Unexpected end of buffer while deserializing a model";
+    char* ptr = cur_;
+    cur_ += nbytes;
+    return ptr;
+  }
+
+  char* cur_;
+  char* end_;
+  char* begin_{cur_};
+  Arena* arena_;
+};
+
+/*! \brief Deserializer mix-in reading from a memory-mapped model file, without copies */
+using MappedFileDeserializerMixIn = BufferDeserializerMixIn<false>;
+/*! \brief Deserializer mix-in reading from a transient in-memory buffer, copying arrays */
+using MemoryBufferDeserializerMixIn = BufferDeserializerMixIn<true>;
+
+/*!
+ * \brief Serializer mix-in appending to an in-memory buffer, compressing each array's payload
+ *        with the given codec. Each array frame carries its own codec byte; arrays whose
+ *        payload does not shrink are stored raw. Scalars and strings are not compressed.
+ */
+class CompressedVectorSerializerMixIn {
+ public:
+  CompressedVectorSerializerMixIn(std::vector<char>& buf, Codec codec)
+      : buf_(buf), codec_(codec) {}
+
+  template <typename T>
+  void SerializeScalar(T* field) {
+    Append(field, sizeof(T));
+  }
+
+  void SerializeString(std::string* field) {
+    std::uint64_t str_len = field->length();
+    SerializeScalar(&str_len);
+    Append(field->data(), field->length());
+  }
+
+  template <typename T>
+  void SerializeArray(ContiguousArray<T>* field) {
+    auto nelem = static_cast<std::uint64_t>(field->Size());
+    SerializeScalar(&nelem);
+    if (nelem == 0) {
+      return;  // handle empty arrays
+    }
+    std::uint64_t const raw_nbytes = sizeof(T) * nelem;
+    scratch_.resize(compression::MaxCompressedSize(raw_nbytes));
+    std::uint64_t compressed_nbytes = compression::CompressLZ4(
+        reinterpret_cast<char const*>(field->Data()), raw_nbytes, scratch_.data());
+    if (compressed_nbytes < raw_nbytes) {
+      auto frame_codec = static_cast<std::uint8_t>(codec_);
+      SerializeScalar(&frame_codec);
+      SerializeScalar(&compressed_nbytes);
+      Append(scratch_.data(), compressed_nbytes);
+    } else {  // incompressible payload; store raw
+      auto frame_codec = static_cast<std::uint8_t>(Codec::kUncompressed);
+      SerializeScalar(&frame_codec);
+      std::uint64_t nbytes = raw_nbytes;
+      SerializeScalar(&nbytes);
+      Append(field->Data(), raw_nbytes);
+    }
+  }
+
+  /*! \brief Number of bytes written so far */
+  std::size_t Tell() const {
+    return buf_.size();
+  }
+
+ private:
+  void Append(void const* ptr, std::size_t nbytes) {
+    auto const* src = static_cast<char const*>(ptr);
+    buf_.insert(buf_.end(), src, src + nbytes);
+  }
+
+  std::vector<char>& buf_;
+  Codec codec_;
+  std::vector<char> scratch_;
+};
+
+/*!
+ * \brief Deserializer mix-in reading array frames written by CompressedVectorSerializerMixIn,
+ *        decompressing each array's payload into an owned allocation, or into an arena if
+ *        one is given (the arena must then outlive the deserialized model).
+ */
+class CompressedBufferDeserializerMixIn {
+ public:
+  CompressedBufferDeserializerMixIn(void* base, std::size_t size, Arena* arena = nullptr)
+      : cur_(static_cast<char*>(base)), end_(static_cast<char*>(base) + size), arena_(arena) {}
+
+  template <typename T>
+  void DeserializeScalar(T* field) {
+    std::memcpy(field, Consume(sizeof(T)), sizeof(T));
+  }
+
+  void DeserializeString(std::string* field) {
+    std::uint64_t str_len;
+    DeserializeScalar(&str_len);
+    if (str_len == 0) {
+      return;  // handle empty string
+    }
+    *field = std::string(Consume(str_len), str_len);
+  }
+
+  template <typename T>
+  void DeserializeArray(ContiguousArray<T>* field) {
+    std::uint64_t nelem;
+    DeserializeScalar(&nelem);
+    field->Clear();
+    if (nelem == 0) {
+      return;  // handle empty arrays
+    }
+    std::uint8_t frame_codec;
+    DeserializeScalar(&frame_codec);
+    std::uint64_t nbytes;
+    DeserializeScalar(&nbytes);
+    char* buf = Consume(nbytes);
+    std::uint64_t const raw_nbytes = sizeof(T) * nelem;
+    T* dest;
+    if (arena_) {
+      dest = static_cast<T*>(arena_->Allocate(raw_nbytes, alignof(T)));
+      field->UseForeignBuffer(dest, nelem);
+    } else {
+      field->Resize(nelem);
+      dest = field->Data();
+    }
+    switch (static_cast<Codec>(frame_codec)) {
+    case Codec::kUncompressed:
+      TREELITE_CHECK_EQ(nbytes, raw_nbytes) << "Corrupted array frame";
+      std::memcpy(dest, buf, raw_nbytes);
+      break;
+    case Codec::kLZ4:
+      compression::DecompressLZ4(buf, nbytes, reinterpret_cast<char*>(dest), raw_nbytes);
+      break;
+    default:
+      TREELITE_LOG(FATAL) << "Unrecognized codec in array frame: "
+                          << static_cast<int>(frame_codec);
+    }
+  }
+
+  template <typename T>
+  void SkipArray(ContiguousArray<T>* field) {
+    field->Clear();
+    std::uint64_t nelem;
+    DeserializeScalar(&nelem);
+    if (nelem == 0) {
+      return;
+    }
+    std::uint8_t frame_codec;
+    DeserializeScalar(&frame_codec);
+    std::uint64_t nbytes;
+    DeserializeScalar(&nbytes);
+    Consume(nbytes);
+  }
+
+  void SkipOptionalField() {
+    std::string field_name;
+    DeserializeString(&field_name);
+    SkipOptionalFieldContent();
+  }
+
+  void SkipOptionalFieldContent() {
+    std::uint64_t elem_size, nelem;
+    DeserializeScalar(&elem_size);
+    DeserializeScalar(&nelem);
+    if (nelem == 0) {
+      return;
+    }
+    std::uint8_t frame_codec;
+    DeserializeScalar(&frame_codec);
+    std::uint64_t nbytes;
+    DeserializeScalar(&nbytes);
+    Consume(nbytes);
+  }
+
+  /*! \brief Position of the read cursor, relative to the start of the buffer */
+  std::size_t Tell() const {
+    return cur_ - begin_;
+  }
+
+ private:
+  char* Consume(std::uint64_t nbytes) {
+    TREELITE_CHECK_LE(nbytes, static_cast<std::uint64_t>(end_ - cur_))
+        << "Unexpected end of buffer while deserializing a model";
+    char* ptr = cur_;
+    cur_ += nbytes;
+    return ptr;
+  }
+
+  char* cur_;
+  char* end_;
+  char* begin_{cur_};
+  Arena* arena_;
+};
+
 class PyBufferSerializerMixIn {
  public:
   PyBufferSerializerMixIn() = default;
@@ -112,10 +479,20 @@ class PyBufferDeserializerMixIn {
     InitArrayFromPyBuffer(field, frames_[cur_idx_++]);
   }
 
+  template <typename T>
+  void SkipArray(ContiguousArray<T>* field) {
+    field->Clear();
+    cur_idx_ += 1;
+  }
+
   void SkipOptionalField() {
     cur_idx_ += 2;  // field name + content
   }
 
+  void SkipOptionalFieldContent() {
+    cur_idx_ += 1;  // content only; the field name was already consumed
+  }
+
  private:
   std::vector<PyBufferFrame> const& frames_;
   std::size_t cur_idx_;
@@ -0,0 +1,147 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file shm_region.h
+ * \brief RAII wrapper for a named shared memory region
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_SHM_REGION_H_
+#define TREELITE_DETAIL_SHM_REGION_H_
+
+#include <treelite/logging.h>
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace treelite::detail {
+
+/*!
+ * \brief A named shared memory region, mapped for the lifetime of this object. A creator maps
+ *        the region read-write and fills it; attachers map the same name read-only and share
+ *        the one physical copy with the creator and each other. On POSIX the region persists
+ *        until \ref Remove is called; on Windows a named section lives for as long as some
+ *        process keeps a region object open on it.
+ */
+class SharedMemoryRegion {
+ public:
+  /*! \brief Create a region of the given size under the given name and map it read-write */
+  SharedMemoryRegion(std::string const& name, std::size_t size) {
+    TREELITE_CHECK_GT(size, 0) << "Cannot create an empty shared memory region";
+#ifdef _WIN32
+    mapping_ = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFU), name.c_str());
+    TREELITE_CHECK(mapping_) << "Could not create shared memory region " << name;
+    addr_ = MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    TREELITE_CHECK(addr_) << "Could not map shared memory region " << name;
+    size_ = size;
+#else
+    std::string const shm_name = NormalizeName(name);
+    int fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+    TREELITE_CHECK_GE(fd, 0) << "Could not create shared memory region " << name;
+    TREELITE_CHECK_EQ(ftruncate(fd, static_cast<off_t>(size)), 0)
+        << "Could not resize shared memory region " << name;
+    size_ = size;
+    addr_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);  // the mapping keeps its own reference
+    TREELITE_CHECK(addr_ != MAP_FAILED) << "Could not map shared memory region " << name;
+#endif
+  }
+
+  /*!
+   * \brief Attach to an existing region read-only. On Windows the reported size is rounded
+   *        up to the allocation granularity; any padding past the creator's payload is
+   *        zero-filled.
+   */
+  explicit SharedMemoryRegion(std::string const& name) {
+#ifdef _WIN32
+    mapping_ = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+    TREELITE_CHECK(mapping_) << "Could not open shared memory region " << name;
+    addr_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+    TREELITE_CHECK(addr_) << "Could not map shared memory region " << name;
+    MEMORY_BASIC_INFORMATION info;
+    TREELITE_CHECK_GT(VirtualQuery(addr_, &info, sizeof(info)), 0)
+        << "Could not query size of shared memory region " << name;
+    size_ = info.RegionSize;
+#else
+    std::string const shm_name = NormalizeName(name);
+    int fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+    TREELITE_CHECK_GE(fd, 0) << "Could not open shared memory region " << name;
+    struct stat region_stat;
+    TREELITE_CHECK_EQ(fstat(fd, &region_stat), 0)
+        << "Could not query size of shared memory region " << name;
+    size_ = static_cast<std::size_t>(region_stat.st_size);
+    TREELITE_CHECK_GT(size_, 0) << "Shared memory region " << name << " is empty";
+    addr_ = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // the mapping keeps its own reference
+    TREELITE_CHECK(addr_ != MAP_FAILED) << "Could not map shared memory region " << name;
+#endif
+  }
+
+  ~SharedMemoryRegion() {
+#ifdef _WIN32
+    UnmapViewOfFile(addr_);
+    CloseHandle(mapping_);
+#else
+    munmap(addr_, size_);
+#endif
+  }
+
+  /*!
+   * \brief Remove a named region, so that new attaches fail. Processes already attached keep
+   *        their mappings until they detach. No-op on Windows, where the section is reclaimed
+   *        as soon as the last region object open on it is destroyed.
+   */
+  static void Remove(std::string const& name) {
+#ifdef _WIN32
+    (void)name;
+#else
+    std::string const shm_name = NormalizeName(name);
+    TREELITE_CHECK(shm_unlink(shm_name.c_str()) == 0 || errno == ENOENT)
+        << "Could not remove shared memory region " << name;
+#endif
+  }
+
+  SharedMemoryRegion(SharedMemoryRegion const&) = delete;
+  SharedMemoryRegion& operator=(SharedMemoryRegion const&) = delete;
+  SharedMemoryRegion(SharedMemoryRegion&&) = delete;
+  SharedMemoryRegion& operator=(SharedMemoryRegion&&) = delete;
+
+  void* Data() const {
+    return addr_;
+  }
+  std::size_t Size() const {
+    return size_;
+  }
+
+ private:
+#ifndef _WIN32
+  // POSIX shm names must begin with a slash; prepend one if the caller did not
+  static std::string NormalizeName(std::string const& name) {
+    if (!name.empty() && name.front() == '/') {
+      return name;
+    }
+    return "/" + name;
+  }
+#endif
+
+  void* addr_{nullptr};
+  std::size_t size_{0};
+#ifdef _WIN32
+  HANDLE mapping_{nullptr};
+#endif
+};
+
+}  // namespace treelite::detail
+
+#endif  // TREELITE_DETAIL_SHM_REGION_H_
@@ -0,0 +1,146 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file thread_pool.h
+ * \brief Persistent worker pool, as an alternative to spawning an OpenMP team per loop
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_DETAIL_THREAD_POOL_H_
+#define TREELITE_DETAIL_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace treelite::detail::threading_utils {
+
+/*!
+ * \brief A process-wide pool of worker threads that stay parked on a condition variable
+ *        between tasks. Handing a task to parked workers costs microseconds, whereas
+ *        opening a fresh OpenMP parallel region per loop shows up in tail latency when
+ *        many small batches are served back to back.
+ *
+ * Tasks are serialized: Run() holds an exclusive lock for its whole duration and returns
+ * only after every participating worker has finished, so at most one task is in flight at
+ * any time even when several application threads call Run() concurrently — later callers
+ * block until the pool is free. Workers are created lazily, up to the number requested.
+ */
+class ThreadPool {
+ public:
+  static ThreadPool& Get() {
+    static ThreadPool inst;
+    return inst;
+  }
+
+  /*!
+   * \brief Run fn(thread_id) for thread_id in [0, nthread) and wait for completion.
+   *        The calling thread acts as thread 0; (nthread - 1) pool workers run the rest.
+   */
+  template <typename FnT>
+  void Run(std::uint32_t nthread, FnT const& fn) {
+    // Serialize concurrent callers: the task slots below are shared pool state, and a
+    // second task dispatched mid-flight would overwrite them and steal the first caller's
+    // completion signal
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    std::uint32_t const num_workers = nthread - 1;
+    EnsureWorkers(num_workers);
+    if (num_workers > 0) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ctx_ = &fn;
+        task_fn_ = [](void const* ctx, int thread_id) {
+          (*static_cast<FnT const*>(ctx))(thread_id);
+        };
+        num_active_ = num_workers;
+        num_pending_ = num_workers;
+        ++generation_;
+      }
+      cv_dispatch_.notify_all();
+    }
+    fn(0);
+    if (num_workers > 0) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_done_.wait(lock, [this] { return num_pending_ == 0; });
+      task_ctx_ = nullptr;
+      task_fn_ = nullptr;
+    }
+  }
+
+  ThreadPool(ThreadPool const&) = delete;
+  ThreadPool& operator=(ThreadPool const&) = delete;
+
+ private:
+  ThreadPool() = default;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+      ++generation_;
+    }
+    cv_dispatch_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void EnsureWorkers(std::uint32_t num_workers) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (workers_.size() < num_workers) {
+      // Worker IDs start at 1; the thread calling Run() is thread 0
+      int const worker_id = static_cast<int>(workers_.size()) + 1;
+      workers_.emplace_back([this, worker_id] { WorkerLoop(worker_id); });
+    }
+  }
+
+  void WorkerLoop(int worker_id) {
+    std::uint64_t last_generation = 0;
+    for (;;) {
+      void const* task_ctx;
+      void (*task_fn)(void const*, int);
+      bool participate;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_dispatch_.wait(
+            lock, [&, this] { return shutdown_ || generation_ != last_generation; });
+        if (shutdown_) {
+          return;
+        }
+        last_generation = generation_;
+        task_ctx = task_ctx_;
+        task_fn = task_fn_;
+        // Workers beyond the requested team size sit this task out
+        participate = (static_cast<std::uint32_t>(worker_id) <= num_active_);
+      }
+      if (!participate) {
+        continue;
+      }
+      task_fn(task_ctx, worker_id);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--num_pending_ == 0) {
+          cv_done_.notify_one();
+        }
+      }
+    }
+  }
+
+  /*! \brief Held for the whole of Run(), so concurrent callers take turns */
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  std::condition_variable cv_dispatch_;
+  std::condition_variable cv_done_;
+  std::vector<std::thread> workers_;
+  void const* task_ctx_{nullptr};
+  void (*task_fn_)(void const*, int){nullptr};
+  std::uint32_t num_active_{0};
+  std::uint32_t num_pending_{0};
+  std::uint64_t generation_{0};
+  bool shutdown_{false};
+};
+
+}  // namespace treelite::detail::threading_utils
+
+#endif  // TREELITE_DETAIL_THREAD_POOL_H_
@@ -9,15 +9,23 @@
 #define TREELITE_DETAIL_THREADING_UTILS_H_
 
 #include <treelite/detail/omp_exception.h>
+#include <treelite/detail/thread_pool.h>
 #include <treelite/logging.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <limits>
 #include <mutex>
 #include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif  // defined(__linux__)
 
 #if TREELITE_OPENMP_SUPPORT
 #include <omp.h>
@@ -45,6 +53,13 @@ inline int omp_get_thread_limit() {
 
 namespace treelite::detail::threading_utils {
 
+/*!
+ * \brief Default number of iterations run per protected chunk. Exceptions are caught and
+ *        the failure flag of OMPException polled once per chunk rather than once per
+ *        element, so the per-iteration happy path carries no exception-handling overhead.
+ */
+constexpr std::size_t kExceptionChunkSize = 1024;
+
 inline int OmpGetThreadLimit() {
 // MSVC doesn't implement the thread limit.
 #if defined(_MSC_VER)
@@ -60,17 +75,48 @@ inline int MaxNumThread() {
   return std::min(std::min(omp_get_num_procs(), omp_get_max_threads()), OmpGetThreadLimit());
 }
 
+/*!
+ * \brief Backend executing parallel loops. kOpenMP opens an OpenMP parallel region per
+ *        loop; kThreadPool hands the loop to the persistent worker pool, avoiding the
+ *        per-region team wake/join cost when many small loops run back to back.
+ */
+enum class ParallelBackend : std::int8_t { kOpenMP, kThreadPool };
+
+/*!
+ * \brief Thread placement policy, applied to the worker team of parallel loops. Without a
+ *        policy, placement is left to the OS scheduler, which may migrate worker threads
+ *        between CPUs mid-loop and lose their warmed caches.
+ */
+enum class AffinityPolicy : std::int8_t {
+  /*! \brief Leave placement to the OS / OpenMP runtime (the default) */
+  kNone = 0,
+  /*! \brief Pack worker threads onto consecutive CPUs, starting at CPU 0 */
+  kCompact = 1,
+  /*! \brief Spread worker threads evenly over all CPUs */
+  kScatter = 2,
+  /*! \brief Pin worker thread i to cpu_list[i % cpu_list.size()] */
+  kExplicit = 3
+};
+
 /*!
  * \brief Represent thread configuration, to be used with parallel loops.
  */
 struct ThreadConfig {
   std::uint32_t nthread;
+  ParallelBackend backend{ParallelBackend::kOpenMP};
+  AffinityPolicy affinity{AffinityPolicy::kNone};
+  /*! \brief CPU IDs to pin to, for AffinityPolicy::kExplicit */
+  std::vector<int> cpu_list{};
   /*!
    * \brief Create thread configuration.
    * @param nthread Number of threads to use. If \<= 0, use all available threads. This value is
    *                validated to ensure that it's in a valid range.
+   * @param backend Backend to execute parallel loops with
    * @return Thread configuration
    */
+  ThreadConfig(int nthread, ParallelBackend backend) : ThreadConfig(nthread) {
+    this->backend = backend;
+  }
   explicit ThreadConfig(int nthread) {
     if (nthread <= 0) {
       nthread = MaxNumThread();
@@ -83,6 +129,57 @@ struct ThreadConfig {
   }
 };
 
+/*! \brief Pin the calling thread to a single CPU. No-op on platforms without an affinity API. */
+inline void PinThreadToCpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPU_SET(cpu, &cpuset);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#else
+  (void) cpu;
+#endif  // defined(__linux__)
+}
+
+/*! \brief CPU assigned to a worker thread under the configured affinity policy */
+inline int AffinityCpuForThread(ThreadConfig const& thread_config, int thread_id) {
+  int const num_cpu = omp_get_num_procs();
+  switch (thread_config.affinity) {
+  case AffinityPolicy::kCompact:
+    return thread_id % num_cpu;
+  case AffinityPolicy::kScatter:
+    return static_cast<int>(static_cast<std::int64_t>(thread_id) * num_cpu
+                            / static_cast<std::int64_t>(thread_config.nthread))
+           % num_cpu;
+  case AffinityPolicy::kExplicit:
+    return thread_config.cpu_list[static_cast<std::size_t>(thread_id)
+                                  % thread_config.cpu_list.size()];
+  case AffinityPolicy::kNone:
+    break;
+  }
+  return -1;
+}
+
+/*!
+ * \brief Apply the affinity policy to the calling thread, acting as worker thread_id.
+ *        Pinning is sticky — it persists past the parallel loop — and covers the calling
+ *        thread too, which participates as worker 0. A thread already pinned to its
+ *        assigned CPU is left alone, so re-running loops under an unchanged policy costs
+ *        one thread-local compare rather than a syscall per loop.
+ */
+inline void ApplyThreadAffinity(ThreadConfig const& thread_config, int thread_id) {
+  if (thread_config.affinity == AffinityPolicy::kNone) {
+    return;
+  }
+  int const cpu = AffinityCpuForThread(thread_config, thread_id);
+  thread_local int last_pinned_cpu = -1;
+  if (cpu == last_pinned_cpu) {
+    return;
+  }
+  last_pinned_cpu = cpu;
+  PinThreadToCpu(cpu);
+}
+
 // OpenMP schedule
 struct ParallelSchedule {
   enum {
@@ -90,6 +187,7 @@ struct ParallelSchedule {
     kDynamic,
     kStatic,
     kGuided,
+    kWorkStealing,
   } sched{kStatic};
   std::size_t chunk{0};
 
@@ -105,14 +203,193 @@ struct ParallelSchedule {
   ParallelSchedule static Guided() {
     return ParallelSchedule{kGuided};
   }
+  ParallelSchedule static WorkStealing(std::size_t n = 0) {
+    return ParallelSchedule{kWorkStealing, n};
+  }
 };
 
+/*!
+ * \brief Work-stealing scheduler, for loops whose iterations have skewed costs. Each
+ *        thread starts with a contiguous range (as in the static schedule) and takes
+ *        chunks from its front; a thread that runs out locks the victim with the most
+ *        work left and steals the upper half of its range. Threads that finish early
+ *        thereby relieve the slow ones, instead of idling at the tail of the loop.
+ */
+template <typename IndexType, typename FuncType>
+inline void ParallelForWorkStealing(IndexType begin, IndexType end,
+    ThreadConfig const& thread_config, std::size_t chunk_hint, FuncType func) {
+  auto const nthread = static_cast<IndexType>(thread_config.nthread);
+  IndexType const count = end - begin;
+  auto const chunk = static_cast<IndexType>(std::max<std::size_t>(chunk_hint, 1));
+
+  // lo/hi are atomic so the victim scan below may read them without the queue lock;
+  // all mutations still happen under the lock
+  struct alignas(64) WorkQueue {
+    std::mutex mutex;
+    std::atomic<IndexType> lo{0};
+    std::atomic<IndexType> hi{0};
+  };
+  std::vector<WorkQueue> queues(thread_config.nthread);
+  for (IndexType t = 0; t < nthread; ++t) {
+    IndexType const base = count / nthread;
+    IndexType const remainder = count % nthread;
+    IndexType const lo = begin + t * base + std::min(t, remainder);
+    queues[t].lo.store(lo, std::memory_order_relaxed);
+    queues[t].hi.store(lo + base + (t < remainder ? 1 : 0), std::memory_order_relaxed);
+  }
+
+  OMPException exc;
+  auto worker = [&](int thread_id) {
+    ApplyThreadAffinity(thread_config, thread_id);
+    WorkQueue& own = queues[thread_id];
+    for (;;) {
+      IndexType run_begin = 0, run_end = 0;
+      {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        IndexType const lo = own.lo.load(std::memory_order_relaxed);
+        IndexType const hi = own.hi.load(std::memory_order_relaxed);
+        if (lo < hi) {
+          run_begin = lo;
+          run_end = std::min(static_cast<IndexType>(lo + chunk), hi);
+          own.lo.store(run_end, std::memory_order_relaxed);
+        }
+      }
+      if (run_begin == run_end) {
+        // Own queue drained; steal the upper half of the fullest victim's range
+        IndexType best_size = 0;
+        std::uint32_t victim = 0;
+        for (std::uint32_t t = 0; t < thread_config.nthread; ++t) {
+          // Lock-free snapshot; only a victim-selection heuristic, and the claim below
+          // re-checks the range under the victim's lock
+          IndexType const size = queues[t].hi.load(std::memory_order_relaxed)
+                                 - queues[t].lo.load(std::memory_order_relaxed);
+          if (size > best_size) {
+            best_size = size;
+            victim = t;
+          }
+        }
+        if (best_size == 0) {
+          break;  // every queue was empty at scan time; all work has been claimed
+        }
+        IndexType steal_begin = 0, steal_end = 0;
+        {
+          std::lock_guard<std::mutex> lock(queues[victim].mutex);
+          WorkQueue& vq = queues[victim];
+          IndexType const lo = vq.lo.load(std::memory_order_relaxed);
+          IndexType const hi = vq.hi.load(std::memory_order_relaxed);
+          if (lo < hi) {
+            // Round the midpoint down so the stolen upper half is never empty; with a
+            // single element left the thief takes it whole, rather than rescanning a
+            // queue that can never shrink
+            IndexType const mid = lo + (hi - lo) / 2;
+            steal_begin = mid;
+            steal_end = hi;
+            vq.hi.store(mid, std::memory_order_relaxed);
+          }
+        }
+        if (steal_begin == steal_end) {
+          continue;  // the victim drained before we could steal; rescan
+        }
+        // Never hold two queue locks at once (a reciprocal steal would deadlock):
+        // the victim lock is released before the stolen range is installed
+        run_begin = steal_begin;
+        run_end = std::min(static_cast<IndexType>(steal_begin + chunk), steal_end);
+        std::lock_guard<std::mutex> own_lock(own.mutex);
+        own.lo.store(run_end, std::memory_order_relaxed);
+        own.hi.store(steal_end, std::memory_order_relaxed);
+      }
+      if (exc.Stopped()) {
+        break;  // a chunk on some thread threw; stop claiming work
+      }
+      exc.Run([&] {
+        for (IndexType i = run_begin; i < run_end; ++i) {
+          func(i, thread_id);
+        }
+      });
+    }
+  };
+
+  if (thread_config.backend == ParallelBackend::kThreadPool) {
+    ThreadPool::Get().Run(thread_config.nthread, worker);
+  } else {
+#pragma omp parallel num_threads(thread_config.nthread)
+    { worker(omp_get_thread_num()); }
+  }
+  exc.Rethrow();
+}
+
+/*!
+ * \brief ParallelFor executed on the persistent thread pool. Static schedules become a
+ *        contiguous partition in thread order (matching the OpenMP static schedule);
+ *        dynamic schedules draw chunks from a shared atomic counter.
+ */
+template <typename IndexType, typename FuncType>
+inline void ParallelForThreadPool(IndexType begin, IndexType end,
+    ThreadConfig const& thread_config, ParallelSchedule sched, FuncType func) {
+  OMPException exc;
+  auto const nthread = static_cast<IndexType>(thread_config.nthread);
+  IndexType const count = end - begin;
+  if (sched.sched == ParallelSchedule::kDynamic || sched.sched == ParallelSchedule::kGuided) {
+    auto const chunk = static_cast<IndexType>(std::max<std::size_t>(sched.chunk, 1));
+    std::atomic<IndexType> counter{begin};
+    ThreadPool::Get().Run(thread_config.nthread, [&](int thread_id) {
+      ApplyThreadAffinity(thread_config, thread_id);
+      for (;;) {
+        if (exc.Stopped()) {
+          break;
+        }
+        IndexType const run_begin = counter.fetch_add(chunk);
+        if (run_begin >= end) {
+          break;
+        }
+        IndexType const run_end = std::min(end, static_cast<IndexType>(run_begin + chunk));
+        exc.Run([&] {
+          for (IndexType i = run_begin; i < run_end; ++i) {
+            func(i, thread_id);
+          }
+        });
+      }
+    });
+  } else {
+    ThreadPool::Get().Run(thread_config.nthread, [&](int thread_id) {
+      ApplyThreadAffinity(thread_config, thread_id);
+      auto const tid = static_cast<IndexType>(thread_id);
+      IndexType const base = count / nthread;
+      IndexType const remainder = count % nthread;
+      IndexType const my_begin
+          = begin + tid * base + std::min(tid, remainder);
+      IndexType const my_end = my_begin + base + (tid < remainder ? 1 : 0);
+      auto const exc_chunk = static_cast<IndexType>(kExceptionChunkSize);
+      for (IndexType run_begin = my_begin; run_begin < my_end; run_begin += exc_chunk) {
+        if (exc.Stopped()) {
+          break;
+        }
+        IndexType const run_end = std::min(my_end, static_cast<IndexType>(run_begin + exc_chunk));
+        exc.Run([&] {
+          for (IndexType i = run_begin; i < run_end; ++i) {
+            func(i, thread_id);
+          }
+        });
+      }
+    });
+  }
+  exc.Rethrow();
+}
+
 template <typename IndexType, typename FuncType>
 inline void ParallelFor(IndexType begin, IndexType end, ThreadConfig const& thread_config,
     ParallelSchedule sched, FuncType func) {
   if (begin == end) {
     return;
   }
+  if (sched.sched == ParallelSchedule::kWorkStealing) {
+    ParallelForWorkStealing(begin, end, thread_config, sched.chunk, func);
+    return;
+  }
+  if (thread_config.backend == ParallelBackend::kThreadPool) {
+    ParallelForThreadPool(begin, end, thread_config, sched, func);
+    return;
+  }
 
 #if defined(_MSC_VER)
   // msvc doesn't support unsigned integer as openmp index.
@@ -122,49 +399,73 @@ inline void ParallelFor(IndexType begin, IndexType end, ThreadConfig const& thre
 #endif
 
   OMPException exc;
+  /* All OpenMP schedules iterate over chunks: the functor is invoked directly inside the
+   * chunk loop and the exception flag is polled once per chunk, not once per element, so
+   * the happy path of fine-grained loops carries no per-iteration exception machinery.
+   * A caller-supplied chunk size is honored; otherwise chunks are sized so each thread
+   * gets several, capped at kExceptionChunkSize to bound the early-exit latency. */
+  IndexType const count = end - begin;
+  auto const chunk_size = static_cast<IndexType>(sched.chunk > 0
+          ? sched.chunk
+          : std::max<std::size_t>(std::size_t(1),
+                std::min<std::size_t>(kExceptionChunkSize,
+                    static_cast<std::size_t>(count)
+                        / (std::size_t(thread_config.nthread) * 4))));
+  auto const num_chunk = static_cast<OmpInd>((count + chunk_size - 1) / chunk_size);
+  auto run_chunk = [&](OmpInd chunk_id) {
+    if (exc.Stopped()) {
+      return;
+    }
+    IndexType const run_begin = begin + static_cast<IndexType>(chunk_id) * chunk_size;
+    IndexType const run_end = std::min(end, static_cast<IndexType>(run_begin + chunk_size));
+    int const thread_id = omp_get_thread_num();
+    ApplyThreadAffinity(thread_config, thread_id);
+    exc.Run([&] {
+      for (IndexType i = run_begin; i < run_end; ++i) {
+        func(i, thread_id);
+      }
+    });
+  };
   switch (sched.sched) {
   case ParallelSchedule::kAuto: {
 #pragma omp parallel for num_threads(thread_config.nthread)
-    for (OmpInd i = begin; i < end; ++i) {
-      exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
+    for (OmpInd c = 0; c < num_chunk; ++c) {
+      run_chunk(c);
     }
     break;
   }
   case ParallelSchedule::kDynamic: {
-    if (sched.chunk == 0) {
 #pragma omp parallel for num_threads(thread_config.nthread) schedule(dynamic)
-      for (OmpInd i = begin; i < end; ++i) {
-        exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
-      }
-    } else {
-#pragma omp parallel for num_threads(thread_config.nthread) schedule(dynamic, sched.chunk)
-      for (OmpInd i = begin; i < end; ++i) {
-        exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
-      }
+    for (OmpInd c = 0; c < num_chunk; ++c) {
+      run_chunk(c);
     }
     break;
   }
   case ParallelSchedule::kStatic: {
     if (sched.chunk == 0) {
+      // Contiguous ascending chunk ranges per thread, like schedule(static) over elements
 #pragma omp parallel for num_threads(thread_config.nthread) schedule(static)
-      for (OmpInd i = begin; i < end; ++i) {
-        exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
+      for (OmpInd c = 0; c < num_chunk; ++c) {
+        run_chunk(c);
       }
     } else {
-#pragma omp parallel for num_threads(thread_config.nthread) schedule(static, sched.chunk)
-      for (OmpInd i = begin; i < end; ++i) {
-        exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
+      // Round-robin the caller-sized chunks, like schedule(static, n) over elements
+#pragma omp parallel for num_threads(thread_config.nthread) schedule(static, 1)
+      for (OmpInd c = 0; c < num_chunk; ++c) {
+        run_chunk(c);
       }
     }
     break;
   }
   case ParallelSchedule::kGuided: {
 #pragma omp parallel for num_threads(thread_config.nthread) schedule(guided)
-    for (OmpInd i = begin; i < end; ++i) {
-      exc.Run(func, static_cast<IndexType>(i), omp_get_thread_num());
+    for (OmpInd c = 0; c < num_chunk; ++c) {
+      run_chunk(c);
     }
     break;
   }
+  case ParallelSchedule::kWorkStealing:
+    break;  // handled above
   }
   exc.Rethrow();
 }
@@ -22,6 +22,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
@@ -66,6 +67,44 @@ inline Tree<ThresholdType, LeafOutputType> Tree<ThresholdType, LeafOutputType>::
   return tree;
 }
 
+template <typename ThresholdType, typename LeafOutputType>
+inline Tree<ThresholdType, LeafOutputType> Tree<ThresholdType, LeafOutputType>::CreateView() {
+  Tree<ThresholdType, LeafOutputType> tree;
+
+  tree.num_nodes = num_nodes;
+
+  auto share = [](auto& dest, auto& src) { dest.UseForeignBuffer(src.Data(), src.Size()); };
+  share(tree.node_type_, node_type_);
+  share(tree.cleft_, cleft_);
+  share(tree.cright_, cright_);
+  share(tree.split_index_, split_index_);
+  share(tree.default_left_, default_left_);
+  share(tree.leaf_value_, leaf_value_);
+  share(tree.threshold_, threshold_);
+  share(tree.cmp_, cmp_);
+  share(tree.category_list_right_child_, category_list_right_child_);
+
+  share(tree.leaf_vector_, leaf_vector_);
+  share(tree.leaf_vector_begin_, leaf_vector_begin_);
+  share(tree.leaf_vector_end_, leaf_vector_end_);
+  share(tree.category_list_, category_list_);
+  share(tree.category_list_begin_, category_list_begin_);
+  share(tree.category_list_end_, category_list_end_);
+
+  share(tree.data_count_, data_count_);
+  share(tree.sum_hess_, sum_hess_);
+  share(tree.gain_, gain_);
+  share(tree.data_count_present_, data_count_present_);
+  share(tree.sum_hess_present_, sum_hess_present_);
+  share(tree.gain_present_, gain_present_);
+
+  tree.has_categorical_split_ = has_categorical_split_;
+  tree.num_opt_field_per_tree_ = num_opt_field_per_tree_;
+  tree.num_opt_field_per_node_ = num_opt_field_per_node_;
+
+  return tree;
+}
+
 template <typename ThresholdType, typename LeafOutputType>
 inline int Tree<ThresholdType, LeafOutputType>::AllocNode() {
   node_type_.PushBack(TreeNodeType::kLeafNode);
@@ -100,6 +139,75 @@ inline int Tree<ThresholdType, LeafOutputType>::AllocNode() {
   return num_nodes++;
 }
 
+template <typename ThresholdType, typename LeafOutputType>
+inline void Tree<ThresholdType, LeafOutputType>::AllocNodes(std::int32_t count) {
+  std::size_t const new_size = static_cast<std::size_t>(num_nodes) + count;
+  node_type_.Resize(new_size, TreeNodeType::kLeafNode);
+  cleft_.Resize(new_size, -1);
+  cright_.Resize(new_size, -1);
+  split_index_.Resize(new_size, -1);
+  default_left_.Resize(new_size, false);
+  leaf_value_.Resize(new_size, static_cast<LeafOutputType>(0));
+  threshold_.Resize(new_size, static_cast<ThresholdType>(0));
+  cmp_.Resize(new_size, Operator::kNone);
+  category_list_right_child_.Resize(new_size, false);
+
+  leaf_vector_begin_.Resize(new_size, leaf_vector_.Size());
+  leaf_vector_end_.Resize(new_size, leaf_vector_.Size());
+  category_list_begin_.Resize(new_size, category_list_.Size());
+  category_list_end_.Resize(new_size, category_list_.Size());
+
+  // Invariant: node stat array must either be empty or have exact length of [num_nodes]
+  if (!data_count_present_.Empty()) {
+    data_count_.Resize(new_size, 0);
+    data_count_present_.Resize(new_size, false);
+  }
+  if (!sum_hess_present_.Empty()) {
+    sum_hess_.Resize(new_size, 0);
+    sum_hess_present_.Resize(new_size, false);
+  }
+  if (!gain_present_.Empty()) {
+    gain_.Resize(new_size, 0);
+    gain_present_.Resize(new_size, false);
+  }
+
+  num_nodes += count;
+}
+
+template <typename ThresholdType, typename LeafOutputType>
+inline void Tree<ThresholdType, LeafOutputType>::ReserveNodes(std::size_t count) {
+  if (count <= static_cast<std::size_t>(num_nodes)) {
+    return;
+  }
+  node_type_.Reserve(count);
+  cleft_.Reserve(count);
+  cright_.Reserve(count);
+  split_index_.Reserve(count);
+  default_left_.Reserve(count);
+  leaf_value_.Reserve(count);
+  threshold_.Reserve(count);
+  cmp_.Reserve(count);
+  category_list_right_child_.Reserve(count);
+
+  leaf_vector_begin_.Reserve(count);
+  leaf_vector_end_.Reserve(count);
+  category_list_begin_.Reserve(count);
+  category_list_end_.Reserve(count);
+
+  if (!data_count_present_.Empty()) {
+    data_count_.Reserve(count);
+    data_count_present_.Reserve(count);
+  }
+  if (!sum_hess_present_.Empty()) {
+    sum_hess_.Reserve(count);
+    sum_hess_present_.Reserve(count);
+  }
+  if (!gain_present_.Empty()) {
+    gain_.Reserve(count);
+    gain_present_.Reserve(count);
+  }
+}
+
 template <typename ThresholdType, typename LeafOutputType>
 inline void Tree<ThresholdType, LeafOutputType>::Init() {
   node_type_.Clear();
@@ -208,6 +316,149 @@ inline void Tree<ThresholdType, LeafOutputType>::SetGain(int nid, double gain) {
   gain_present_.at(nid) = true;
 }
 
+template <typename ThresholdType, typename LeafOutputType>
+inline void Tree<ThresholdType, LeafOutputType>::ReorderBFS() {
+  // Nodes in breadth-first order; old_id[i] is the current ID of the node that moves to slot i.
+  // The root keeps ID 0, since the traversal starts there.
+  std::vector<std::int32_t> old_id;
+  old_id.reserve(num_nodes);
+  old_id.push_back(0);
+  for (std::size_t head = 0; head < old_id.size(); ++head) {
+    std::int32_t const nid = old_id[head];
+    if (cleft_[nid] != -1) {
+      old_id.push_back(cleft_[nid]);
+      old_id.push_back(cright_[nid]);
+    }
+  }
+  TREELITE_CHECK_EQ(old_id.size(), static_cast<std::size_t>(num_nodes))
+      << "Cannot reorder a tree with nodes that are unreachable from the root";
+  std::vector<std::int32_t> new_id(num_nodes);
+  for (std::int32_t i = 0; i < num_nodes; ++i) {
+    new_id[old_id[i]] = i;
+  }
+
+  auto permute = [&](auto& array) {
+    if (array.Empty()) {  // node stat arrays may be absent
+      return;
+    }
+    auto reordered = array.Clone();
+    for (std::int32_t i = 0; i < num_nodes; ++i) {
+      reordered[i] = array[old_id[i]];
+    }
+    array = std::move(reordered);
+  };
+  permute(node_type_);
+  permute(cleft_);
+  permute(cright_);
+  permute(split_index_);
+  permute(default_left_);
+  permute(leaf_value_);
+  permute(threshold_);
+  permute(cmp_);
+  permute(category_list_right_child_);
+  // The leaf vector and category list payloads stay put; the begin/end offsets travel
+  // with their nodes.
+  permute(leaf_vector_begin_);
+  permute(leaf_vector_end_);
+  permute(category_list_begin_);
+  permute(category_list_end_);
+  permute(data_count_);
+  permute(sum_hess_);
+  permute(gain_);
+  permute(data_count_present_);
+  permute(sum_hess_present_);
+  permute(gain_present_);
+
+  // Rewrite child indices to refer to the new node IDs
+  for (std::int32_t i = 0; i < num_nodes; ++i) {
+    if (cleft_[i] != -1) {
+      cleft_[i] = new_id[cleft_[i]];
+      cright_[i] = new_id[cright_[i]];
+    }
+  }
+}
+
+template <typename ThresholdType, typename LeafOutputType>
+inline MemoryFootprint Tree<ThresholdType, LeafOutputType>::GetMemoryFootprint() const {
+  auto nbytes = [](auto const& array) -> std::uint64_t {
+    return array.Size() * sizeof(*array.Data());
+  };
+  MemoryFootprint footprint;
+  footprint.node_structure = nbytes(node_type_) + nbytes(cleft_) + nbytes(cright_)
+                             + nbytes(split_index_) + nbytes(default_left_) + nbytes(cmp_)
+                             + nbytes(category_list_right_child_);
+  footprint.thresholds = nbytes(threshold_);
+  footprint.leaf_outputs = nbytes(leaf_value_) + nbytes(leaf_vector_) + nbytes(leaf_vector_begin_)
+                           + nbytes(leaf_vector_end_);
+  footprint.category_lists
+      = nbytes(category_list_) + nbytes(category_list_begin_) + nbytes(category_list_end_);
+  footprint.node_stats = nbytes(data_count_) + nbytes(data_count_present_) + nbytes(sum_hess_)
+                         + nbytes(sum_hess_present_) + nbytes(gain_) + nbytes(gain_present_);
+  footprint.total = footprint.node_structure + footprint.thresholds + footprint.leaf_outputs
+                    + footprint.category_lists + footprint.node_stats;
+  return footprint;
+}
+
+template <typename ThresholdType, typename LeafOutputType>
+inline TreeArrayViews Tree<ThresholdType, LeafOutputType>::GetArrayViews() const {
+  TreeArrayViews views;
+  views.num_nodes = num_nodes;
+  views.node_type = node_type_.Data();
+  views.cleft = cleft_.Data();
+  views.cright = cright_.Data();
+  views.split_index = split_index_.Data();
+  views.threshold = threshold_.Data();
+  views.leaf_value = leaf_value_.Data();
+  views.leaf_vector = leaf_vector_.Data();
+  views.leaf_vector_begin = leaf_vector_begin_.Data();
+  views.leaf_vector_end = leaf_vector_end_.Data();
+  // Statistics arrays are only allocated when the loader recorded at least one value
+  if (!data_count_.Empty()) {
+    views.data_count = data_count_.Data();
+  }
+  if (!sum_hess_.Empty()) {
+    views.sum_hess = sum_hess_.Data();
+  }
+  if (!gain_.Empty()) {
+    views.gain = gain_.Data();
+  }
+  return views;
+}
+
+inline TreeArrayViews Model::GetTreeArrayViews(std::uint64_t tree_id) const {
+  TREELITE_CHECK_LT(tree_id, GetNumTree()) << "tree_id out of range";
+  return std::visit(
+      [&](auto&& concrete_model) {
+        return concrete_model.trees[tree_id].GetArrayViews();
+      },
+      variant_);
+}
+
+inline MemoryFootprint Model::GetMemoryFootprint() const {
+  MemoryFootprint footprint;
+  std::visit(
+      [&](auto&& concrete_model) {
+        for (auto const& tree : concrete_model.trees) {
+          MemoryFootprint const tree_footprint = tree.GetMemoryFootprint();
+          footprint.node_structure += tree_footprint.node_structure;
+          footprint.thresholds += tree_footprint.thresholds;
+          footprint.leaf_outputs += tree_footprint.leaf_outputs;
+          footprint.category_lists += tree_footprint.category_lists;
+          footprint.node_stats += tree_footprint.node_stats;
+        }
+      },
+      variant_);
+  auto nbytes = [](auto const& array) -> std::uint64_t {
+    return array.Size() * sizeof(*array.Data());
+  };
+  footprint.metadata = nbytes(num_class) + nbytes(leaf_vector_shape) + nbytes(target_id)
+                       + nbytes(class_id) + nbytes(base_scores) + postprocessor.size()
+                       + attributes.size();
+  footprint.total = footprint.node_structure + footprint.thresholds + footprint.leaf_outputs
+                    + footprint.category_lists + footprint.node_stats + footprint.metadata;
+  return footprint;
+}
+
 template <typename ThresholdType, typename LeafOutputType>
 inline std::unique_ptr<Model> Model::Create() {
   std::unique_ptr<Model> model = std::make_unique<Model>();
@@ -226,5 +477,39 @@ inline std::unique_ptr<Model> Model::Create(TypeInfo threshold_type, TypeInfo le
   return model;
 }
 
+inline std::unique_ptr<Model> Model::Slice(std::size_t begin, std::size_t end) {
+  std::size_t const num_tree = GetNumTree();
+  TREELITE_CHECK_LE(begin, end) << "Invalid tree range [" << begin << ", " << end << ")";
+  TREELITE_CHECK_LE(end, num_tree) << "Tree range [" << begin << ", " << end
+                                   << ") is out of bounds; the model has " << num_tree << " trees";
+  std::unique_ptr<Model> sliced = Model::Create(GetThresholdType(), GetLeafOutputType());
+  sliced->num_feature = num_feature;
+  sliced->task_type = task_type;
+  sliced->average_tree_output = average_tree_output;
+  sliced->num_target = num_target;
+  sliced->num_class = num_class.Clone();
+  sliced->leaf_vector_shape = leaf_vector_shape.Clone();
+  for (std::size_t i = begin; i < end; ++i) {
+    sliced->target_id.PushBack(target_id[i]);
+    sliced->class_id.PushBack(class_id[i]);
+  }
+  sliced->postprocessor = postprocessor;
+  sliced->sigmoid_alpha = sigmoid_alpha;
+  sliced->ratio_c = ratio_c;
+  sliced->base_scores = base_scores.Clone();
+  sliced->attributes = attributes;
+  std::visit(
+      [&](auto&& concrete_model) {
+        using PresetT = std::remove_const_t<std::remove_reference_t<decltype(concrete_model)>>;
+        auto& sliced_inner = std::get<PresetT>(sliced->variant_);
+        sliced_inner.trees.reserve(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+          sliced_inner.trees.push_back(concrete_model.trees[i].CreateView());
+        }
+      },
+      variant_);
+  return sliced;
+}
+
 }  // namespace treelite
 #endif  // TREELITE_DETAIL_TREE_H_
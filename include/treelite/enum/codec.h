@@ -0,0 +1,27 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file codec.h
+ * \brief Defines enum type Codec
+ * \author Hyunsu Cho
+ */
+
+#ifndef TREELITE_ENUM_CODEC_H_
+#define TREELITE_ENUM_CODEC_H_
+
+#include <cstdint>
+#include <string>
+
+namespace treelite {
+
+/*! \brief Compression codecs available for model serialization */
+enum class Codec : std::uint8_t { kUncompressed = 0, kLZ4 = 1 };
+
+/*! \brief Get string representation of Codec */
+std::string CodecToString(Codec codec);
+
+/*! \brief Get Codec from string */
+Codec CodecFromString(std::string const& str);
+
+}  // namespace treelite
+
+#endif  // TREELITE_ENUM_CODEC_H_
@@ -11,6 +11,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -22,6 +25,10 @@ class Model;
 
 namespace gtil {
 
+struct CompiledModelImpl;
+struct NumaReplicatedModelImpl;
+struct PredictSessionImpl;
+
 /*! \brief Prediction type */
 enum class PredictKind : std::int8_t {
   /*!
@@ -50,25 +57,427 @@ enum class PredictKind : std::int8_t {
   kPredictPerTree = 3
 };
 
+/*! \brief Memory layout of a dense input matrix */
+enum class InputLayout : std::int8_t {
+  /*! \brief C order: the features of one row are contiguous */
+  kRowMajor = 0,
+  /*! \brief Fortran / Arrow order: the values of one feature column are contiguous */
+  kColMajor = 1
+};
+
+/*! \brief Placement policy for the prediction worker threads */
+enum class ThreadAffinity : std::int8_t {
+  /*! \brief Leave placement to the OS / OpenMP runtime (the default) */
+  kNone = 0,
+  /*! \brief Pack worker threads onto consecutive CPUs, starting at CPU 0 */
+  kCompact = 1,
+  /*! \brief Spread worker threads evenly over all CPUs */
+  kScatter = 2,
+  /*! \brief Pin worker thread i to affinity_cpu_list[i % affinity_cpu_list.size()] */
+  kExplicit = 3
+};
+
 /*! \brief Configuration class */
 struct Configuration {
   int nthread{0};  // use all threads by default
   PredictKind pred_kind{PredictKind::kPredictDefault};
+  /*!
+   * \brief Whether to use vectorized (SIMD) multi-row traversal kernels where available.
+   * Only has an effect when predicting with a CompiledModel; trees that cannot be
+   * vectorized fall back to the scalar kernel.
+   */
+  bool use_simd{false};
+  /*!
+   * \brief Whether to use the batch post-processor kernels, which substitute a vectorized
+   *        polynomial approximation for std::exp. Results may differ from the default
+   *        kernels by a few ulps.
+   */
+  bool use_fast_math{false};
+  /*!
+   * \brief Whether to run parallel loops on the persistent worker pool instead of opening
+   *        an OpenMP parallel region per loop. Reduces per-call overhead when many small
+   *        batches are served back to back. The pool is process-wide and runs one task at
+   *        a time: concurrent Predict calls using it are safe but serialize against each
+   *        other, unlike the OpenMP path, where each caller gets its own team.
+   */
+  bool use_thread_pool{false};
+  /*!
+   * \brief Whether to schedule the traversal row loop with work stealing. Helps when
+   *        per-row traversal cost is skewed (deep unbalanced trees), at the price of a
+   *        little synchronization; the default static schedule is best for uniform rows.
+   */
+  bool use_work_stealing{false};
+  /*!
+   * \brief Evaluate trees in stages of this many trees and retire rows whose partial raw
+   *        score has left (cascade_threshold_low, cascade_threshold_high) at a stage
+   *        boundary; 0 (the default) disables the cascade. Only available for "default"
+   *        and "raw" predictions with single-target, scalar-output models (e.g. binary
+   *        classifiers); other prediction types need every tree and ignore the setting.
+   *        A retired row keeps the partial score it had when it was retired, so the scores
+   *        of retired rows are approximate while the implied decisions are unchanged.
+   */
+  std::uint64_t cascade_stage_size{0};
+  /*! \brief Lower confidence threshold of the cascade, in the raw-score domain */
+  double cascade_threshold_low{-std::numeric_limits<double>::infinity()};
+  /*! \brief Upper confidence threshold of the cascade, in the raw-score domain */
+  double cascade_threshold_high{std::numeric_limits<double>::infinity()};
+  /*!
+   * \brief Where to place the worker threads. On hosts shared with other services, pinning
+   *        keeps worker threads from migrating between CPUs mid-batch and losing their
+   *        warmed caches. Pinning is sticky: it persists past the Predict call and covers
+   *        the calling thread as well, which participates as worker 0.
+   */
+  ThreadAffinity thread_affinity{ThreadAffinity::kNone};
+  /*! \brief CPU IDs to pin to, for ThreadAffinity::kExplicit */
+  std::vector<int> affinity_cpu_list{};
   Configuration() = default;
   explicit Configuration(std::string const& config_json);
 };
 
+/*!
+ * \brief A model compiled for fast inference. Each tree is flattened into a contiguous array
+ *        of packed node records, so that a node visit touches a single cache line instead of
+ *        ~9 separate arrays. Compiling has a one-time cost proportional to the model size;
+ *        use it when the same model will be used to predict for many batches.
+ *
+ * The source model must outlive the compiled model.
+ *
+ * When quantize is set, a quantized representation is also built: the distinct thresholds of
+ * each feature become its bin boundaries, thresholds are replaced with 16-bit bin ranks, and
+ * each input row is binned once per batch, shrinking the traversal working set for models
+ * with 8-byte thresholds. Predictions are unchanged. Trees with categorical tests fall back
+ * to the full-precision records.
+ *
+ * When compact is set, node records additionally shrink to a half-width encoding: 16-bit
+ * split index word and 16-bit relative child offsets, doubling the number of nodes per cache
+ * line. The encoding is validated per tree against the actual node records; trees that do
+ * not fit (categorical tests, leaf vectors, >= 4096 features, child offsets beyond int16)
+ * keep the full-width records. Predictions are unchanged.
+ *
+ * When reduced_precision_leaf is set, leaf vectors are stored as bfloat16 and decoded to
+ * float on accumulation, cutting the leaf-array working set by 2x (float models) or 4x
+ * (double models). For multiclass forests the leaf vectors dominate model memory, so this
+ * directly helps bandwidth-bound batch jobs. Each stored leaf value is rounded to 8 bits
+ * of mantissa, so predictions differ slightly from the full-precision model; scalar leaf
+ * outputs live inside the node records and are unaffected.
+ *
+ * When deduplicate is set, structurally identical subtrees — identical split, threshold,
+ * and leaf chains — are stored once in an ensemble-wide node pool instead of once per tree
+ * that grew them, reclaiming the node memory (and cache space) that boosted models spend
+ * on repeated shallow subtrees. Predictions are unchanged. The pass applies to purely
+ * numerical trees with scalar leaf outputs; deduplicated trees traverse the shared pool
+ * and give up the quantized, compact, branchless, and fixed-depth kernels, so prefer this
+ * flag when memory is the constraint rather than per-row latency.
+ */
+class CompiledModel {
+ public:
+  explicit CompiledModel(Model const& model, bool quantize = false, bool compact = false,
+      bool reduced_precision_leaf = false, bool deduplicate = false);
+  ~CompiledModel();
+  CompiledModel(CompiledModel const&) = delete;
+  CompiledModel& operator=(CompiledModel const&) = delete;
+  CompiledModel(CompiledModel&&) noexcept;
+  CompiledModel& operator=(CompiledModel&&) noexcept;
+
+  /*! \brief Access the model this object was compiled from */
+  Model const& GetSourceModel() const;
+  /*! \brief Access the internal state (for use by the GTIL engine only) */
+  CompiledModelImpl const& Impl() const {
+    return *impl_;
+  }
+
+ private:
+  std::unique_ptr<CompiledModelImpl> impl_;
+};
+
+/*!
+ * \brief A model replicated across the NUMA nodes of the host, for multi-socket scoring.
+ *        With a single model copy, the row-parallel traversal loop has every thread reading
+ *        one socket's DRAM and remote-node hits cap throughput. Construction clones the
+ *        (read-only) tree arrays once per NUMA node, each clone allocated by a thread
+ *        pinned to its node so the first-touch policy places it in local memory; during
+ *        prediction each thread traverses the replica local to the CPU it runs on.
+ *        Predictions are unchanged. On single-node hosts no replica is made and prediction
+ *        uses the source model directly. Pinning prediction threads to their sockets (e.g.
+ *        with OMP_PROC_BIND=true OMP_PLACES=sockets) keeps the routing stable.
+ *
+ * The source model must outlive this object.
+ */
+class NumaReplicatedModel {
+ public:
+  explicit NumaReplicatedModel(Model const& model);
+  ~NumaReplicatedModel();
+  NumaReplicatedModel(NumaReplicatedModel const&) = delete;
+  NumaReplicatedModel& operator=(NumaReplicatedModel const&) = delete;
+  NumaReplicatedModel(NumaReplicatedModel&&) noexcept;
+  NumaReplicatedModel& operator=(NumaReplicatedModel&&) noexcept;
+
+  /*! \brief Access the model this object replicated */
+  Model const& GetSourceModel() const;
+  /*! \brief Number of NUMA nodes detected on the host */
+  int GetNumNode() const;
+  /*! \brief Access the internal state (for use by the GTIL engine only) */
+  NumaReplicatedModelImpl const& Impl() const {
+    return *impl_;
+  }
+
+ private:
+  std::unique_ptr<NumaReplicatedModelImpl> impl_;
+};
+
+/*!
+ * \brief A read-only view of a sparse matrix in CSR (compressed sparse row) format.
+ * Features that are not stored in a row are treated as missing values, so callers with
+ * sparse inputs need not materialize dense rows full of NaNs.
+ */
+template <typename InputT>
+struct CSRView {
+  /*! \brief Stored entries, of length row_ptr[num_row] */
+  InputT const* data;
+  /*! \brief Feature index of each stored entry */
+  std::uint64_t const* col_ind;
+  /*! \brief Offsets into data / col_ind delimiting each row; has (num_row + 1) elements */
+  std::uint64_t const* row_ptr;
+  /*! \brief Number of rows */
+  std::uint64_t num_row;
+};
+
+/*!
+ * \brief A reusable prediction session, resolving all per-call setup once for a given
+ *        model + configuration pair: input type validation, thread configuration, output
+ *        layout, post-processor lookup, and tree-averaging divisors. Use it when issuing
+ *        many (small) batches against the same model, where the fixed per-call overhead
+ *        of Predict() matters; steady-state calls perform no heap allocations.
+ *
+ * The model must outlive the session.
+ */
+class PredictSession {
+ public:
+  PredictSession(Model const& model, Configuration const& config);
+  ~PredictSession();
+  PredictSession(PredictSession const&) = delete;
+  PredictSession& operator=(PredictSession const&) = delete;
+  PredictSession(PredictSession&&) noexcept;
+  PredictSession& operator=(PredictSession&&) noexcept;
+
+  /*!
+   * \brief Predict for a batch, with the cached setup. The input type must match the
+   *        model's leaf output type (validated once, at session creation).
+   */
+  template <typename InputT>
+  void Predict(InputT const* input, std::uint64_t num_row, InputT* output) const;
+  /*! \brief Query the output shape for a batch with num_row rows */
+  std::vector<std::uint64_t> GetOutputShape(std::uint64_t num_row) const;
+
+ private:
+  std::unique_ptr<PredictSessionImpl> impl_;
+};
+
+/*!
+ * \brief Aggregate traversal statistics for one Predict call, collected on request. The
+ *        counters explain where traversal time goes: average depth is
+ *        num_node_visit / num_tree_traversal, and the missing-value and categorical shares
+ *        follow likewise. Collection adds a few counter increments per node visit; the
+ *        regular Predict calls carry no overhead, as the instrumentation is compiled
+ *        separately.
+ */
+struct PredictionStats {
+  /*! \brief Number of rows predicted */
+  std::uint64_t num_row{0};
+  /*! \brief Number of (row, tree) traversals, i.e. num_row * number of trees */
+  std::uint64_t num_tree_traversal{0};
+  /*! \brief Total number of test nodes visited, i.e. total depth traversed */
+  std::uint64_t num_node_visit{0};
+  /*! \brief Node visits that took the default (missing-value) child */
+  std::uint64_t num_missing_branch{0};
+  /*! \brief Node visits to categorical test nodes */
+  std::uint64_t num_categorical_visit{0};
+  /*! \brief Number of node visits attributed to each tree */
+  std::vector<std::uint64_t> node_visit_per_tree{};
+};
+
+/*!
+ * \brief Predict with a 2D dense array. The output type must match the model's leaf output
+ *        type. The input type must match as well, with one mixed-precision exception:
+ *        float32 input rows may be passed against a float64 model, in which case thresholds
+ *        are compared against the float input directly and leaf outputs accumulate in
+ *        double, so float32 feature pipelines need not up-convert their rows.
+ */
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint64_t num_row, OutputT* output,
+    Configuration const& config);
+
+/*!
+ * \brief Predict with a 2D dense array and an Arrow-style validity bitmap: one bit per
+ *        cell in row-major order, least-significant bit first (cell k maps to bit k % 8 of
+ *        byte k / 8), with a set bit marking the cell valid. Cells under a cleared bit are
+ *        treated as missing regardless of their payload, so feature pipelines that track
+ *        missingness out of band need not write NaN into the value buffer. Passing nullptr
+ *        for the bitmap asserts that every cell is valid and dispatches traversal kernels
+ *        with the per-node missing-value check compiled out; feeding NaN under that
+ *        guarantee yields unspecified (but memory-safe) predictions.
+ */
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint8_t const* validity,
+    std::uint64_t num_row, OutputT* output, Configuration const& config);
+
+/*!
+ * \brief Predict with an explicit input layout. Column-major (columnar, e.g. Arrow) batches
+ *        are consumed in place — rows become strided slices of the feature columns — so no
+ *        transpose is needed before predicting. The output layout is unchanged.
+ */
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, InputLayout layout, std::uint64_t num_row,
+    OutputT* output, Configuration const& config);
+
+/*!
+ * \brief Predict with a strided 2D dense array, so rows embedded in larger fixed-stride
+ *        records (e.g. wire-format buffers with features at a known offset) can be scored
+ *        in place, without a compacting copy. row_stride is the distance between the first
+ *        features of consecutive rows and elem_stride the distance between consecutive
+ *        features within a row, both counted in elements of InputT. A contiguous row-major
+ *        matrix corresponds to (row_stride = num_feature, elem_stride = 1) and a
+ *        column-major one to (row_stride = 1, elem_stride = num_row). The output layout is
+ *        unchanged.
+ */
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint64_t num_row,
+    std::uint64_t row_stride, std::uint64_t elem_stride, OutputT* output,
+    Configuration const& config);
+
+/*!
+ * \brief Predict as above, while collecting traversal statistics into *stats. Statistics
+ *        are collected for the default and raw prediction kinds; the other kinds predict
+ *        normally and report zero counters.
+ */
 template <typename InputT>
 void Predict(Model const& model, InputT const* input, std::uint64_t num_row, InputT* output,
+    Configuration const& config, PredictionStats* stats);
+
+template <typename InputT>
+void Predict(CompiledModel const& compiled_model, InputT const* input, std::uint64_t num_row,
+    InputT* output, Configuration const& config);
+
+/*!
+ * \brief Predict against a NUMA-replicated model: the default and raw prediction kinds
+ *        route each thread to its node-local replica; the other kinds read little tree data
+ *        per row and use the source model directly.
+ */
+template <typename InputT, typename OutputT>
+void Predict(NumaReplicatedModel const& replicated_model, InputT const* input,
+    std::uint64_t num_row, OutputT* output, Configuration const& config);
+
+template <typename InputT>
+void Predict(Model const& model, CSRView<InputT> input, InputT* output,
     Configuration const& config);
 
+/*!
+ * \brief Score one input batch against several models in a single row-parallel pass, e.g.
+ *        for A/B shadows or cascaded ensembles. Each row block is read once and fed to
+ *        every model's tree loop while it is cache resident, so the input matrix streams
+ *        from memory once instead of once per model. All models must consume the same
+ *        feature set, and outputs must hold one buffer per model, each sized per
+ *        GetOutputShape for that model. The default and raw prediction kinds take the fused
+ *        pass; the remaining kinds read little input per row and score independently.
+ */
+template <typename InputT, typename OutputT>
+void PredictMulti(std::vector<Model const*> const& models, InputT const* input,
+    std::uint64_t num_row, std::vector<OutputT*> const& outputs, Configuration const& config);
+
+/*!
+ * \brief Predict one leaf ID per tree, with integer-typed output. Unlike predicting with
+ *        kPredictLeafID, the IDs are written as std::int32_t directly, avoiding the
+ *        int-to-float conversion and halving the output footprint for double-precision
+ *        models. Output dimensions: (num_row, num_tree).
+ */
+template <typename InputT>
+void PredictLeaf(Model const& model, InputT const* input, std::uint64_t num_row,
+    std::int32_t* output, Configuration const& config);
+
 std::vector<std::uint64_t> GetOutputShape(
     Model const& model, std::uint64_t num_row, Configuration const& config);
 
+/*!
+ * \brief Warm up a model before serving traffic: pre-fault the memory backing it (see
+ *        \ref Model::Warmup) and run one block of synthetic rows through the configured
+ *        prediction path, so the traversal loops, the thread pool, and the post-processor
+ *        tables are hot before the first real request. Call after loading, before the load
+ *        balancer sends traffic.
+ */
+void Warmup(Model const& model, Configuration const& config);
+
+/*!
+ * \brief Produce up to max_rows input rows into buffer (row-major, num_feature columns per
+ *        row). Returns the number of rows produced; 0 signals the end of the stream.
+ */
+template <typename InputT>
+using ChunkReadFunc = std::function<std::uint64_t(InputT* buffer, std::uint64_t max_rows)>;
+/*! \brief Receive the predictions for one chunk of num_row rows */
+template <typename InputT>
+using ChunkWriteFunc = std::function<void(InputT const* output, std::uint64_t num_row)>;
+
+/*!
+ * \brief Predict over a stream of input chunks, for inputs too large to hold in memory.
+ *        Chunks are double-buffered: while one chunk is being traversed, the next is read
+ *        and the previous predictions are written back on a background thread, so input
+ *        materialization, traversal, and write-back overlap. The reader is called until it
+ *        returns 0; the writer receives chunks in order, with the output laid out as
+ *        GetOutputShape(model, num_row) for each chunk's num_row.
+ */
+template <typename InputT>
+void PredictStream(Model const& model, ChunkReadFunc<InputT> reader, ChunkWriteFunc<InputT> writer,
+    std::uint64_t chunk_rows, Configuration const& config);
+
 extern template void Predict<float>(
     Model const&, float const*, std::uint64_t, float*, Configuration const&);
 extern template void Predict<double>(
     Model const&, double const*, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float, double>(
+    Model const&, float const*, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float>(Model const&, float const*, std::uint8_t const*,
+    std::uint64_t, float*, Configuration const&);
+extern template void Predict<double>(Model const&, double const*, std::uint8_t const*,
+    std::uint64_t, double*, Configuration const&);
+extern template void Predict<float, double>(Model const&, float const*, std::uint8_t const*,
+    std::uint64_t, double*, Configuration const&);
+extern template void Predict<float>(
+    Model const&, float const*, InputLayout, std::uint64_t, float*, Configuration const&);
+extern template void Predict<double>(
+    Model const&, double const*, InputLayout, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float, double>(
+    Model const&, float const*, InputLayout, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float>(Model const&, float const*, std::uint64_t, std::uint64_t,
+    std::uint64_t, float*, Configuration const&);
+extern template void Predict<double>(Model const&, double const*, std::uint64_t, std::uint64_t,
+    std::uint64_t, double*, Configuration const&);
+extern template void Predict<float, double>(Model const&, float const*, std::uint64_t,
+    std::uint64_t, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float>(
+    Model const&, float const*, std::uint64_t, float*, Configuration const&, PredictionStats*);
+extern template void Predict<double>(
+    Model const&, double const*, std::uint64_t, double*, Configuration const&, PredictionStats*);
+extern template void Predict<float>(
+    CompiledModel const&, float const*, std::uint64_t, float*, Configuration const&);
+extern template void Predict<double>(
+    CompiledModel const&, double const*, std::uint64_t, double*, Configuration const&);
+extern template void Predict<float>(Model const&, CSRView<float>, float*, Configuration const&);
+extern template void Predict<double>(Model const&, CSRView<double>, double*, Configuration const&);
+extern template void PredictMulti<float>(std::vector<Model const*> const&, float const*,
+    std::uint64_t, std::vector<float*> const&, Configuration const&);
+extern template void PredictMulti<double>(std::vector<Model const*> const&, double const*,
+    std::uint64_t, std::vector<double*> const&, Configuration const&);
+extern template void PredictMulti<float, double>(std::vector<Model const*> const&, float const*,
+    std::uint64_t, std::vector<double*> const&, Configuration const&);
+extern template void PredictLeaf<float>(
+    Model const&, float const*, std::uint64_t, std::int32_t*, Configuration const&);
+extern template void PredictLeaf<double>(
+    Model const&, double const*, std::uint64_t, std::int32_t*, Configuration const&);
+extern template void PredictSession::Predict<float>(float const*, std::uint64_t, float*) const;
+extern template void PredictSession::Predict<double>(double const*, std::uint64_t, double*) const;
+extern template void PredictStream<float>(
+    Model const&, ChunkReadFunc<float>, ChunkWriteFunc<float>, std::uint64_t, Configuration const&);
+extern template void PredictStream<double>(Model const&, ChunkReadFunc<double>,
+    ChunkWriteFunc<double>, std::uint64_t, Configuration const&);
 
 }  // namespace gtil
 }  // namespace treelite
@@ -14,6 +14,7 @@
 #include <treelite/enum/typeinfo.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -43,10 +44,51 @@ class ModelBuilder {
    * \brief Start a new tree
    */
   virtual void StartTree() = 0;
+  /*!
+   * \brief Start a new tree, with a hint for the number of nodes it will contain. The hint
+   *        is used to reserve every per-node array once up front, avoiding repeated buffer
+   *        growth as nodes are added. The hint need not be exact.
+   * \param expected_num_nodes Expected number of nodes in the tree
+   */
+  virtual void StartTree(std::size_t expected_num_nodes) = 0;
   /*!
    * \brief End the current tree
    */
   virtual void EndTree() = 0;
+  /*!
+   * \brief Provide a hint for the total number of nodes over all trees in the model.
+   *        Trees started without a per-tree hint (StartTree() with no argument) will each
+   *        reserve [total node count] / [number of trees] nodes up front. The hint need
+   *        not be exact. Requires the metadata to have been initialized.
+   * \param total_num_nodes Expected total number of nodes over all trees
+   */
+  virtual void TotalNodeCountHint(std::size_t total_num_nodes) = 0;
+
+  /*!
+   * \brief Ingest a whole tree at once from per-node arrays, as a fast alternative to the
+   *        per-node protocol (StartTree() / StartNode() / ... / EndNode() / EndTree()).
+   *        Nodes are identified by their position in the arrays: element i of each array
+   *        describes node i, and node 0 is the root. A node is a leaf if its left child
+   *        is -1. This is the same columnar layout that trees are stored in internally, so
+   *        the whole tree is validated and ingested in a single pass, with no per-node call
+   *        overhead or incremental reallocation.
+   * \param num_nodes Number of nodes in the tree
+   * \param left_child Index of each node's left child; -1 for leaf nodes
+   * \param right_child Index of each node's right child; -1 for leaf nodes
+   * \param split_index Feature ID of each test node; ignored for leaf nodes
+   * \param threshold Threshold of each test node; ignored for leaf nodes
+   * \param default_left Whether each test node maps missing values to its left child;
+   *                     ignored for leaf nodes
+   * \param cmp Comparison operator, shared by all test nodes in the tree
+   * \param leaf_value Leaf outputs; either num_nodes values (scalar leaf output) or
+   *                   num_nodes * [leaf vector length] values in row-major order (vector
+   *                   leaf output). Entries for test nodes are ignored.
+   */
+  virtual void BulkTree(std::int32_t num_nodes, std::vector<std::int32_t> const& left_child,
+      std::vector<std::int32_t> const& right_child, std::vector<std::int32_t> const& split_index,
+      std::vector<double> const& threshold, std::vector<bool> const& default_left, Operator cmp,
+      std::vector<double> const& leaf_value)
+      = 0;
 
   /*!
    * \brief Start a new node
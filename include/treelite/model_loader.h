@@ -53,6 +53,25 @@ std::unique_ptr<treelite::Model> LoadXGBoostModel(
  */
 std::unique_ptr<treelite::Model> LoadXGBoostModelFromString(
     char const* json_str, std::size_t length, char const* config_json);
+/*!
+ * \brief Load a model file generated by XGBoost (dmlc/xgboost), stored in the UBJSON format.
+ * \param filename Name of model file
+ * \param config_json JSON string consisting of key-value pairs; used for configuring the model
+ *                    parser
+ * \return Loaded model
+ */
+std::unique_ptr<treelite::Model> LoadXGBoostModelUBJSON(
+    std::string const& filename, char const* config_json);
+/*!
+ * \brief Load an XGBoost model from a UBJSON byte sequence
+ * \param ubjson_str UBJSON char array
+ * \param length Length of UBJSON char array
+ * \param config_json JSON string consisting of key-value pairs; used for configuring the model
+ *                    parser
+ * \return Loaded model
+ */
+std::unique_ptr<treelite::Model> LoadXGBoostModelFromUBJSONString(
+    char const* ubjson_str, std::size_t length, char const* config_json);
 /*!
  * \brief load a model file generated by LightGBM (Microsoft/LightGBM). The
  *        model file must contain a decision tree ensemble.
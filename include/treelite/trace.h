@@ -0,0 +1,80 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file trace.h
+ * \brief Lightweight phase-level tracing. Scoped timers placed around the phases of
+ *        prediction, model loading, and serialization accumulate into a per-thread report
+ *        that can be queried after a call, so a slow batch can be attributed to traversal,
+ *        averaging, post-processing, etc. without rebuilding with profiler annotations.
+ *        Tracing is off by default and a disabled scope costs a single relaxed atomic load;
+ *        compiling with TREELITE_DISABLE_TRACING removes the scopes entirely.
+ * \author Hyunsu Cho
+ */
+#ifndef TREELITE_TRACE_H_
+#define TREELITE_TRACE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace treelite::trace {
+
+/*! \brief Accumulated statistics of one phase */
+struct PhaseStat {
+  /*! \brief Phase label, e.g. "gtil::traversal" */
+  std::string phase;
+  /*! \brief Number of times the phase was entered */
+  std::uint64_t num_invocation{0};
+  /*! \brief Total wall time spent in the phase, in seconds */
+  double total_sec{0.0};
+};
+
+/*! \brief Turn tracing on or off globally. Off by default. */
+void EnableTracing(bool enable);
+/*! \brief Whether tracing is currently enabled */
+bool TracingEnabled();
+/*! \brief Discard the report accumulated on the calling thread. Traced top-level
+ *         operations (Predict, model loading, serialization) call this on entry, so the
+ *         report read afterwards is the breakdown of the last call. */
+void NewReport();
+/*!
+ * \brief Fetch the phase breakdown accumulated on the calling thread since the last
+ *        NewReport(). Phases appear in first-entered order.
+ */
+std::vector<PhaseStat> GetReport();
+
+/*! \brief Start a fresh per-call report if tracing is on; placed at the top of traced
+ *         top-level operations */
+inline void BeginCall() {
+  if (TracingEnabled()) {
+    NewReport();
+  }
+}
+
+/*! \brief RAII timer adding the lifetime of the scope to the named phase.
+ *         Use via TREELITE_TRACE_SCOPE. */
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(char const* phase);
+  ~ScopedTimer();
+  ScopedTimer(ScopedTimer const&) = delete;
+  ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+ private:
+  char const* phase_;
+  bool active_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace treelite::trace
+
+#if defined(TREELITE_DISABLE_TRACING)
+#define TREELITE_TRACE_SCOPE(phase)
+#else
+#define TREELITE_TRACE_CONCAT_IMPL(a, b) a##b
+#define TREELITE_TRACE_CONCAT(a, b) TREELITE_TRACE_CONCAT_IMPL(a, b)
+#define TREELITE_TRACE_SCOPE(phase) \
+  ::treelite::trace::ScopedTimer TREELITE_TRACE_CONCAT(treelite_trace_scope_, __LINE__) { phase }
+#endif  // defined(TREELITE_DISABLE_TRACING)
+
+#endif  // TREELITE_TRACE_H_
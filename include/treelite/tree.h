@@ -8,6 +8,7 @@
 #define TREELITE_TREE_H_
 
 #include <treelite/contiguous_array.h>
+#include <treelite/enum/codec.h>
 #include <treelite/enum/operator.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/tree_node_type.h>
@@ -47,6 +48,14 @@ class Deserializer;
 
 }  // namespace treelite::detail::serializer
 
+namespace treelite::detail {
+
+class Arena;
+class MappedFile;
+class SharedMemoryRegion;
+
+}  // namespace treelite::detail
+
 namespace treelite {
 
 // Used for returning version triple from a Model object
@@ -56,6 +65,74 @@ struct Version {
   std::int32_t patch_ver;
 };
 
+/*!
+ * \brief Resident memory footprint of a model (or a single tree), in bytes, broken down by
+ *        component, for capacity planning. Each figure counts the elements actually stored
+ *        in the corresponding arrays; allocator slack and fixed-size object headers are not
+ *        counted.
+ */
+struct MemoryFootprint {
+  /*! \brief Node structure: node types, child indices, split indices, flags, operators */
+  std::uint64_t node_structure{0};
+  /*! \brief Split thresholds */
+  std::uint64_t thresholds{0};
+  /*! \brief Leaf outputs: scalar leaf values and leaf vectors, with their offset arrays */
+  std::uint64_t leaf_outputs{0};
+  /*! \brief Category lists of categorical test nodes, with their offset arrays */
+  std::uint64_t category_lists{0};
+  /*!
+   * \brief Node statistics: data counts, sums of Hessians, gains, and their presence flags.
+   *        Inference does not read these; they can be dropped at load time (see
+   *        \ref Model::DeserializeFromStream).
+   */
+  std::uint64_t node_stats{0};
+  /*! \brief Model-level metadata: task arrays, base scores, and strings */
+  std::uint64_t metadata{0};
+  /*! \brief Sum of all components */
+  std::uint64_t total{0};
+};
+
+/*!
+ * \brief Read-only pointers into one tree's node arrays, for bulk zero-copy introspection
+ *        (see \ref Model::GetTreeArrayViews). Tooling that only needs thresholds, child
+ *        indices, or gains can read the arrays directly instead of round-tripping the
+ *        model through \ref Model::DumpAsJSON.
+ *
+ * All node-indexed arrays have num_nodes elements. threshold and leaf_value point to
+ * elements of the model's threshold / leaf output type (query
+ * \ref Model::GetThresholdType). A node's leaf vector, if any, occupies elements
+ * [leaf_vector_begin[nid], leaf_vector_end[nid]) of leaf_vector. The node-statistics
+ * pointers are null when the loader recorded no values for the field; where a value is
+ * present for some nodes only, the slots of the other nodes are unspecified. The pointers
+ * borrow the tree's storage: they are valid while the model is alive and unmodified.
+ */
+struct TreeArrayViews {
+  /*! \brief Number of nodes in the tree */
+  std::int32_t num_nodes{0};
+  /*! \brief Node type of each node */
+  TreeNodeType const* node_type{nullptr};
+  /*! \brief ID of each node's left child; -1 for a leaf */
+  std::int32_t const* cleft{nullptr};
+  /*! \brief ID of each node's right child; -1 for a leaf */
+  std::int32_t const* cright{nullptr};
+  /*! \brief Feature index of each test node */
+  std::int32_t const* split_index{nullptr};
+  /*! \brief Split threshold of each numerical test node */
+  void const* threshold{nullptr};
+  /*! \brief Scalar output of each leaf node */
+  void const* leaf_value{nullptr};
+  /*! \brief Concatenated leaf vectors, delimited by leaf_vector_begin / leaf_vector_end */
+  void const* leaf_vector{nullptr};
+  std::uint64_t const* leaf_vector_begin{nullptr};
+  std::uint64_t const* leaf_vector_end{nullptr};
+  /*! \brief Number of training data points that passed through each node; null when absent */
+  std::uint64_t const* data_count{nullptr};
+  /*! \brief Sum of Hessians of the training data points at each node; null when absent */
+  double const* sum_hess{nullptr};
+  /*! \brief Loss reduction (gain) of each test node's split; null when absent */
+  double const* gain{nullptr};
+};
+
 /*! \brief in-memory representation of a decision tree */
 template <typename ThresholdType, typename LeafOutputType>
 class Tree {
@@ -75,6 +152,12 @@ class Tree {
   Tree& operator=(Tree&&) noexcept = default;
 
   inline Tree<ThresholdType, LeafOutputType> Clone() const;
+  /*!
+   * \brief Create a lightweight view of this tree that shares its node storage instead of
+   *        copying it. The view reads the same arrays as this tree; this tree must outlive
+   *        the view and must not be modified while the view is in use.
+   */
+  inline Tree<ThresholdType, LeafOutputType> CreateView();
 
  private:
   ContiguousArray<TreeNodeType> node_type_;
@@ -116,6 +199,9 @@ class Tree {
   template <typename WriterType, typename X, typename Y>
   friend void DumpTreeAsJSON(WriterType& writer, Tree<X, Y> const& tree);
 
+  template <typename X, typename Y>
+  friend void WarmupTree(Tree<X, Y> const& tree, unsigned char& sink);
+
   template <typename MixIn>
   friend class detail::serializer::Serializer;
   template <typename MixIn>
@@ -128,6 +214,20 @@ class Tree {
   inline void Init();
   /*! \brief Allocate a new node and return the node's ID */
   inline int AllocNode();
+  /*!
+   * \brief Allocate a contiguous range of new nodes at once, resizing each node array a single
+   *        time instead of growing it node by node. All new nodes are initialized as leaf nodes,
+   *        exactly as if AllocNode() had been called count times.
+   * \param count Number of nodes to allocate
+   */
+  inline void AllocNodes(std::int32_t count);
+  /*!
+   * \brief Reserve capacity for the given number of nodes, so that subsequent AllocNode()
+   *        calls up to that count do not need to reallocate any node array. The count is a
+   *        hint and need not be exact.
+   * \param count Expected number of nodes
+   */
+  inline void ReserveNodes(std::size_t count);
 
   /** Getters **/
   /*!
@@ -194,6 +294,21 @@ class Tree {
     // Use unsafe access here, since we may need to take the address of one past the last
     // element, to follow with the range semantic of std::vector<>.
   }
+  /*!
+   * \brief Get leaf vector of the leaf node without copying, as a pointer and length into
+   *        the internal storage. The view stays valid until the tree is modified.
+   *        Intended for the prediction hot path; use LeafVector() when a copy is wanted.
+   * \param nid ID of node being queried
+   */
+  inline std::pair<LeafOutputType const*, std::size_t> LeafVectorSpan(int nid) const {
+    std::size_t const offset_begin = leaf_vector_begin_[nid];
+    std::size_t const offset_end = leaf_vector_end_[nid];
+    if (offset_begin >= leaf_vector_.Size() || offset_end > leaf_vector_.Size()) {
+      // Empty span, to indicate the lack of leaf vector
+      return {nullptr, 0};
+    }
+    return {leaf_vector_.Data() + offset_begin, offset_end - offset_begin};
+  }
   /*!
    * \brief Tests whether the leaf node has a non-empty leaf vector
    * \param nid ID of node being queried
@@ -236,6 +351,21 @@ class Tree {
     // Use unsafe access here, since we may need to take the address of one past the last
     // element, to follow with the range semantic of std::vector<>.
   }
+  /*!
+   * \brief Get the category list of the test node without copying, as a pointer and length
+   *        into the internal storage. The view stays valid until the tree is modified.
+   *        Intended for the prediction hot path; use CategoryList() when a copy is wanted.
+   * \param nid ID of node being queried
+   */
+  inline std::pair<std::uint32_t const*, std::size_t> CategoryListSpan(int nid) const {
+    std::size_t const offset_begin = category_list_begin_[nid];
+    std::size_t const offset_end = category_list_end_[nid];
+    if (offset_begin >= category_list_.Size() || offset_end > category_list_.Size()) {
+      // Empty span; the node might be a numerical split
+      return {nullptr, 0};
+    }
+    return {category_list_.Data() + offset_begin, offset_end - offset_begin};
+  }
   /*!
    * \brief Get the type of a node
    * \param nid ID of node being queried
@@ -301,6 +431,16 @@ class Tree {
   inline bool HasCategoricalSplit() const {
     return has_categorical_split_;
   }
+  /*!
+   * \brief Compute the resident memory footprint of this tree, broken down by component.
+   *        The metadata component is always zero for a single tree.
+   */
+  inline MemoryFootprint GetMemoryFootprint() const;
+  /*!
+   * \brief Get read-only pointers into this tree's node arrays, for bulk zero-copy
+   *        introspection. See \ref TreeArrayViews for the lifetime contract.
+   */
+  inline TreeArrayViews GetArrayViews() const;
 
   /** Setters **/
   /*!
@@ -368,6 +508,11 @@ class Tree {
    * \param gain Gain value
    */
   inline void SetGain(int nid, double gain);
+  /*!
+   * \brief Permute the per-node arrays into breadth-first order, rewriting child indices
+   *        accordingly. Only the storage layout changes; the tree computes the same function.
+   */
+  inline void ReorderBFS();
 };
 
 /*! \brief Typed portion of the model class */
@@ -450,6 +595,34 @@ class Model {
   inline void SetTreeLimit(std::size_t limit) {
     std::visit([=](auto&& inner) { return inner.SetTreeLimit(limit); }, variant_);
   }
+  /*!
+   * \brief Create a lightweight model over the tree range [begin, end) that shares tree
+   *        storage with this model instead of cloning it. The slice is a complete Model
+   *        (accepted by gtil::Predict and the C API), so a multi-stage cascade can hold
+   *        one copy of the ensemble and serve each stage from a slice. This model must
+   *        outlive every slice taken from it and must not be modified while any slice is
+   *        in use. Use \ref ConcatenateModelObjects with clones when an independent copy
+   *        is wanted instead.
+   * \param begin Index of the first tree in the slice
+   * \param end One past the index of the last tree in the slice
+   * \return Model viewing trees [begin, end) of this model
+   */
+  inline std::unique_ptr<Model> Slice(std::size_t begin, std::size_t end);
+  /*!
+   * \brief Reorder the nodes of every tree into breadth-first order, so that the top levels
+   *        of each tree occupy contiguous memory. Every row visits the top levels, so applying
+   *        this pass once after loading cuts cache misses for subsequent gtil::Predict calls.
+   *        Predictions are unchanged; only node IDs (as reported by kPredictLeafID) differ.
+   */
+  inline void OptimizeLayout() {
+    std::visit(
+        [](auto&& inner) {
+          for (auto& tree : inner.trees) {
+            tree.ReorderBFS();
+          }
+        },
+        variant_);
+  }
   void DumpAsJSON(std::ostream& fo, bool pretty_print) const;
 
   inline std::string DumpAsJSON(bool pretty_print) const {
@@ -457,6 +630,19 @@ class Model {
     DumpAsJSON(oss, pretty_print);
     return oss.str();
   }
+  /*!
+   * \brief Compute the resident memory footprint of this model, broken down by component.
+   *        Summed over all trees, plus the model-level metadata. Useful for capacity
+   *        planning: e.g. to see how much of a deployment's memory goes to node statistics
+   *        (droppable at load time), or to alert when a retrained model's footprint jumps.
+   */
+  inline MemoryFootprint GetMemoryFootprint() const;
+  /*!
+   * \brief Get read-only pointers into the node arrays of one tree, for bulk zero-copy
+   *        introspection. See \ref TreeArrayViews for the layout and lifetime contract.
+   * \param tree_id ID of the tree to inspect
+   */
+  inline TreeArrayViews GetTreeArrayViews(std::uint64_t tree_id) const;
 
   /* Compatibility Matrix:
      +------------------+----------+----------+----------------+-----------+
@@ -474,12 +660,105 @@ class Model {
       std::vector<PyBufferFrame> const& frames);
 
   /* Serialization to a file stream */
-  void SerializeToStream(std::ostream& os);
-  static std::unique_ptr<Model> DeserializeFromStream(std::istream& is);
+  /*!
+   * \brief Serialize (persist) the model to an output stream. When a codec other than
+   *        Codec::kUncompressed is given, each array payload in the tree section is
+   *        individually compressed, and decompression at load is parallelized per tree.
+   *        Compressed checkpoints require Treelite 4.4 or later to read.
+   * \param os Output stream
+   * \param codec Compression codec to apply to the tree section
+   * \param reserve_num_tree When nonzero, reserve header capacity for a model of up to
+   *        this many trees, so that \ref AppendTreesToCheckpoint can later extend the
+   *        checkpoint in place. The reservation costs 16 bytes of padding per reserved
+   *        tree and is skipped by readers.
+   */
+  void SerializeToStream(
+      std::ostream& os, Codec codec = Codec::kUncompressed, std::uint64_t reserve_num_tree = 0);
+  /*!
+   * \brief Append this model's newest trees to an existing checkpoint file, making the
+   *        checkpoint cost proportional to the delta. The file must have been written by
+   *        the running Treelite version and hold a strict prefix of this model's trees
+   *        (the usual case for online learning: load or keep the model, add trees, then
+   *        checkpoint). Only the new trees' records are encoded and appended; the header,
+   *        tree count and offset table are rewritten in place, consuming space reserved
+   *        via the reserve_num_tree argument of \ref SerializeToStream. Fails if the
+   *        reserved capacity is exhausted.
+   * \param filename Path to the checkpoint file to extend
+   */
+  void AppendTreesToCheckpoint(std::string const& filename);
+  /*!
+   * \brief Deserialize (load) a model from an input stream. When skip_node_stats is set,
+   *        the node-statistics arrays (data counts, sums of Hessians, gains) are not
+   *        materialized; inference does not read them, and skipping them cuts the resident
+   *        model size accordingly. The model then reports no statistics for any node.
+   * \param is Input stream
+   * \param skip_node_stats Whether to skip the node-statistics arrays
+   * \return Loaded model
+   */
+  static std::unique_ptr<Model> DeserializeFromStream(
+      std::istream& is, bool skip_node_stats = false);
+  /*!
+   * \brief Deserialize (load) a model by memory-mapping a serialized model file. The node
+   *        arrays point directly into the mapping instead of being copied to the heap, so
+   *        loading is near-instant, peak memory stays at one copy of the model, and the
+   *        pages are shared through the page cache with other processes mapping the same
+   *        file. The mapping is private (copy-on-write) and is held for the lifetime of the
+   *        returned model; the file must not be modified while the model is in use.
+   */
+  static std::unique_ptr<Model> DeserializeFromMappedFile(std::string const& filename);
+  /*!
+   * \brief Publish the model into a named shared memory region, serialized in the same
+   *        layout as a model file. Other processes on the host can then call
+   *        \ref AttachFromSharedMemory to construct model views over the region, so only
+   *        one physical copy of the model exists per host and worker startup becomes an
+   *        attach instead of a parse. On POSIX the region persists until
+   *        \ref RemoveSharedMemory is called; on Windows it lives for as long as some
+   *        process holds it open (for example, the publishing model).
+   * \param name Name of the shared memory region
+   */
+  void SerializeToSharedMemory(std::string const& name);
+  /*!
+   * \brief Construct a model over a shared memory region previously published with
+   *        \ref SerializeToSharedMemory. The node arrays point directly into the region
+   *        instead of being copied to the heap, so attaching is near-instant and all
+   *        attached processes share the publisher's single physical copy. The region is
+   *        mapped read-only and is held for the lifetime of the returned model.
+   * \param name Name of the shared memory region
+   * \return Model backed by the region
+   */
+  static std::unique_ptr<Model> AttachFromSharedMemory(std::string const& name);
+  /*!
+   * \brief Remove a named shared memory region, so that new attaches fail. Processes
+   *        already attached keep their mappings until they release their models. No-op on
+   *        Windows, where the region is reclaimed once the last holder releases it.
+   * \param name Name of the shared memory region
+   */
+  static void RemoveSharedMemory(std::string const& name);
+  /*!
+   * \brief Pre-fault the memory backing the model, so the first predictions after a load
+   *        run at steady-state speed instead of paying page-fault costs — a visible p99
+   *        spike when a freshly deployed server starts taking traffic. Every page of every
+   *        tree array is touched; for memory-mapped and shared-memory models the kernel is
+   *        additionally advised (madvise WILLNEED) to read the whole region ahead, so
+   *        faulting overlaps with I/O. Idempotent and safe to call concurrently with
+   *        prediction. See also \ref gtil::Warmup, which additionally exercises the
+   *        prediction code paths.
+   */
+  void Warmup() const;
   /*! \brief Return the Treelite version that produced this Model object. */
   inline Version GetVersion() const {
     return {major_ver_, minor_ver_, patch_ver_};
   }
+  /*!
+   * \brief Return an opaque token identifying this Model object. The token is unique among
+   *        live models and expires (as observed through std::weak_ptr) when the model is
+   *        destroyed, so caches keyed by model — such as the scratch arenas of the GTIL
+   *        prediction engine — can detect stale entries even when a later model reuses the
+   *        same address.
+   */
+  inline std::shared_ptr<void> GetInstanceToken() const {
+    return instance_token_;
+  }
 
   /*!
    * \brief Number of features used for the model.
@@ -518,6 +797,24 @@ class Model {
   // Type parameters
   TypeInfo threshold_type_{TypeInfo::kInvalid};
   TypeInfo leaf_output_type_{TypeInfo::kInvalid};
+  // When the model was loaded via DeserializeFromMappedFile, the mapping backing the
+  // node arrays; kept alive for as long as the model
+  std::shared_ptr<detail::MappedFile> mapped_file_{nullptr};
+  // When the model was published to or attached from a shared memory region, the region;
+  // kept alive for as long as the model (attached node arrays point into it, and a
+  // published region must stay open so other processes can attach to it on Windows)
+  std::shared_ptr<detail::SharedMemoryRegion> shm_region_{nullptr};
+  // When the model was loaded from a stream or a compressed checkpoint, the arena backing
+  // the tree arrays; kept alive for as long as the model
+  std::shared_ptr<detail::Arena> arena_{nullptr};
+  // Backing storage (file mappings, arenas) taken over from models consumed by the move
+  // overload of ConcatenateModelObjects; kept alive for as long as the model
+  std::vector<std::shared_ptr<void>> retained_backings_;
+  // Identity token handed out by GetInstanceToken(); expires when the model is destroyed
+  std::shared_ptr<void> instance_token_{std::make_shared<int>(0)};
+
+  friend class ModelReader;
+  friend std::unique_ptr<Model> ConcatenateModelObjects(std::vector<std::unique_ptr<Model>>&&);
 
   template <typename MixIn>
   friend class detail::serializer::Serializer;
@@ -525,6 +822,45 @@ class Model {
   friend class detail::serializer::Deserializer;
 };
 
+/*!
+ * \brief A handle to a serialized model file, supporting lazy loading of tree ranges. The
+ *        file is memory-mapped and its tree offset table is used to seek to individual tree
+ *        records, so a service that usually touches the first few hundred trees of a large
+ *        cascade can materialize just those and start without paying for the rest. More
+ *        trees can be materialized later, in place, as the cascade deepens. Node arrays
+ *        point into the mapping (see \ref Model::DeserializeFromMappedFile); models loaded
+ *        by a reader keep the mapping alive, so they may outlive the reader.
+ *
+ * Requires a checkpoint with a tree offset table, i.e. one written by this version of
+ * Treelite or later.
+ */
+class ModelReader {
+ public:
+  explicit ModelReader(std::string const& filename);
+  /*! \brief Number of trees stored in the file */
+  std::uint64_t NumTree() const {
+    return num_tree_;
+  }
+  /*!
+   * \brief Materialize a model containing the first tree_limit trees. Only the requested
+   *        tree records are decoded; the rest of the file is not touched.
+   */
+  std::unique_ptr<Model> LoadModel(std::uint64_t tree_limit);
+  /*!
+   * \brief Materialize additional trees of a model previously returned by LoadModel, so
+   *        that it holds the first tree_limit trees. No-op if the model already has as
+   *        many.
+   */
+  void ExtendModel(Model& model, std::uint64_t tree_limit);
+
+ private:
+  std::shared_ptr<detail::MappedFile> mapped_file_;
+  ContiguousArray<std::uint64_t> tree_offsets_;
+  std::size_t tree_section_begin_{0};
+  std::uint64_t num_tree_{0};
+  Codec codec_{Codec::kUncompressed};
+};
+
 /*!
  * \brief Concatenate multiple model objects into a single model object by copying
  *        all member trees into the destination model object
@@ -533,6 +869,16 @@ class Model {
  */
 std::unique_ptr<Model> ConcatenateModelObjects(std::vector<Model const*> const& objs);
 
+/*!
+ * \brief Concatenate multiple model objects into a single model object by moving all member
+ *        trees out of the source model objects. Unlike the copying overload, no tree data is
+ *        duplicated; only tree ownership is transferred, so concatenation takes time and
+ *        memory proportional to the number of trees, not their total size.
+ * \param objs List of model objects; consumed and emptied on return
+ * \return Concatenated model
+ */
+std::unique_ptr<Model> ConcatenateModelObjects(std::vector<std::unique_ptr<Model>>&& objs);
+
 }  // namespace treelite
 
 #include <treelite/detail/tree.h>
@@ -9,6 +9,7 @@
 #include <treelite/c_api_error.h>
 #include <treelite/gtil.h>
 #include <treelite/logging.h>
+#include <treelite/tree.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,14 @@ int TreeliteGTILGetOutputShape(TreeliteModelHandle model, std::uint64_t num_row,
   API_END();
 }
 
+int TreeliteGTILWarmup(TreeliteModelHandle model, TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  treelite::gtil::Warmup(*model_, *config_);
+  API_END();
+}
+
 int TreeliteGTILPredict(TreeliteModelHandle model, void const* input, char const* input_type,
     std::uint64_t num_row, void* output, TreeliteGTILConfigHandle config) {
   API_BEGIN();
@@ -48,8 +57,14 @@ int TreeliteGTILPredict(TreeliteModelHandle model, void const* input, char const
   auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
   std::string input_type_str = std::string(input_type);
   if (input_type_str == "float32") {
-    treelite::gtil::Predict(
-        *model_, static_cast<float const*>(input), num_row, static_cast<float*>(output), *config_);
+    if (model_->GetLeafOutputType() == treelite::TypeInfo::kFloat64) {
+      // Mixed precision: float32 rows against a float64 model; the output is float64
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), num_row,
+          static_cast<double*>(output), *config_);
+    } else {
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), num_row,
+          static_cast<float*>(output), *config_);
+    }
   } else if (input_type_str == "float64") {
     treelite::gtil::Predict(*model_, static_cast<double const*>(input), num_row,
         static_cast<double*>(output), *config_);
@@ -58,3 +73,206 @@ int TreeliteGTILPredict(TreeliteModelHandle model, void const* input, char const
   }
   API_END();
 }
+
+int TreeliteGTILPredictWithValidity(TreeliteModelHandle model, void const* input,
+    char const* input_type, std::uint8_t const* validity, std::uint64_t num_row, void* output,
+    TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    if (model_->GetLeafOutputType() == treelite::TypeInfo::kFloat64) {
+      // Mixed precision: float32 rows against a float64 model; the output is float64
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), validity, num_row,
+          static_cast<double*>(output), *config_);
+    } else {
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), validity, num_row,
+          static_cast<float*>(output), *config_);
+    }
+  } else if (input_type_str == "float64") {
+    treelite::gtil::Predict(*model_, static_cast<double const*>(input), validity, num_row,
+        static_cast<double*>(output), *config_);
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
+
+int TreeliteGTILPredictStrided(TreeliteModelHandle model, void const* input,
+    char const* input_type, std::uint64_t num_row, std::uint64_t row_stride,
+    std::uint64_t elem_stride, void* output, TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    if (model_->GetLeafOutputType() == treelite::TypeInfo::kFloat64) {
+      // Mixed precision: float32 rows against a float64 model; the output is float64
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), num_row, row_stride,
+          elem_stride, static_cast<double*>(output), *config_);
+    } else {
+      treelite::gtil::Predict(*model_, static_cast<float const*>(input), num_row, row_stride,
+          elem_stride, static_cast<float*>(output), *config_);
+    }
+  } else if (input_type_str == "float64") {
+    treelite::gtil::Predict(*model_, static_cast<double const*>(input), num_row, row_stride,
+        elem_stride, static_cast<double*>(output), *config_);
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
+
+int TreeliteGTILPredictSparse(TreeliteModelHandle model, void const* data, char const* input_type,
+    std::uint64_t const* col_ind, std::uint64_t const* row_ptr, std::uint64_t num_row,
+    void* output, TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    treelite::gtil::CSRView<float> input{
+        static_cast<float const*>(data), col_ind, row_ptr, num_row};
+    treelite::gtil::Predict(*model_, input, static_cast<float*>(output), *config_);
+  } else if (input_type_str == "float64") {
+    treelite::gtil::CSRView<double> input{
+        static_cast<double const*>(data), col_ind, row_ptr, num_row};
+    treelite::gtil::Predict(*model_, input, static_cast<double*>(output), *config_);
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
+
+int TreeliteGTILPredictLeaf(TreeliteModelHandle model, void const* input, char const* input_type,
+    std::uint64_t num_row, std::int32_t* output, TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    treelite::gtil::PredictLeaf(
+        *model_, static_cast<float const*>(input), num_row, output, *config_);
+  } else if (input_type_str == "float64") {
+    treelite::gtil::PredictLeaf(
+        *model_, static_cast<double const*>(input), num_row, output, *config_);
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
+
+int TreeliteGTILCreatePredictSession(TreeliteModelHandle model, TreeliteGTILConfigHandle config,
+    TreeliteGTILPredictSessionHandle* out) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  auto session = std::make_unique<treelite::gtil::PredictSession>(*model_, *config_);
+  *out = static_cast<TreeliteGTILPredictSessionHandle>(session.release());
+  API_END();
+}
+
+int TreeliteGTILPredictWithSession(TreeliteGTILPredictSessionHandle session, void const* input,
+    char const* input_type, std::uint64_t num_row, void* output) {
+  API_BEGIN();
+  auto const* session_ = static_cast<treelite::gtil::PredictSession const*>(session);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    session_->Predict(static_cast<float const*>(input), num_row, static_cast<float*>(output));
+  } else if (input_type_str == "float64") {
+    session_->Predict(static_cast<double const*>(input), num_row, static_cast<double*>(output));
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
+
+int TreeliteGTILDeletePredictSession(TreeliteGTILPredictSessionHandle session) {
+  API_BEGIN();
+  delete static_cast<treelite::gtil::PredictSession*>(session);
+  API_END();
+}
+
+int TreeliteGTILPredictWithStats(TreeliteModelHandle model, void const* input,
+    char const* input_type, std::uint64_t num_row, void* output, TreeliteGTILConfigHandle config,
+    TreeliteGTILPredictionStatsHandle* out_stats) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  auto stats = std::make_unique<treelite::gtil::PredictionStats>();
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    treelite::gtil::Predict(*model_, static_cast<float const*>(input), num_row,
+        static_cast<float*>(output), *config_, stats.get());
+  } else if (input_type_str == "float64") {
+    treelite::gtil::Predict(*model_, static_cast<double const*>(input), num_row,
+        static_cast<double*>(output), *config_, stats.get());
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  *out_stats = static_cast<TreeliteGTILPredictionStatsHandle>(stats.release());
+  API_END();
+}
+
+int TreeliteGTILPredictionStatsGetCounters(TreeliteGTILPredictionStatsHandle stats,
+    std::uint64_t* out_num_row, std::uint64_t* out_num_tree_traversal,
+    std::uint64_t* out_num_node_visit, std::uint64_t* out_num_missing_branch,
+    std::uint64_t* out_num_categorical_visit) {
+  API_BEGIN();
+  auto const* stats_ = static_cast<treelite::gtil::PredictionStats const*>(stats);
+  *out_num_row = stats_->num_row;
+  *out_num_tree_traversal = stats_->num_tree_traversal;
+  *out_num_node_visit = stats_->num_node_visit;
+  *out_num_missing_branch = stats_->num_missing_branch;
+  *out_num_categorical_visit = stats_->num_categorical_visit;
+  API_END();
+}
+
+int TreeliteGTILPredictionStatsGetPerTreeNodeVisits(
+    TreeliteGTILPredictionStatsHandle stats, std::uint64_t const** out, std::uint64_t* out_len) {
+  API_BEGIN();
+  auto const* stats_ = static_cast<treelite::gtil::PredictionStats const*>(stats);
+  *out = stats_->node_visit_per_tree.data();
+  *out_len = stats_->node_visit_per_tree.size();
+  API_END();
+}
+
+int TreeliteGTILDeletePredictionStats(TreeliteGTILPredictionStatsHandle stats) {
+  API_BEGIN();
+  delete static_cast<treelite::gtil::PredictionStats*>(stats);
+  API_END();
+}
+
+int TreeliteGTILPredictStream(TreeliteModelHandle model, char const* input_type,
+    std::uint64_t chunk_rows, TreeliteGTILChunkReadFunc read_func,
+    TreeliteGTILChunkWriteFunc write_func, void* user_context, TreeliteGTILConfigHandle config) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  auto const* config_ = static_cast<treelite::gtil::Configuration const*>(config);
+  std::string input_type_str = std::string(input_type);
+  if (input_type_str == "float32") {
+    treelite::gtil::PredictStream<float>(
+        *model_,
+        [read_func, user_context](float* buffer, std::uint64_t max_rows) {
+          return read_func(user_context, buffer, max_rows);
+        },
+        [write_func, user_context](float const* output, std::uint64_t num_row) {
+          write_func(user_context, output, num_row);
+        },
+        chunk_rows, *config_);
+  } else if (input_type_str == "float64") {
+    treelite::gtil::PredictStream<double>(
+        *model_,
+        [read_func, user_context](double* buffer, std::uint64_t max_rows) {
+          return read_func(user_context, buffer, max_rows);
+        },
+        [write_func, user_context](double const* output, std::uint64_t num_row) {
+          write_func(user_context, output, num_row);
+        },
+        chunk_rows, *config_);
+  } else {
+    TREELITE_LOG(FATAL) << "Unexpected type spec: " << input_type_str;
+  }
+  API_END();
+}
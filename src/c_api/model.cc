@@ -11,7 +11,11 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "./c_api_utils.h"
 
@@ -56,6 +60,55 @@ int TreeliteQueryNumFeature(TreeliteModelHandle model, int* out) {
   API_END();
 }
 
+int TreeliteQueryMemoryFootprint(TreeliteModelHandle model, std::uint64_t* out_node_structure,
+    std::uint64_t* out_thresholds, std::uint64_t* out_leaf_outputs,
+    std::uint64_t* out_category_lists, std::uint64_t* out_node_stats, std::uint64_t* out_metadata,
+    std::uint64_t* out_total) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  treelite::MemoryFootprint const footprint = model_->GetMemoryFootprint();
+  *out_node_structure = footprint.node_structure;
+  *out_thresholds = footprint.thresholds;
+  *out_leaf_outputs = footprint.leaf_outputs;
+  *out_category_lists = footprint.category_lists;
+  *out_node_stats = footprint.node_stats;
+  *out_metadata = footprint.metadata;
+  *out_total = footprint.total;
+  API_END();
+}
+
+int TreeliteGetTreeArrays(TreeliteModelHandle model, std::uint64_t tree_id,
+    std::int32_t* out_num_nodes, std::int8_t const** out_node_type, std::int32_t const** out_cleft,
+    std::int32_t const** out_cright, std::int32_t const** out_split_index,
+    void const** out_threshold, void const** out_leaf_value, void const** out_leaf_vector,
+    std::uint64_t const** out_leaf_vector_begin, std::uint64_t const** out_leaf_vector_end) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  treelite::TreeArrayViews const views = model_->GetTreeArrayViews(tree_id);
+  *out_num_nodes = views.num_nodes;
+  *out_node_type = reinterpret_cast<std::int8_t const*>(views.node_type);
+  *out_cleft = views.cleft;
+  *out_cright = views.cright;
+  *out_split_index = views.split_index;
+  *out_threshold = views.threshold;
+  *out_leaf_value = views.leaf_value;
+  *out_leaf_vector = views.leaf_vector;
+  *out_leaf_vector_begin = views.leaf_vector_begin;
+  *out_leaf_vector_end = views.leaf_vector_end;
+  API_END();
+}
+
+int TreeliteGetTreeStatsArrays(TreeliteModelHandle model, std::uint64_t tree_id,
+    std::uint64_t const** out_data_count, double const** out_sum_hess, double const** out_gain) {
+  API_BEGIN();
+  auto const* model_ = static_cast<treelite::Model const*>(model);
+  treelite::TreeArrayViews const views = model_->GetTreeArrayViews(tree_id);
+  *out_data_count = views.data_count;
+  *out_sum_hess = views.sum_hess;
+  *out_gain = views.gain;
+  API_END();
+}
+
 int TreeliteConcatenateModelObjects(
     TreeliteModelHandle const* objs, std::size_t len, TreeliteModelHandle* out) {
   API_BEGIN();
@@ -67,6 +120,20 @@ int TreeliteConcatenateModelObjects(
   API_END();
 }
 
+int TreeliteConcatenateModelObjectsAndFree(
+    TreeliteModelHandle* objs, std::size_t len, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::vector<std::unique_ptr<treelite::Model>> model_objs;
+  model_objs.reserve(len);
+  for (std::size_t i = 0; i < len; ++i) {
+    model_objs.emplace_back(static_cast<treelite::Model*>(objs[i]));
+    objs[i] = nullptr;
+  }
+  auto concatenated_model = ConcatenateModelObjects(std::move(model_objs));
+  *out = static_cast<TreeliteModelHandle>(concatenated_model.release());
+  API_END();
+}
+
 int TreeliteFreeModel(TreeliteModelHandle handle) {
   API_BEGIN();
   delete static_cast<treelite::Model*>(handle);
@@ -41,6 +41,22 @@ int TreeliteModelBuilderEndTree(TreeliteModelBuilderHandle model_builder) {
   API_END();
 }
 
+int TreeliteModelBuilderBulkTree(TreeliteModelBuilderHandle model_builder, std::int32_t num_nodes,
+    std::int32_t const* left_child, std::int32_t const* right_child,
+    std::int32_t const* split_index, double const* threshold, int const* default_left,
+    char const* cmp, double const* leaf_value, std::size_t leaf_value_len) {
+  API_BEGIN();
+  auto* builder_ = static_cast<treelite::model_builder::ModelBuilder*>(model_builder);
+  treelite::Operator cmp_ = treelite::OperatorFromString(cmp);
+  std::vector<bool> default_left_(default_left, default_left + num_nodes);
+  builder_->BulkTree(num_nodes, std::vector<std::int32_t>(left_child, left_child + num_nodes),
+      std::vector<std::int32_t>(right_child, right_child + num_nodes),
+      std::vector<std::int32_t>(split_index, split_index + num_nodes),
+      std::vector<double>(threshold, threshold + num_nodes), default_left_, cmp_,
+      std::vector<double>(leaf_value, leaf_value + leaf_value_len));
+  API_END();
+}
+
 int TreeliteModelBuilderStartNode(TreeliteModelBuilderHandle model_builder, int node_key) {
   API_BEGIN();
   auto* builder_ = static_cast<treelite::model_builder::ModelBuilder*>(model_builder);
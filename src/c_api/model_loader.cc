@@ -51,6 +51,24 @@ int TreeliteLoadXGBoostModelFromString(
   API_END();
 }
 
+int TreeliteLoadXGBoostModelUBJSON(
+    char const* filename, char const* config_json, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::unique_ptr<treelite::Model> model
+      = treelite::model_loader::LoadXGBoostModelUBJSON(filename, config_json);
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
+int TreeliteLoadXGBoostModelFromUBJSONString(char const* ubjson_str, std::size_t length,
+    char const* config_json, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::unique_ptr<treelite::Model> model
+      = treelite::model_loader::LoadXGBoostModelFromUBJSONString(ubjson_str, length, config_json);
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
 int TreeliteLoadLightGBMModel(
     char const* filename, [[maybe_unused]] char const* config_json, TreeliteModelHandle* out) {
   // config_json is unused for now
@@ -8,9 +8,11 @@
 #include <treelite/c_api.h>
 #include <treelite/c_api_error.h>
 #include <treelite/detail/file_utils.h>
+#include <treelite/enum/codec.h>
 #include <treelite/tree.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -25,6 +27,31 @@ int TreeliteSerializeModelToFile(TreeliteModelHandle handle, char const* filenam
   API_END();
 }
 
+int TreeliteSerializeModelToFileWithCodec(
+    TreeliteModelHandle handle, char const* filename, char const* codec) {
+  API_BEGIN();
+  std::ofstream ofs = treelite::detail::OpenFileForWriteAsStream(filename);
+  auto* model_ = static_cast<treelite::Model*>(handle);
+  model_->SerializeToStream(ofs, treelite::CodecFromString(codec));
+  API_END();
+}
+
+int TreeliteSerializeModelToFileWithTreeCapacity(TreeliteModelHandle handle, char const* filename,
+    char const* codec, uint64_t reserve_num_tree) {
+  API_BEGIN();
+  std::ofstream ofs = treelite::detail::OpenFileForWriteAsStream(filename);
+  auto* model_ = static_cast<treelite::Model*>(handle);
+  model_->SerializeToStream(ofs, treelite::CodecFromString(codec), reserve_num_tree);
+  API_END();
+}
+
+int TreeliteAppendTreesToCheckpoint(TreeliteModelHandle handle, char const* filename) {
+  API_BEGIN();
+  auto* model_ = static_cast<treelite::Model*>(handle);
+  model_->AppendTreesToCheckpoint(std::string(filename));
+  API_END();
+}
+
 int TreeliteDeserializeModelFromFile(char const* filename, TreeliteModelHandle* out) {
   API_BEGIN();
   std::ifstream ifs = treelite::detail::OpenFileForReadAsStream(filename);
@@ -33,6 +60,83 @@ int TreeliteDeserializeModelFromFile(char const* filename, TreeliteModelHandle*
   API_END();
 }
 
+int TreeliteDeserializeModelFromFileWithoutNodeStats(
+    char const* filename, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::ifstream ifs = treelite::detail::OpenFileForReadAsStream(filename);
+  std::unique_ptr<treelite::Model> model
+      = treelite::Model::DeserializeFromStream(ifs, /*skip_node_stats=*/true);
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
+int TreeliteDeserializeModelFromMappedFile(char const* filename, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::unique_ptr<treelite::Model> model
+      = treelite::Model::DeserializeFromMappedFile(std::string(filename));
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
+int TreeliteSerializeModelToSharedMemory(TreeliteModelHandle handle, char const* name) {
+  API_BEGIN();
+  auto* model_ = static_cast<treelite::Model*>(handle);
+  model_->SerializeToSharedMemory(std::string(name));
+  API_END();
+}
+
+int TreeliteAttachModelFromSharedMemory(char const* name, TreeliteModelHandle* out) {
+  API_BEGIN();
+  std::unique_ptr<treelite::Model> model
+      = treelite::Model::AttachFromSharedMemory(std::string(name));
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
+int TreeliteRemoveSharedMemory(char const* name) {
+  API_BEGIN();
+  treelite::Model::RemoveSharedMemory(std::string(name));
+  API_END();
+}
+
+int TreeliteModelReaderOpen(char const* filename, TreeliteModelReaderHandle* out) {
+  API_BEGIN();
+  auto reader = std::make_unique<treelite::ModelReader>(std::string(filename));
+  *out = static_cast<TreeliteModelReaderHandle>(reader.release());
+  API_END();
+}
+
+int TreeliteModelReaderGetNumTree(TreeliteModelReaderHandle handle, std::uint64_t* out) {
+  API_BEGIN();
+  auto* reader_ = static_cast<treelite::ModelReader*>(handle);
+  *out = reader_->NumTree();
+  API_END();
+}
+
+int TreeliteModelReaderLoadModel(
+    TreeliteModelReaderHandle handle, std::uint64_t tree_limit, TreeliteModelHandle* out) {
+  API_BEGIN();
+  auto* reader_ = static_cast<treelite::ModelReader*>(handle);
+  std::unique_ptr<treelite::Model> model = reader_->LoadModel(tree_limit);
+  *out = static_cast<TreeliteModelHandle>(model.release());
+  API_END();
+}
+
+int TreeliteModelReaderExtendModel(
+    TreeliteModelReaderHandle handle, TreeliteModelHandle model, std::uint64_t tree_limit) {
+  API_BEGIN();
+  auto* reader_ = static_cast<treelite::ModelReader*>(handle);
+  auto* model_ = static_cast<treelite::Model*>(model);
+  reader_->ExtendModel(*model_, tree_limit);
+  API_END();
+}
+
+int TreeliteModelReaderClose(TreeliteModelReaderHandle handle) {
+  API_BEGIN();
+  delete static_cast<treelite::ModelReader*>(handle);
+  API_END();
+}
+
 int TreeliteSerializeModelToBytes(
     TreeliteModelHandle handle, char const** out_bytes, std::size_t* out_bytes_len) {
   API_BEGIN();
@@ -0,0 +1,40 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file trace.cc
+ * \author Hyunsu Cho
+ * \brief C API for the phase-level tracing facility
+ */
+
+#include <treelite/c_api.h>
+#include <treelite/c_api_error.h>
+#include <treelite/trace.h>
+
+#include <sstream>
+
+#include "./c_api_utils.h"
+
+int TreeliteEnableTracing(int enable) {
+  API_BEGIN();
+  treelite::trace::EnableTracing(enable != 0);
+  API_END();
+}
+
+int TreeliteGetTraceReport(char const** out_report) {
+  API_BEGIN();
+  std::ostringstream oss;
+  oss << "[";
+  bool first = true;
+  for (auto const& stat : treelite::trace::GetReport()) {
+    if (!first) {
+      oss << ", ";
+    }
+    first = false;
+    oss << R"({"phase": ")" << stat.phase << R"(", "num_invocation": )" << stat.num_invocation
+        << R"(, "total_sec": )" << stat.total_sec << "}";
+  }
+  oss << "]";
+  std::string& ret_str = treelite::c_api::ReturnValueStore::Get()->ret_str;
+  ret_str = oss.str();
+  *out_report = ret_str.c_str();
+  API_END();
+}
@@ -0,0 +1,38 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file codec.cc
+ * \author Hyunsu Cho
+ * \brief Utilities for Codec enum
+ */
+
+#include <treelite/enum/codec.h>
+#include <treelite/logging.h>
+
+#include <string>
+
+namespace treelite {
+
+std::string CodecToString(Codec codec) {
+  switch (codec) {
+  case Codec::kUncompressed:
+    return "uncompressed";
+  case Codec::kLZ4:
+    return "lz4";
+  default:
+    TREELITE_LOG(FATAL) << "Unrecognized codec";
+    return "";
+  }
+}
+
+Codec CodecFromString(std::string const& str) {
+  if (str == "uncompressed") {
+    return Codec::kUncompressed;
+  } else if (str == "lz4") {
+    return Codec::kLZ4;
+  } else {
+    TREELITE_LOG(FATAL) << "Unrecognized codec: " << str;
+    return Codec::kUncompressed;
+  }
+}
+
+}  // namespace treelite
@@ -0,0 +1,464 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file compiled_model.cc
+ * \author Hyunsu Cho
+ * \brief Logic to flatten a tree ensemble into packed node records for fast traversal
+ */
+#include <treelite/gtil.h>
+#include <treelite/logging.h>
+#include <treelite/tree.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "./compiled_model.h"
+
+namespace {
+
+template <typename ThresholdT, typename LeafOutputT>
+treelite::gtil::CompiledTree<ThresholdT, LeafOutputT> CompileTree(
+    treelite::Tree<ThresholdT, LeafOutputT> const& tree) {
+  using treelite::gtil::CompiledNode;
+  treelite::gtil::CompiledTree<ThresholdT, LeafOutputT> compiled_tree;
+  compiled_tree.nodes.Resize(tree.num_nodes);
+  bool has_categorical_split = false;
+  bool has_leaf_vector = false;
+  bool uniform_operator = true;
+  treelite::Operator op = treelite::Operator::kNone;
+  for (int nid = 0; nid < tree.num_nodes; ++nid) {
+    CompiledNode<ThresholdT>& node = compiled_tree.nodes[nid];
+    if (tree.IsLeaf(nid)) {
+      node.cleft = -1;
+      node.cright = -1;
+      node.bits = 0;
+      if (tree.HasLeafVector(nid)) {
+        has_leaf_vector = true;
+        auto const leaf_vector = tree.LeafVector(nid);
+        node.aux = static_cast<std::uint32_t>(compiled_tree.leaf_vector.Size());
+        node.threshold_or_leaf_value = ThresholdT{};
+        compiled_tree.leaf_vector.Extend(leaf_vector);
+      } else {
+        node.aux = treelite::gtil::kCompiledNodeInvalidAux;
+        node.threshold_or_leaf_value = tree.LeafValue(nid);
+      }
+    } else {
+      auto const split_index = static_cast<std::uint32_t>(tree.SplitIndex(nid));
+      TREELITE_CHECK_LE(split_index, treelite::gtil::kCompiledNodeSplitIndexMask)
+          << "Feature index too large to be compiled";
+      node.cleft = tree.LeftChild(nid);
+      node.cright = tree.RightChild(nid);
+      node.bits = split_index;
+      if (tree.DefaultLeft(nid)) {
+        node.bits |= treelite::gtil::kCompiledNodeDefaultLeftMask;
+      }
+      if (tree.NodeType(nid) == treelite::TreeNodeType::kCategoricalTestNode) {
+        has_categorical_split = true;
+        auto const category_list = tree.CategoryList(nid);
+        node.bits |= treelite::gtil::kCompiledNodeCategoricalMask;
+        if (tree.CategoryListRightChild(nid)) {
+          node.bits |= treelite::gtil::kCompiledNodeCategoryListRightChildMask;
+        }
+        node.aux = static_cast<std::uint32_t>(compiled_tree.category_bitset_begin.Size());
+        compiled_tree.category_bitset_begin.PushBack(compiled_tree.category_bitset.Size());
+        if (!category_list.empty()) {
+          // The category list is in ascending order, so the last element determines the
+          // number of 64-bit words needed
+          std::uint64_t const num_words = category_list.back() / 64 + 1;
+          std::size_t const word_begin = compiled_tree.category_bitset.Size();
+          compiled_tree.category_bitset.Resize(word_begin + num_words, 0);
+          for (std::uint32_t const category : category_list) {
+            compiled_tree.category_bitset[word_begin + category / 64]
+                |= (std::uint64_t(1) << (category % 64));
+          }
+        }
+        compiled_tree.category_bitset_end.PushBack(compiled_tree.category_bitset.Size());
+        node.threshold_or_leaf_value = ThresholdT{};
+      } else {
+        auto const node_op = tree.ComparisonOp(nid);
+        if (op == treelite::Operator::kNone) {
+          op = node_op;
+        } else if (op != node_op) {
+          uniform_operator = false;
+        }
+        node.bits |= (static_cast<std::uint32_t>(node_op)
+                      & treelite::gtil::kCompiledNodeOperatorMask)
+                     << treelite::gtil::kCompiledNodeOperatorShift;
+        node.aux = treelite::gtil::kCompiledNodeInvalidAux;
+        node.threshold_or_leaf_value = tree.Threshold(nid);
+      }
+    }
+  }
+  if (uniform_operator && op != treelite::Operator::kNone) {
+    compiled_tree.uniform_operator = op;
+  }
+  // The vectorized kernel handles ordering comparisons only; trees with kEQ tests,
+  // categorical tests, or leaf vectors take the scalar path
+  compiled_tree.simd_compatible = !has_categorical_split && !has_leaf_vector
+                                  && compiled_tree.uniform_operator != treelite::Operator::kNone
+                                  && compiled_tree.uniform_operator != treelite::Operator::kEQ;
+  return compiled_tree;
+}
+
+/*!
+ * \brief Detect whether a compiled tree is complete (every leaf at the same depth), purely
+ *        numerical with a uniform comparison operator, and scalar-leafed; if so, build the
+ *        heap-ordered arrays consumed by the unrolled fixed-depth kernel.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+void DetectFixedDepth(treelite::gtil::CompiledTree<ThresholdT, LeafOutputT>& tree) {
+  namespace gtil = treelite::gtil;
+  if (tree.uniform_operator == treelite::Operator::kNone) {
+    return;
+  }
+  int depth = 0;
+  for (std::int32_t nid = 0; tree.nodes[nid].cleft != -1; nid = tree.nodes[nid].cleft) {
+    ++depth;
+  }
+  if (depth < 1 || depth > gtil::kMaxFixedDepth) {
+    return;
+  }
+  std::uint32_t const num_internal = (std::uint32_t(1) << depth) - 1;
+  std::vector<std::uint32_t> bits(num_internal);
+  std::vector<ThresholdT> thresholds(num_internal);
+  std::vector<LeafOutputT> leaf_values(std::uint32_t(1) << depth);
+  struct Frame {
+    std::int32_t nid;
+    std::uint32_t slot;  // heap slot
+    int depth;
+  };
+  std::vector<Frame> stack;
+  stack.push_back({0, 0, 0});
+  while (!stack.empty()) {
+    Frame const frame = stack.back();
+    stack.pop_back();
+    auto const& node = tree.nodes[frame.nid];
+    if (node.cleft == -1) {
+      if (frame.depth != depth || node.aux != gtil::kCompiledNodeInvalidAux) {
+        return;  // leaf at the wrong depth, or leaf vector output
+      }
+      leaf_values[frame.slot - num_internal] = node.threshold_or_leaf_value;
+    } else {
+      if (frame.depth >= depth || (node.bits & gtil::kCompiledNodeCategoricalMask)) {
+        return;  // deeper than the leftmost path, or categorical test
+      }
+      bits[frame.slot] = node.bits;
+      thresholds[frame.slot] = node.threshold_or_leaf_value;
+      stack.push_back({node.cleft, 2 * frame.slot + 1, frame.depth + 1});
+      stack.push_back({node.cright, 2 * frame.slot + 2, frame.depth + 1});
+    }
+  }
+  tree.fixed_bits.Extend(bits);
+  tree.fixed_threshold.Extend(thresholds);
+  tree.fixed_leaf_value.Extend(leaf_values);
+  tree.fixed_depth = depth;
+}
+
+/*!
+ * \brief Build the half-width node records for a tree, if it qualifies: every test node is
+ *        numerical, every leaf output is a scalar, split indices fit in 12 bits, and the
+ *        child offsets of every internal node fit in int16. Each condition is validated
+ *        against the actual node records; a tree that fails any of them keeps using the
+ *        full-width records only.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+void BuildCompactNodes(treelite::gtil::CompiledTree<ThresholdT, LeafOutputT>& tree) {
+  using treelite::gtil::CompactNode;
+  using treelite::gtil::CompiledNode;
+  namespace gtil = treelite::gtil;
+  auto const num_nodes = static_cast<std::int32_t>(tree.nodes.Size());
+  for (std::int32_t nid = 0; nid < num_nodes; ++nid) {
+    CompiledNode<ThresholdT> const& node = tree.nodes[nid];
+    if (node.cleft == -1) {
+      if (node.aux != gtil::kCompiledNodeInvalidAux) {
+        return;  // leaf vector output
+      }
+    } else {
+      if (node.bits & gtil::kCompiledNodeCategoricalMask) {
+        return;  // categorical test
+      }
+      if ((node.bits & gtil::kCompiledNodeSplitIndexMask) > gtil::kCompactNodeSplitIndexMask) {
+        return;  // split index does not fit in 12 bits
+      }
+      std::int32_t const left_offset = node.cleft - nid;
+      std::int32_t const right_offset = node.cright - nid;
+      if (left_offset == 0 || left_offset < -32768 || left_offset > 32767
+          || right_offset < -32768 || right_offset > 32767) {
+        return;  // child offset does not fit in int16 (or collides with the leaf marker)
+      }
+    }
+  }
+  tree.compact_nodes.Resize(num_nodes);
+  for (std::int32_t nid = 0; nid < num_nodes; ++nid) {
+    CompiledNode<ThresholdT> const& node = tree.nodes[nid];
+    CompactNode<ThresholdT>& cnode = tree.compact_nodes[nid];
+    if (node.cleft == -1) {
+      cnode.threshold_or_leaf_value = ThresholdT{};  // leaf payload read from the full record
+      cnode.cleft_offset = 0;
+      cnode.cright_offset = 0;
+      cnode.bits = 0;
+    } else {
+      cnode.threshold_or_leaf_value = node.threshold_or_leaf_value;
+      cnode.cleft_offset = static_cast<std::int16_t>(node.cleft - nid);
+      cnode.cright_offset = static_cast<std::int16_t>(node.cright - nid);
+      cnode.bits = static_cast<std::uint16_t>(node.bits & gtil::kCompactNodeSplitIndexMask);
+      cnode.bits |= static_cast<std::uint16_t>(((node.bits >> gtil::kCompiledNodeOperatorShift)
+                                                   & gtil::kCompiledNodeOperatorMask)
+                                               << gtil::kCompactNodeOperatorShift);
+      if (node.bits & gtil::kCompiledNodeDefaultLeftMask) {
+        cnode.bits |= gtil::kCompactNodeDefaultLeftMask;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Build the quantized representation: per-feature sorted distinct thresholds, and a
+ *        parallel node array per tree with each threshold replaced by its 16-bit bin rank
+ *        (encoded as 2r+1; see compiled_model.h). Trees with categorical tests are skipped
+ *        and keep using the full-precision node records.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+void QuantizeTrees(
+    treelite::gtil::CompiledModelPreset<ThresholdT, LeafOutputT>& preset, std::int32_t num_feature) {
+  using treelite::gtil::CompiledNode;
+  namespace gtil = treelite::gtil;
+  std::vector<std::vector<ThresholdT>> boundaries(num_feature);
+  auto is_quantizable = [](gtil::CompiledTree<ThresholdT, LeafOutputT> const& tree) {
+    for (std::size_t nid = 0; nid < tree.nodes.Size(); ++nid) {
+      if (tree.nodes[nid].cleft != -1 && (tree.nodes[nid].bits & gtil::kCompiledNodeCategoricalMask)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  for (auto const& tree : preset.trees) {
+    if (!is_quantizable(tree)) {
+      continue;
+    }
+    for (std::size_t nid = 0; nid < tree.nodes.Size(); ++nid) {
+      CompiledNode<ThresholdT> const& node = tree.nodes[nid];
+      if (node.cleft != -1) {
+        boundaries[node.bits & gtil::kCompiledNodeSplitIndexMask].push_back(
+            node.threshold_or_leaf_value);
+      }
+    }
+  }
+  for (std::int32_t fid = 0; fid < num_feature; ++fid) {
+    std::vector<ThresholdT>& b = boundaries[fid];
+    std::sort(b.begin(), b.end());
+    b.erase(std::unique(b.begin(), b.end()), b.end());
+    // The largest encoded rank is 2 * (count - 1) + 1 and the largest binned input value is
+    // 2 * count, both of which must stay clear of the missing-value sentinel
+    TREELITE_CHECK_LT(2 * b.size(), static_cast<std::size_t>(gtil::kQuantizedMissing))
+        << "Feature " << fid << " has too many distinct thresholds to be quantized";
+    preset.bin_begin.PushBack(preset.bin_boundaries.Size());
+    preset.bin_boundaries.Extend(b);
+    preset.bin_end.PushBack(preset.bin_boundaries.Size());
+  }
+  for (auto& tree : preset.trees) {
+    if (!is_quantizable(tree)) {
+      continue;
+    }
+    tree.quantized_nodes.Resize(tree.nodes.Size());
+    for (std::size_t nid = 0; nid < tree.nodes.Size(); ++nid) {
+      CompiledNode<ThresholdT> const& node = tree.nodes[nid];
+      CompiledNode<std::uint16_t>& qnode = tree.quantized_nodes[nid];
+      qnode.cleft = node.cleft;
+      qnode.cright = node.cright;
+      qnode.bits = node.bits;
+      qnode.aux = node.aux;
+      if (node.cleft == -1) {
+        qnode.threshold_or_leaf_value = 0;  // leaf payload read from the full node record
+      } else {
+        std::uint32_t const fid = node.bits & gtil::kCompiledNodeSplitIndexMask;
+        ThresholdT const* first = preset.bin_boundaries.Data() + preset.bin_begin[fid];
+        ThresholdT const* last = preset.bin_boundaries.Data() + preset.bin_end[fid];
+        auto const rank = std::lower_bound(first, last, node.threshold_or_leaf_value) - first;
+        qnode.threshold_or_leaf_value = static_cast<std::uint16_t>(2 * rank + 1);
+      }
+    }
+  }
+  preset.quantized = true;
+}
+
+/*!
+ * \brief Re-encode the concatenated leaf vectors as bfloat16 and drop the full-precision
+ *        copies. For multiclass forests the leaf vectors dominate the compiled model's
+ *        memory, so the re-encoding roughly halves (float) or quarters (double) the
+ *        bandwidth-bound part of the traversal working set; values are decoded back to
+ *        float on accumulation. Scalar leaf outputs live inside the node records and keep
+ *        full precision.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+void ReduceLeafPrecision(treelite::gtil::CompiledModelPreset<ThresholdT, LeafOutputT>& preset) {
+  for (auto& tree : preset.trees) {
+    if (tree.leaf_vector.Empty()) {
+      continue;
+    }
+    std::size_t const num_elem = tree.leaf_vector.Size();
+    tree.leaf_vector_half.Resize(num_elem);
+    for (std::size_t i = 0; i < num_elem; ++i) {
+      tree.leaf_vector_half[i]
+          = treelite::gtil::FloatToBfloat16(static_cast<float>(tree.leaf_vector[i]));
+    }
+    // Clear() keeps the capacity; move-assign a fresh array to actually release the memory
+    tree.leaf_vector = treelite::ContiguousArray<LeafOutputT>{};
+  }
+  preset.reduced_precision_leaf = true;
+}
+
+/*!
+ * \brief Opt-in pass sharing one copy of each structurally identical subtree across the
+ *        ensemble. Boosted models repeat subtrees — identical split/threshold/leaf chains,
+ *        shallow leaves above all — once per tree that grew them, and each copy occupies
+ *        its own node records. The pass hashes a canonical encoding of every subtree
+ *        bottom-up (the node record with children replaced by their canonical IDs) and
+ *        rewrites each eligible tree into one ensemble-wide pool with pool-absolute child
+ *        IDs, so every distinct subtree is stored exactly once and repeated subtrees stay
+ *        resident in cache across trees. Eligible trees are purely numerical with scalar
+ *        leaves; leaf vectors and category segments are indexed per tree, which sharing
+ *        would break, so such trees keep their private representation. A deduplicated tree
+ *        releases its private node arrays along with the specialized layouts built from
+ *        them, trading those kernels for the smaller working set.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+void DeduplicateTrees(treelite::gtil::CompiledModelPreset<ThresholdT, LeafOutputT>& preset) {
+  using treelite::gtil::CompiledNode;
+  // Keyed by the raw bytes of the canonical node record; exact structural equality, so
+  // distinct subtrees can never alias
+  std::unordered_map<std::string, std::int32_t> canonical;
+  std::vector<CompiledNode<ThresholdT>> pool;
+  std::vector<std::int32_t> canonical_id;
+  std::vector<std::pair<std::int32_t, bool>> stack;
+  for (auto& tree : preset.trees) {
+    bool eligible = !tree.nodes.Empty();
+    for (std::size_t nid = 0; eligible && nid < tree.nodes.Size(); ++nid) {
+      auto const& node = tree.nodes[nid];
+      if ((node.bits & treelite::gtil::kCompiledNodeCategoricalMask)
+          || (node.cleft == -1 && node.aux != treelite::gtil::kCompiledNodeInvalidAux)) {
+        eligible = false;
+      }
+    }
+    if (!eligible) {
+      continue;
+    }
+    // Children must be canonicalized before their parent; an explicit stack keeps the
+    // post-order walk safe on arbitrarily deep trees
+    canonical_id.assign(tree.nodes.Size(), -1);
+    stack.clear();
+    stack.emplace_back(0, false);
+    while (!stack.empty()) {
+      auto const [nid, children_done] = stack.back();
+      stack.pop_back();
+      CompiledNode<ThresholdT> rec = tree.nodes[nid];
+      if (rec.cleft != -1 && !children_done) {
+        stack.emplace_back(nid, true);
+        stack.emplace_back(rec.cleft, false);
+        stack.emplace_back(rec.cright, false);
+        continue;
+      }
+      if (rec.cleft != -1) {
+        rec.cleft = canonical_id[rec.cleft];
+        rec.cright = canonical_id[rec.cright];
+      }
+      std::string key(reinterpret_cast<char const*>(&rec), sizeof(rec));
+      auto const [it, inserted]
+          = canonical.try_emplace(std::move(key), static_cast<std::int32_t>(pool.size()));
+      if (inserted) {
+        pool.push_back(rec);
+      }
+      canonical_id[nid] = it->second;
+    }
+    tree.dedup_root = canonical_id[0];
+    // Release the private representations the pool supersedes (move-assign fresh arrays;
+    // Clear() would keep the capacity)
+    tree.nodes = treelite::ContiguousArray<CompiledNode<ThresholdT>>{};
+    tree.quantized_nodes = treelite::ContiguousArray<CompiledNode<std::uint16_t>>{};
+    tree.compact_nodes = treelite::ContiguousArray<treelite::gtil::CompactNode<ThresholdT>>{};
+    tree.fixed_bits = treelite::ContiguousArray<std::uint32_t>{};
+    tree.fixed_threshold = treelite::ContiguousArray<ThresholdT>{};
+    tree.fixed_leaf_value = treelite::ContiguousArray<LeafOutputT>{};
+    tree.fixed_depth = -1;
+    tree.branchless = false;
+    tree.simd_compatible = false;
+  }
+  preset.dedup_nodes = treelite::ContiguousArray<CompiledNode<ThresholdT>>(pool);
+  preset.deduplicated = true;
+}
+
+}  // anonymous namespace
+
+namespace treelite::gtil {
+
+CompiledModel::CompiledModel(Model const& model, bool quantize, bool compact,
+    bool reduced_precision_leaf, bool deduplicate)
+    : impl_{std::make_unique<CompiledModelImpl>()} {
+  impl_->model = &model;
+  impl_->leaf_vector_length
+      = static_cast<std::uint32_t>(model.leaf_vector_shape[0] * model.leaf_vector_shape[1]);
+  std::visit(
+      [&](auto&& concrete_model) {
+        using ModelPresetT = std::remove_const_t<std::remove_reference_t<decltype(concrete_model)>>;
+        using ThresholdT = typename ModelPresetT::threshold_type;
+        using LeafOutputT = typename ModelPresetT::leaf_output_type;
+        CompiledModelPreset<ThresholdT, LeafOutputT> compiled_preset;
+        std::size_t const num_tree = concrete_model.trees.size();
+        compiled_preset.trees.reserve(num_tree);
+        for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+          compiled_preset.trees.push_back(CompileTree(concrete_model.trees[tree_id]));
+          auto& compiled_tree = compiled_preset.trees.back();
+          DetectFixedDepth(compiled_tree);
+          if (compact) {
+            BuildCompactNodes(compiled_tree);
+          }
+          // Uniform-operator numerical trees that are not complete (so the fixed-depth
+          // layout does not apply) keep an unpredictable branch per level in the scalar
+          // traversal; mark them for the predicated kernel instead
+          compiled_tree.branchless
+              = compiled_tree.simd_compatible && compiled_tree.fixed_depth < 0;
+        }
+        if (quantize) {
+          QuantizeTrees(compiled_preset, model.num_feature);
+        }
+        if (reduced_precision_leaf) {
+          ReduceLeafPrecision(compiled_preset);
+        }
+        // Deduplication runs last, so it can release every per-tree representation it
+        // supersedes for the trees it rewrites
+        if (deduplicate) {
+          DeduplicateTrees(compiled_preset);
+        }
+        // Assign a decoded-row slot to every feature read by some categorical test
+        impl_->cat_feature_slot.assign(model.num_feature, -1);
+        for (auto const& tree : compiled_preset.trees) {
+          for (std::size_t nid = 0; nid < tree.nodes.Size(); ++nid) {
+            auto const& node = tree.nodes[nid];
+            if (node.cleft != -1 && (node.bits & kCompiledNodeCategoricalMask)) {
+              auto const split_index = node.bits & kCompiledNodeSplitIndexMask;
+              if (impl_->cat_feature_slot[split_index] == -1) {
+                impl_->cat_feature_slot[split_index] = impl_->num_cat_feature++;
+              }
+            }
+          }
+        }
+        impl_->variant_ = std::move(compiled_preset);
+      },
+      model.variant_);
+}
+
+CompiledModel::~CompiledModel() = default;
+CompiledModel::CompiledModel(CompiledModel&&) noexcept = default;
+CompiledModel& CompiledModel::operator=(CompiledModel&&) noexcept = default;
+
+Model const& CompiledModel::GetSourceModel() const {
+  return *impl_->model;
+}
+
+}  // namespace treelite::gtil
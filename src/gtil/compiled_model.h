@@ -0,0 +1,257 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file compiled_model.h
+ * \author Hyunsu Cho
+ * \brief Flattened representation of tree ensembles, optimized for fast traversal
+ */
+
+#ifndef SRC_GTIL_COMPILED_MODEL_H_
+#define SRC_GTIL_COMPILED_MODEL_H_
+
+#include <treelite/contiguous_array.h>
+#include <treelite/enum/operator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <variant>
+#include <vector>
+
+namespace treelite {
+
+class Model;
+
+namespace gtil {
+
+/* Bit layout for CompiledNode::bits.
+ * Packing the per-node flags and the comparison operator into the split index field keeps
+ * everything needed to evaluate a test node within a single node record. */
+constexpr std::uint32_t kCompiledNodeDefaultLeftMask = 0x80000000U;
+constexpr std::uint32_t kCompiledNodeCategoricalMask = 0x40000000U;
+constexpr std::uint32_t kCompiledNodeCategoryListRightChildMask = 0x20000000U;
+constexpr std::uint32_t kCompiledNodeOperatorShift = 26;
+constexpr std::uint32_t kCompiledNodeOperatorMask = 0x7U;
+constexpr std::uint32_t kCompiledNodeSplitIndexMask = 0x03FFFFFFU;
+/* Sentinel for CompiledNode::aux, marking a leaf node with a scalar output */
+constexpr std::uint32_t kCompiledNodeInvalidAux = 0xFFFFFFFFU;
+/* Sentinel in a decoded category-code row: the feature value is missing or is not a valid
+ * category (negative, fractional beyond the representable range, or above uint32), so no
+ * category list matches it */
+constexpr std::uint32_t kInvalidCategoryCode = 0xFFFFFFFFU;
+/* Bit layout for CompactNode::bits: split index (bits 0-11), comparison operator
+ * (bits 12-14), default-left flag (bit 15). */
+constexpr std::uint16_t kCompactNodeDefaultLeftMask = 0x8000U;
+constexpr std::uint16_t kCompactNodeOperatorShift = 12;
+constexpr std::uint16_t kCompactNodeOperatorMask = 0x7U;
+constexpr std::uint16_t kCompactNodeSplitIndexMask = 0x0FFFU;
+/* Sentinel for a missing value in a quantized input row */
+constexpr std::uint16_t kQuantizedMissing = 0xFFFFU;
+/* Deepest complete tree served by the unrolled fixed-depth kernel */
+constexpr std::int32_t kMaxFixedDepth = 8;
+
+/*! \brief Decode a bfloat16 bit pattern to float32: the 16 bits become the high half */
+inline float Bfloat16ToFloat(std::uint16_t bits) {
+  std::uint32_t const word = static_cast<std::uint32_t>(bits) << 16;
+  float value;
+  std::memcpy(&value, &word, sizeof(value));
+  return value;
+}
+
+/*!
+ * \brief Round a float32 to the nearest bfloat16 bit pattern (round to nearest, ties to
+ *        even). Leaf values are always finite, so NaN payloads need no special handling.
+ */
+inline std::uint16_t FloatToBfloat16(float value) {
+  std::uint32_t word;
+  std::memcpy(&word, &value, sizeof(word));
+  std::uint32_t const rounding_bias = 0x7FFFU + ((word >> 16) & 1U);
+  return static_cast<std::uint16_t>((word + rounding_bias) >> 16);
+}
+
+/*!
+ * \brief Packed node record. All fields that are needed to evaluate a node are stored
+ *        contiguously, so that a node visit touches exactly one record.
+ */
+template <typename ThresholdT>
+struct CompiledNode {
+  /*! \brief Split threshold for a test node; scalar leaf output for a leaf node */
+  ThresholdT threshold_or_leaf_value;
+  /*! \brief ID of the left child node; -1 if this node is a leaf */
+  std::int32_t cleft;
+  /*! \brief ID of the right child node */
+  std::int32_t cright;
+  /*!
+   * \brief Split index (bits 0-25), comparison operator (bits 26-28) and flags (bits 29-31).
+   *        See the masks above for the exact layout.
+   */
+  std::uint32_t bits;
+  /*!
+   * \brief For a leaf node, offset of the leaf vector into CompiledTree::leaf_vector
+   *        (kCompiledNodeInvalidAux if the leaf output is a scalar). For a categorical test
+   *        node, ID of the category segment.
+   */
+  std::uint32_t aux;
+};
+
+/*!
+ * \brief Half-width node record: 16-bit split index / operator / default-left word and
+ *        16-bit child offsets relative to the node's own position, instead of the 32-bit
+ *        fields of CompiledNode. A left-child offset of 0 marks a leaf (an internal node can
+ *        never be its own left child). Fits models with < 4096 features and child offsets
+ *        within int16 range; the traversal working set per node shrinks from 20 to 12 bytes
+ *        (float thresholds), so more nodes share a cache line.
+ */
+template <typename ThresholdT>
+struct CompactNode {
+  /*! \brief Split threshold for a test node; unused for a leaf node */
+  ThresholdT threshold_or_leaf_value;
+  /*! \brief Offset of the left child relative to this node; 0 if this node is a leaf */
+  std::int16_t cleft_offset;
+  /*! \brief Offset of the right child relative to this node */
+  std::int16_t cright_offset;
+  /*! \brief Split index, comparison operator and default-left flag; see the masks above */
+  std::uint16_t bits;
+};
+
+/*! \brief A single tree, flattened into a contiguous array of packed node records */
+template <typename ThresholdT, typename LeafOutputT>
+struct CompiledTree {
+  ContiguousArray<CompiledNode<ThresholdT>> nodes;
+  /*! \brief Concatenated leaf vectors; indexed via CompiledNode::aux */
+  ContiguousArray<LeafOutputT> leaf_vector;
+  /*!
+   * \brief bfloat16-encoded leaf vectors, replacing leaf_vector when the model was compiled
+   *        with reduced leaf precision. Same layout and CompiledNode::aux indexing; values
+   *        are decoded to float on accumulation.
+   */
+  ContiguousArray<std::uint16_t> leaf_vector_half;
+  /*!
+   * \brief Concatenated category membership bitsets, one segment per categorical test node.
+   * Bit c of a segment is set iff category c is in the node's category list, so matching is
+   * a single word test instead of a scan over the category list. Segment boundaries are
+   * indexed via CompiledNode::aux.
+   */
+  ContiguousArray<std::uint64_t> category_bitset;
+  ContiguousArray<std::uint64_t> category_bitset_begin;
+  ContiguousArray<std::uint64_t> category_bitset_end;
+  /*!
+   * \brief Comparison operator shared by all numerical test nodes in this tree;
+   *        kNone if the tree mixes multiple operators
+   */
+  Operator uniform_operator{Operator::kNone};
+  /*!
+   * \brief Whether this tree can be evaluated with the vectorized multi-row kernel:
+   *        all test nodes are numerical with a uniform ordering operator, and all leaf
+   *        outputs are scalars
+   */
+  bool simd_compatible{false};
+  /*!
+   * \brief Whether the scalar traversal of this tree takes the predicated (branchless)
+   *        kernel: the comparison outcome, the missing-value policy, and the child select
+   *        are computed as integer masks, removing the data-dependent branch per level.
+   *        Set at compile time for trees whose tests are all numerical with a uniform
+   *        ordering operator and whose leaves are scalars, unless the fixed-depth layout
+   *        (which already descends without data-dependent branches) covers the tree.
+   */
+  bool branchless{false};
+  /*!
+   * \brief Quantized node records, present when the model was compiled with quantization and
+   *        this tree has no categorical test (category matching needs the raw feature value).
+   *        Thresholds are replaced with 16-bit bin ranks; see the note on
+   *        CompiledModelPreset::bin_boundaries for the encoding. Leaf payloads are not
+   *        duplicated: the traversal ends with one lookup into the full node record.
+   */
+  ContiguousArray<CompiledNode<std::uint16_t>> quantized_nodes;
+  /*!
+   * \brief Half-width node records, present when the model was compiled with the compact
+   *        encoding and this tree qualifies: purely numerical tests, scalar leaf outputs,
+   *        split indices under 4096, and child offsets of every internal node within int16
+   *        range. Node IDs coincide with those of the full records; the traversal ends with
+   *        one lookup into the full record for the leaf payload, like the quantized layout.
+   */
+  ContiguousArray<CompactNode<ThresholdT>> compact_nodes;
+  /*!
+   * \brief Specialized layout for a complete tree (every leaf at the same depth) that is
+   *        purely numerical with a uniform comparison operator and scalar leaves, e.g.
+   *        depth-limited XGBoost trees or oblivious CatBoost converts. Nodes sit in implicit
+   *        heap order (children of slot i at 2i+1 and 2i+2), so the fixed-depth kernel
+   *        descends with index arithmetic instead of pointer chasing and needs no per-node
+   *        leaf check. -1 when the tree does not qualify or is deeper than kMaxFixedDepth.
+   */
+  std::int32_t fixed_depth{-1};
+  /*! \brief Split index + default-left flag of each internal node, in heap order */
+  ContiguousArray<std::uint32_t> fixed_bits;
+  /*! \brief Threshold of each internal node, in heap order */
+  ContiguousArray<ThresholdT> fixed_threshold;
+  /*! \brief Scalar output of each leaf, indexed by (heap slot - number of internal nodes) */
+  ContiguousArray<LeafOutputT> fixed_leaf_value;
+  /*!
+   * \brief Slot of this tree's root in CompiledModelPreset::dedup_nodes, when the model was
+   *        compiled with subtree deduplication and this tree was eligible; -1 otherwise.
+   *        A deduplicated tree releases its private node arrays and is traversed through
+   *        the shared pool.
+   */
+  std::int32_t dedup_root{-1};
+};
+
+/*! \brief Typed portion of the compiled model */
+template <typename ThresholdT, typename LeafOutputT>
+struct CompiledModelPreset {
+  using threshold_type = ThresholdT;
+  using leaf_output_type = LeafOutputT;
+
+  std::vector<CompiledTree<ThresholdT, LeafOutputT>> trees;
+
+  /*!
+   * \brief Sorted distinct thresholds of each feature, concatenated; delimited per feature
+   *        by bin_begin / bin_end. Only present when the model was compiled with quantization.
+   *
+   * A threshold with rank r among its feature's boundaries is stored in the quantized node
+   * as 2r+1; an input value v is binned once per batch to
+   * (number of boundaries < v) + (number of boundaries <= v). The binned value is odd exactly
+   * when v hits a boundary, so every comparison operator (including equality) gives the same
+   * answer on the 16-bit ranks as on the raw values.
+   */
+  ContiguousArray<ThresholdT> bin_boundaries;
+  ContiguousArray<std::uint64_t> bin_begin;
+  ContiguousArray<std::uint64_t> bin_end;
+  /*! \brief Whether the quantized representation was built */
+  bool quantized{false};
+  /*! \brief Whether leaf vectors are stored as bfloat16 (see CompiledTree::leaf_vector_half) */
+  bool reduced_precision_leaf{false};
+  /*!
+   * \brief Ensemble-wide node pool shared by deduplicated trees: each structurally distinct
+   *        subtree is stored exactly once, and child IDs are pool-absolute, so a traversal
+   *        entering a shared subtree from any tree walks the same records. Populated only
+   *        when the model was compiled with subtree deduplication.
+   */
+  ContiguousArray<CompiledNode<ThresholdT>> dedup_nodes;
+  /*! \brief Whether the deduplication pass ran (see CompiledTree::dedup_root) */
+  bool deduplicated{false};
+};
+
+using CompiledModelPresetVariant
+    = std::variant<CompiledModelPreset<float, float>, CompiledModelPreset<double, double>>;
+
+/*! \brief Internal state of CompiledModel */
+struct CompiledModelImpl {
+  /*! \brief The model this object was compiled from. Must outlive this object. */
+  Model const* model;
+  CompiledModelPresetVariant variant_;
+  /*! \brief Length of each leaf vector, leaf_vector_shape[0] * leaf_vector_shape[1] */
+  std::uint32_t leaf_vector_length;
+  /*!
+   * \brief Slot of each feature in a decoded category-code row, or -1 for features that no
+   *        categorical test reads. When the model has categorical tests, each batch is
+   *        decoded once per block into validated uint32 codes (one column per slot), so the
+   *        traversal loop replaces the per-visit float validation and cast with one array
+   *        lookup.
+   */
+  std::vector<std::int32_t> cat_feature_slot;
+  /*! \brief Number of features read by categorical tests, i.e. number of decoded columns */
+  std::int32_t num_cat_feature{0};
+};
+
+}  // namespace gtil
+}  // namespace treelite
+
+#endif  // SRC_GTIL_COMPILED_MODEL_H_
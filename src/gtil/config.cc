@@ -39,6 +39,71 @@ Configuration::Configuration(std::string const& config_json) {
       TREELITE_CHECK(itr->value.IsInt()) << "nthread must be an integer";
       this->nthread = itr->value.GetInt();
     }
+    itr = parsed_config.FindMember("use_simd");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsBool()) << "use_simd must be a boolean";
+      this->use_simd = itr->value.GetBool();
+    }
+    itr = parsed_config.FindMember("use_fast_math");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsBool()) << "use_fast_math must be a boolean";
+      this->use_fast_math = itr->value.GetBool();
+    }
+    itr = parsed_config.FindMember("use_thread_pool");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsBool()) << "use_thread_pool must be a boolean";
+      this->use_thread_pool = itr->value.GetBool();
+    }
+    itr = parsed_config.FindMember("use_work_stealing");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsBool()) << "use_work_stealing must be a boolean";
+      this->use_work_stealing = itr->value.GetBool();
+    }
+    itr = parsed_config.FindMember("cascade_stage_size");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsUint64()) << "cascade_stage_size must be a non-negative integer";
+      this->cascade_stage_size = itr->value.GetUint64();
+    }
+    itr = parsed_config.FindMember("cascade_threshold_low");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsNumber()) << "cascade_threshold_low must be a number";
+      this->cascade_threshold_low = itr->value.GetDouble();
+    }
+    itr = parsed_config.FindMember("cascade_threshold_high");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsNumber()) << "cascade_threshold_high must be a number";
+      this->cascade_threshold_high = itr->value.GetDouble();
+    }
+    itr = parsed_config.FindMember("thread_affinity");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsString()) << "thread_affinity must be a string";
+      auto value = std::string(itr->value.GetString());
+      if (value == "none") {
+        this->thread_affinity = ThreadAffinity::kNone;
+      } else if (value == "compact") {
+        this->thread_affinity = ThreadAffinity::kCompact;
+      } else if (value == "scatter") {
+        this->thread_affinity = ThreadAffinity::kScatter;
+      } else if (value == "explicit") {
+        this->thread_affinity = ThreadAffinity::kExplicit;
+      } else {
+        TREELITE_LOG(FATAL) << "Unknown thread affinity policy: " << value;
+      }
+    }
+    itr = parsed_config.FindMember("affinity_cpu_list");
+    if (itr != parsed_config.MemberEnd()) {
+      TREELITE_CHECK(itr->value.IsArray()) << "affinity_cpu_list must be an array of integers";
+      for (auto const& e : itr->value.GetArray()) {
+        TREELITE_CHECK(e.IsInt()) << "affinity_cpu_list must be an array of integers";
+        int const cpu = e.GetInt();
+        TREELITE_CHECK_GE(cpu, 0) << "CPU IDs in affinity_cpu_list must be non-negative";
+        this->affinity_cpu_list.push_back(cpu);
+      }
+    }
+    if (this->thread_affinity == ThreadAffinity::kExplicit) {
+      TREELITE_CHECK(!this->affinity_cpu_list.empty())
+          << "Thread affinity policy \"explicit\" requires a non-empty affinity_cpu_list";
+    }
   } else {
     TREELITE_LOG(FATAL) << "The JSON string must be a valid JSON object";
   }
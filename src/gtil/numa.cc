@@ -0,0 +1,122 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file numa.cc
+ * \author Hyunsu Cho
+ * \brief NUMA topology detection and per-node model replication for GTIL
+ */
+#include "./numa.h"
+
+#include <treelite/gtil.h>
+#include <treelite/logging.h>
+#include <treelite/tree.h>
+
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace treelite {
+namespace gtil {
+
+NumaTopology NumaTopology::Detect() {
+  NumaTopology topology;
+#ifdef __linux__
+  for (int node = 0;; ++node) {
+    std::ifstream cpulist(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!cpulist) {
+      break;
+    }
+    std::string line;
+    std::getline(cpulist, line);
+    // The list has the form "0-15,32-47"; each element is a CPU ID or an inclusive range
+    std::istringstream tokens(line);
+    std::string token;
+    while (std::getline(tokens, token, ',')) {
+      if (token.empty()) {
+        continue;
+      }
+      std::size_t const dash = token.find('-');
+      int const first = std::stoi(token.substr(0, dash));
+      int const last = (dash == std::string::npos) ? first : std::stoi(token.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu) {
+        if (cpu >= static_cast<int>(topology.cpu_to_node.size())) {
+          topology.cpu_to_node.resize(cpu + 1, 0);
+        }
+        topology.cpu_to_node[cpu] = node;
+      }
+    }
+    topology.num_node = node + 1;
+  }
+#endif
+  if (topology.num_node < 1) {
+    topology.num_node = 1;
+  }
+  return topology;
+}
+
+NumaReplicatedModelImpl::NumaReplicatedModelImpl(Model const& model)
+    : source(&model), topology(NumaTopology::Detect()) {
+  if (topology.num_node <= 1) {
+    return;  // Single node: every thread's local memory already holds the one copy
+  }
+  replicas.resize(topology.num_node);
+  for (int node = 0; node < topology.num_node; ++node) {
+    // Clone from a thread pinned to the node, so that the first-touch policy places the
+    // clone's tree arrays in the node's local memory
+    std::thread cloner([this, node] {
+#ifdef __linux__
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      for (std::size_t cpu = 0; cpu < topology.cpu_to_node.size(); ++cpu) {
+        if (topology.cpu_to_node[cpu] == node) {
+          CPU_SET(cpu, &cpuset);
+        }
+      }
+      // Best effort; an unpinnable thread still produces a correct (if remote) clone
+      sched_setaffinity(0, sizeof(cpu_set_t), &cpuset);
+#endif
+      std::vector<Model const*> to_clone{source};
+      replicas[node] = ConcatenateModelObjects(to_clone);
+    });
+    cloner.join();
+  }
+}
+
+Model const& NumaReplicatedModelImpl::LocalReplica() const {
+#ifdef __linux__
+  int const cpu = sched_getcpu();
+  if (cpu >= 0 && cpu < static_cast<int>(topology.cpu_to_node.size())) {
+    int const node = topology.cpu_to_node[cpu];
+    if (node >= 0 && node < static_cast<int>(replicas.size()) && replicas[node]) {
+      return *replicas[node];
+    }
+  }
+#endif
+  return *source;
+}
+
+NumaReplicatedModel::NumaReplicatedModel(Model const& model)
+    : impl_{std::make_unique<NumaReplicatedModelImpl>(model)} {}
+
+NumaReplicatedModel::~NumaReplicatedModel() = default;
+NumaReplicatedModel::NumaReplicatedModel(NumaReplicatedModel&&) noexcept = default;
+NumaReplicatedModel& NumaReplicatedModel::operator=(NumaReplicatedModel&&) noexcept = default;
+
+Model const& NumaReplicatedModel::GetSourceModel() const {
+  return *impl_->source;
+}
+
+int NumaReplicatedModel::GetNumNode() const {
+  return impl_->topology.num_node;
+}
+
+}  // namespace gtil
+}  // namespace treelite
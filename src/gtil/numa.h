@@ -0,0 +1,56 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file numa.h
+ * \author Hyunsu Cho
+ * \brief NUMA topology detection and per-node model replication for GTIL
+ */
+
+#ifndef SRC_GTIL_NUMA_H_
+#define SRC_GTIL_NUMA_H_
+
+#include <treelite/tree.h>
+
+#include <memory>
+#include <vector>
+
+namespace treelite {
+namespace gtil {
+
+/*!
+ * \brief NUMA topology of the host, detected from the operating system. On non-Linux
+ *        platforms, or when detection fails, the host is treated as a single node.
+ */
+struct NumaTopology {
+  /*! \brief Number of NUMA nodes */
+  int num_node{1};
+  /*! \brief Node of each logical CPU, indexed by CPU ID */
+  std::vector<int> cpu_to_node{};
+  /*! \brief Detect the topology (parses /sys/devices/system/node on Linux) */
+  static NumaTopology Detect();
+};
+
+/*! \brief Internal state of NumaReplicatedModel */
+struct NumaReplicatedModelImpl {
+  /*! \brief The model replication was requested for */
+  Model const* source;
+  /*! \brief Detected host topology */
+  NumaTopology topology;
+  /*!
+   * \brief One deep clone of the source model per NUMA node. Each clone is allocated by a
+   *        thread pinned to its node, so the first-touch policy places the tree arrays in
+   *        that node's local memory. Empty when the host has a single node.
+   */
+  std::vector<std::unique_ptr<Model>> replicas;
+
+  explicit NumaReplicatedModelImpl(Model const& model);
+  /*!
+   * \brief The replica local to the CPU the calling thread is currently running on, or the
+   *        source model when the thread's node has no replica.
+   */
+  Model const& LocalReplica() const;
+};
+
+}  // namespace gtil
+}  // namespace treelite
+
+#endif  // SRC_GTIL_NUMA_H_
@@ -8,6 +8,7 @@
 #ifndef SRC_GTIL_POSTPROCESSOR_H_
 #define SRC_GTIL_POSTPROCESSOR_H_
 
+#include <cstdint>
 #include <string>
 
 namespace treelite {
@@ -19,11 +20,26 @@ namespace gtil {
 template <typename InputT>
 using PostProcessorFunc = void (*)(treelite::Model const&, std::int32_t, InputT*);
 
+/*!
+ * \brief Batch variant of PostProcessorFunc, processing a contiguous (num_row, num_class)
+ *        block in one call. Arguments: model, num_class, num_row, block. The batch kernels
+ *        replace std::exp with a vectorization-friendly polynomial approximation, so
+ *        results may differ from the row-at-a-time kernels by a few ulps.
+ */
+template <typename InputT>
+using PostProcessorBatchFunc
+    = void (*)(treelite::Model const&, std::int32_t, std::uint64_t, InputT*);
+
 template <typename InputT>
 PostProcessorFunc<InputT> GetPostProcessorFunc(std::string const& name);
 
+template <typename InputT>
+PostProcessorBatchFunc<InputT> GetPostProcessorBatchFunc(std::string const& name);
+
 extern template PostProcessorFunc<float> GetPostProcessorFunc(std::string const& name);
 extern template PostProcessorFunc<double> GetPostProcessorFunc(std::string const& name);
+extern template PostProcessorBatchFunc<float> GetPostProcessorBatchFunc(std::string const& name);
+extern template PostProcessorBatchFunc<double> GetPostProcessorBatchFunc(std::string const& name);
 
 }  // namespace gtil
 }  // namespace treelite
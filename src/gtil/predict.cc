@@ -8,18 +8,28 @@
 #include <treelite/detail/threading_utils.h>
 #include <treelite/gtil.h>
 #include <treelite/logging.h>
+#include <treelite/trace.h>
 #include <treelite/tree.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <experimental/mdspan>
+#include <functional>
+#include <future>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
+#include "./compiled_model.h"
+#include "./numa.h"
 #include "./postprocessor.h"
+#include "./scratch.h"
+#include "./simd.h"
 
 namespace treelite::gtil {
 
@@ -38,37 +48,84 @@ template <typename ElemT>
 using CArray2DView
     = stdex::mdspan<ElemT const, stdex::dextents<std::uint64_t, 2>, stdex::layout_right>;
 
+/*!
+ * \brief 2-D view of a column-major (Arrow-style columnar) input matrix, indexed as
+ *        (row, feature) like CArray2DView; one feature's column is contiguous and a row
+ *        is a strided slice. The traversal loops are generic over the view's layout, so
+ *        columnar batches are consumed in place without a transpose.
+ */
+template <typename ElemT>
+using CColMajorArray2DView
+    = stdex::mdspan<ElemT const, stdex::dextents<std::uint64_t, 2>, stdex::layout_left>;
+
+/*!
+ * \brief 2-D view of a dense input matrix with arbitrary row and element strides, indexed
+ *        as (row, feature) like CArray2DView. Used to score rows embedded in larger
+ *        fixed-stride records (e.g. wire-format buffers) in place, without a compacting
+ *        copy.
+ */
+template <typename ElemT>
+using CStridedArray2DView
+    = stdex::mdspan<ElemT const, stdex::dextents<std::uint64_t, 2>, stdex::layout_stride>;
+
+/* Tile sizes for the blocked traversal in PredictRaw. Rows are processed in blocks against
+ * blocks of trees, so that a hot tree block stays resident in cache across the rows of a block
+ * instead of the whole ensemble being streamed through cache once per row. Each thread works on
+ * whole row blocks, composing with the ParallelFor row partitioning. */
+constexpr std::uint64_t kRowBlockSize = 64;
+constexpr std::size_t kTreeBlockSize = 64;
+
 template <typename InputT, typename ThresholdT>
-inline int NextNode(
-    InputT fvalue, ThresholdT threshold, Operator op, int left_child, int right_child) {
-  static_assert(std::is_floating_point_v<InputT>, "Expected floating point type for input");
-  bool cond = false;
+inline bool CompareValue(InputT fvalue, ThresholdT threshold, Operator op) {
   switch (op) {
   case Operator::kLT:
-    cond = fvalue < threshold;
-    break;
+    return fvalue < threshold;
   case Operator::kLE:
-    cond = fvalue <= threshold;
-    break;
+    return fvalue <= threshold;
   case Operator::kEQ:
-    cond = fvalue == threshold;
-    break;
+    return fvalue == threshold;
   case Operator::kGT:
-    cond = fvalue > threshold;
-    break;
+    return fvalue > threshold;
   case Operator::kGE:
-    cond = fvalue >= threshold;
-    break;
+    return fvalue >= threshold;
   default:
     TREELITE_CHECK(false) << "Unrecognized comparison operator " << static_cast<int>(op);
-    return -1;
+    return false;
+  }
+}
+
+/*!
+ * \brief CompareValue with the operator fixed at compile time, so the comparison inlines to
+ *        a single instruction with no switch. Used by kernels that are specialized per tree
+ *        on a uniform operator.
+ */
+template <Operator kOp, typename InputT, typename ThresholdT>
+inline bool CompareValueFixed(InputT fvalue, ThresholdT threshold) {
+  if constexpr (kOp == Operator::kLT) {
+    return fvalue < threshold;
+  } else if constexpr (kOp == Operator::kLE) {
+    return fvalue <= threshold;
+  } else if constexpr (kOp == Operator::kGT) {
+    return fvalue > threshold;
+  } else if constexpr (kOp == Operator::kGE) {
+    return fvalue >= threshold;
+  } else {
+    static_assert(kOp == Operator::kEQ, "Unrecognized comparison operator");
+    return fvalue == threshold;
   }
-  return (cond ? left_child : right_child);
+}
+
+template <typename InputT, typename ThresholdT>
+inline int NextNode(
+    InputT fvalue, ThresholdT threshold, Operator op, int left_child, int right_child) {
+  static_assert(std::is_floating_point_v<InputT>, "Expected floating point type for input");
+  return (CompareValue(fvalue, threshold, op) ? left_child : right_child);
 }
 
 template <typename InputT>
-inline int NextNodeCategorical(InputT fvalue, std::vector<std::uint32_t> const& category_list,
-    bool category_list_right_child, int left_child, int right_child) {
+inline int NextNodeCategorical(InputT fvalue, std::uint32_t const* category_list_begin,
+    std::uint32_t const* category_list_end, bool category_list_right_child, int left_child,
+    int right_child) {
   static_assert(std::is_floating_point_v<InputT>, "Expected floating point type for input");
   bool category_matched;
   // A valid (integer) category must satisfy two criteria:
@@ -81,8 +138,8 @@ inline int NextNodeCategorical(InputT fvalue, std::vector<std::uint32_t> const&
     category_matched = false;
   } else {
     auto const category_value = static_cast<std::uint32_t>(fvalue);
-    category_matched = (std::find(category_list.begin(), category_list.end(), category_value)
-                        != category_list.end());
+    category_matched
+        = (std::find(category_list_begin, category_list_end, category_value) != category_list_end);
   }
   if (category_list_right_child) {
     return category_matched ? right_child : left_child;
@@ -91,17 +148,120 @@ inline int NextNodeCategorical(InputT fvalue, std::vector<std::uint32_t> const&
   }
 }
 
-template <typename ThresholdT, typename LeafOutputT, typename InputT>
-int EvaluateTree(Tree<ThresholdT, LeafOutputT> const& tree, Array1DView<InputT> row) {
+/*!
+ * \brief Match a feature value against a category membership bitset: a single word test,
+ *        with the same input validation as NextNodeCategorical and no allocation.
+ */
+template <typename InputT>
+inline bool CategoryMatches(InputT fvalue, std::uint64_t const* bitset, std::uint64_t num_words) {
+  static_assert(std::is_floating_point_v<InputT>, "Expected floating point type for input");
+  // A valid (integer) category must satisfy two criteria:
+  // 1) it must be exactly representable as InputT (float or double)
+  // 2) it must fit into uint32_t
+  auto max_representable_int
+      = std::min(static_cast<InputT>(std::numeric_limits<std::uint32_t>::max()),
+          static_cast<InputT>(std::uint64_t(1) << std::numeric_limits<InputT>::digits));
+  if (fvalue < 0 || std::fabs(fvalue) > max_representable_int) {
+    return false;
+  }
+  auto const category_value = static_cast<std::uint32_t>(fvalue);
+  if (category_value >= num_words * 64) {
+    return false;
+  }
+  return ((bitset[category_value / 64] >> (category_value % 64)) & 1) != 0;
+}
+
+/*!
+ * \brief Decode one feature value into a validated category code, with the same input
+ *        validation as NextNodeCategorical. Missing and invalid values both map to
+ *        kInvalidCategoryCode: no category list matches them, and the missing-value branch
+ *        is taken from the raw feature value before the code is ever consulted.
+ */
+template <typename InputT>
+inline std::uint32_t DecodeCategoryCode(InputT fvalue) {
+  static_assert(std::is_floating_point_v<InputT>, "Expected floating point type for input");
+  auto max_representable_int
+      = std::min(static_cast<InputT>(std::numeric_limits<std::uint32_t>::max()),
+          static_cast<InputT>(std::uint64_t(1) << std::numeric_limits<InputT>::digits));
+  if (std::isnan(fvalue) || fvalue < 0 || std::fabs(fvalue) > max_representable_int) {
+    return kInvalidCategoryCode;
+  }
+  return static_cast<std::uint32_t>(fvalue);
+}
+
+/*!
+ * \brief Decode the categorical feature columns of rows [row_begin, row_end) once into
+ *        validated uint32 codes, one column per slot of CompiledModelImpl::cat_feature_slot.
+ *        The traversal loop then matches a category with one array lookup and one bitset
+ *        word test per node visit, instead of re-validating the float value each time.
+ */
+template <typename InputT>
+void DecodeCategoryRows(CompiledModelImpl const& compiled, CArray2DView<InputT> input_view,
+    std::uint64_t row_begin, std::uint64_t row_end, std::uint32_t* codes) {
+  auto const num_feature = static_cast<std::int32_t>(input_view.extent(1));
+  for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+    std::uint32_t* codes_row = codes + (row_id - row_begin) * compiled.num_cat_feature;
+    for (std::int32_t fid = 0; fid < num_feature; ++fid) {
+      std::int32_t const slot = compiled.cat_feature_slot[fid];
+      if (slot >= 0) {
+        codes_row[slot] = DecodeCategoryCode(input_view(row_id, fid));
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Match a pre-decoded category code against a category membership bitset. The code
+ *        comes from DecodeCategoryRows, so only the bounds test against the bitset length
+ *        remains; kInvalidCategoryCode is out of bounds of every bitset by construction.
+ */
+inline bool CategoryCodeMatches(
+    std::uint32_t code, std::uint64_t const* bitset, std::uint64_t num_words) {
+  if (code >= num_words * 64) {
+    return false;
+  }
+  return ((bitset[code / 64] >> (code % 64)) & 1) != 0;
+}
+
+/*!
+ * \brief Per-thread traversal counters, collected only when prediction statistics are
+ *        requested. Padded so that neighboring threads do not share a cache line.
+ */
+struct alignas(64) TraversalCounters {
+  std::uint64_t num_tree_traversal{0};
+  std::uint64_t num_node_visit{0};
+  std::uint64_t num_missing_branch{0};
+  std::uint64_t num_categorical_visit{0};
+};
+
+// The row may be a contiguous slice of a row-major matrix or a strided slice of a
+// column-major one; the traversal only indexes it by split index.
+// kNoMissing compiles the per-node missing-value check out entirely, for batches that
+// carry an all-valid guarantee; a NaN fed to such an instantiation takes the not-matched
+// branch of whatever comparison it meets, not the default-child branch.
+template <bool kCollectStats = false, bool kNoMissing = false, typename ThresholdT,
+    typename LeafOutputT, typename RowViewT>
+int EvaluateTree(Tree<ThresholdT, LeafOutputT> const& tree, RowViewT row,
+    TraversalCounters* counters = nullptr) {
   int node_id = 0;
   while (!tree.IsLeaf(node_id)) {
     auto const split_index = tree.SplitIndex(node_id);
-    InputT const fvalue = row(split_index);
-    if (std::isnan(fvalue)) {
+    auto const fvalue = row(split_index);
+    if constexpr (kCollectStats) {
+      ++counters->num_node_visit;
+      if (std::isnan(fvalue)) {
+        ++counters->num_missing_branch;
+      }
+      if (tree.NodeType(node_id) == treelite::TreeNodeType::kCategoricalTestNode) {
+        ++counters->num_categorical_visit;
+      }
+    }
+    if (!kNoMissing && std::isnan(fvalue)) {
       node_id = tree.DefaultChild(node_id);
     } else {
       if (tree.NodeType(node_id) == treelite::TreeNodeType::kCategoricalTestNode) {
-        node_id = NextNodeCategorical(fvalue, tree.CategoryList(node_id),
+        auto const [category_list, category_list_len] = tree.CategoryListSpan(node_id);
+        node_id = NextNodeCategorical(fvalue, category_list, category_list + category_list_len,
             tree.CategoryListRightChild(node_id), tree.LeftChild(node_id),
             tree.RightChild(node_id));
       } else {
@@ -113,16 +273,373 @@ int EvaluateTree(Tree<ThresholdT, LeafOutputT> const& tree, Array1DView<InputT>
   return node_id;
 }
 
+/*!
+ * \brief Evaluate a compiled (flattened) tree on a single row.
+ * The traversal only touches the packed node records; leaf vectors and category lists are
+ * stored in side arrays, indexed via CompiledNode::aux.
+ */
 template <typename ThresholdT, typename LeafOutputT, typename InputT>
-void OutputLeafVector(Model const& model, Tree<ThresholdT, LeafOutputT> const& tree, int tree_id,
-    int leaf_id, std::uint64_t row_id, std::int32_t max_num_class,
-    Array3DView<InputT> output_view) {
-  auto leaf_out = tree.LeafVector(leaf_id);
+int EvaluateTree(CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row,
+    std::uint32_t const* cat_codes = nullptr, std::int32_t const* cat_slot = nullptr) {
+  CompiledNode<ThresholdT> const* nodes = tree.nodes.Data();
+  int node_id = 0;
+  for (;;) {
+    CompiledNode<ThresholdT> const& node = nodes[node_id];
+    if (node.cleft == -1) {  // leaf
+      break;
+    }
+    std::uint32_t const bits = node.bits;
+    InputT const fvalue = row(bits & kCompiledNodeSplitIndexMask);
+    if (std::isnan(fvalue)) {
+      node_id = (bits & kCompiledNodeDefaultLeftMask) ? node.cleft : node.cright;
+    } else if (bits & kCompiledNodeCategoricalMask) {
+      std::uint64_t const word_begin = tree.category_bitset_begin[node.aux];
+      std::uint64_t const num_words = tree.category_bitset_end[node.aux] - word_begin;
+      bool const category_matched
+          = cat_codes ? CategoryCodeMatches(cat_codes[cat_slot[bits & kCompiledNodeSplitIndexMask]],
+                tree.category_bitset.Data() + word_begin, num_words)
+                      : CategoryMatches(
+                          fvalue, tree.category_bitset.Data() + word_begin, num_words);
+      bool const category_list_right_child
+          = (bits & kCompiledNodeCategoryListRightChildMask) != 0;
+      node_id = (category_matched == category_list_right_child) ? node.cright : node.cleft;
+    } else {
+      auto const op = static_cast<Operator>(
+          (bits >> kCompiledNodeOperatorShift) & kCompiledNodeOperatorMask);
+      node_id = NextNode(fvalue, node.threshold_or_leaf_value, op, node.cleft, node.cright);
+    }
+  }
+  return node_id;
+}
+
+/*!
+ * \brief Evaluate a deduplicated tree against the ensemble-wide shared node pool. Child
+ *        IDs are pool-absolute, so a traversal entering a shared subtree from any tree
+ *        walks the same records. Only purely numerical scalar-leaf trees are deduplicated,
+ *        so no category or leaf-vector lookup occurs; the returned ID is the leaf's pool
+ *        slot.
+ */
+template <typename ThresholdT, typename InputT>
+int EvaluateTreeShared(
+    CompiledNode<ThresholdT> const* pool, std::int32_t root, CArray1DView<InputT> row) {
+  int node_id = root;
+  for (;;) {
+    CompiledNode<ThresholdT> const& node = pool[node_id];
+    if (node.cleft == -1) {  // leaf
+      break;
+    }
+    std::uint32_t const bits = node.bits;
+    InputT const fvalue = row(bits & kCompiledNodeSplitIndexMask);
+    if (std::isnan(fvalue)) {
+      node_id = (bits & kCompiledNodeDefaultLeftMask) ? node.cleft : node.cright;
+    } else {
+      auto const op = static_cast<Operator>(
+          (bits >> kCompiledNodeOperatorShift) & kCompiledNodeOperatorMask);
+      node_id = NextNode(fvalue, node.threshold_or_leaf_value, op, node.cleft, node.cright);
+    }
+  }
+  return node_id;
+}
+
+/*!
+ * \brief Evaluate a purely numerical uniform-operator tree with predicated (branchless)
+ *        traversal. The comparison outcome, the missing-value policy, and the child select
+ *        are all computed as integer masks, so the only data-dependent branch left is the
+ *        loop exit: on deep trees with unpredictable splits this trades a branch miss per
+ *        level for a handful of ALU ops. NaN makes every ordering comparison false, which
+ *        the default-left mask then overrides, reproducing the DefaultChild policy of the
+ *        generic traversal.
+ */
+template <Operator kOp, typename ThresholdT, typename LeafOutputT, typename InputT>
+int EvaluateTreeBranchless(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row) {
+  CompiledNode<ThresholdT> const* nodes = tree.nodes.Data();
+  int node_id = 0;
+  for (;;) {
+    CompiledNode<ThresholdT> const& node = nodes[node_id];
+    if (node.cleft == -1) {  // leaf
+      break;
+    }
+    std::uint32_t const bits = node.bits;
+    InputT const fvalue = row(bits & kCompiledNodeSplitIndexMask);
+    // -1 (all bits set) when the condition holds, 0 otherwise
+    int const missing_mask = -static_cast<int>(std::isnan(fvalue));
+    int const matched_mask
+        = -static_cast<int>(CompareValueFixed<kOp>(fvalue, node.threshold_or_leaf_value));
+    int const default_left_mask
+        = -static_cast<int>((bits & kCompiledNodeDefaultLeftMask) != 0);
+    int const go_left_mask = (missing_mask & default_left_mask) | (~missing_mask & matched_mask);
+    node_id = (node.cleft & go_left_mask) | (node.cright & ~go_left_mask);
+  }
+  return node_id;
+}
+
+/*! \brief Select the branchless kernel instantiated for the tree's uniform operator */
+template <typename ThresholdT, typename LeafOutputT, typename InputT>
+inline int EvaluateTreeBranchlessDispatch(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row) {
+  switch (tree.uniform_operator) {
+  case Operator::kLT:
+    return EvaluateTreeBranchless<Operator::kLT>(tree, row);
+  case Operator::kLE:
+    return EvaluateTreeBranchless<Operator::kLE>(tree, row);
+  case Operator::kGT:
+    return EvaluateTreeBranchless<Operator::kGT>(tree, row);
+  case Operator::kGE:
+    return EvaluateTreeBranchless<Operator::kGE>(tree, row);
+  default:
+    TREELITE_CHECK(false) << "Tree was marked branchless with operator "
+                          << OperatorToString(tree.uniform_operator);
+    return -1;
+  }
+}
+
+/*! \brief Hint the hardware to start loading the cache line holding ptr */
+inline void PrefetchRead(void const* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr, /*rw=*/0, /*locality=*/3);
+#else
+  (void)ptr;
+#endif
+}
+
+/*! \brief Number of rows advanced through a tree in lockstep by the interleaved kernel */
+constexpr std::uint64_t kInterleaveRowGroupSize = 8;
+
+/*!
+ * \brief Advance kInterleaveRowGroupSize rows through one branchless tree in lockstep,
+ *        prefetching each row's next node while the other rows are evaluated. A single row
+ *        walks a chain of dependent loads, so on out-of-cache ensembles every level costs a
+ *        full memory round trip with nothing else in flight; interleaving keeps several
+ *        independent miss chains outstanding and hides most of that latency. Rows that reach
+ *        a leaf early simply sit out the remaining rounds.
+ */
+template <Operator kOp, typename ThresholdT, typename LeafOutputT, typename InputT>
+void EvaluateTreeBranchlessInterleaved(CompiledTree<ThresholdT, LeafOutputT> const& tree,
+    CArray2DView<InputT> input_view, std::uint64_t row_begin, int* leaf_ids) {
+  CompiledNode<ThresholdT> const* nodes = tree.nodes.Data();
+  int node_id[kInterleaveRowGroupSize] = {};  // every row starts at the root
+  for (;;) {
+    std::uint64_t advanced = 0;
+    for (std::uint64_t lane = 0; lane < kInterleaveRowGroupSize; ++lane) {
+      CompiledNode<ThresholdT> const& node = nodes[node_id[lane]];
+      if (node.cleft == -1) {  // row already parked at a leaf
+        continue;
+      }
+      std::uint32_t const bits = node.bits;
+      InputT const fvalue = input_view(row_begin + lane, bits & kCompiledNodeSplitIndexMask);
+      // Same predicated child select as EvaluateTreeBranchless
+      int const missing_mask = -static_cast<int>(std::isnan(fvalue));
+      int const matched_mask
+          = -static_cast<int>(CompareValueFixed<kOp>(fvalue, node.threshold_or_leaf_value));
+      int const default_left_mask
+          = -static_cast<int>((bits & kCompiledNodeDefaultLeftMask) != 0);
+      int const go_left_mask
+          = (missing_mask & default_left_mask) | (~missing_mask & matched_mask);
+      int const next_id = (node.cleft & go_left_mask) | (node.cright & ~go_left_mask);
+      node_id[lane] = next_id;
+      PrefetchRead(&nodes[next_id]);
+      ++advanced;
+    }
+    if (advanced == 0) {  // every row has reached a leaf
+      break;
+    }
+  }
+  for (std::uint64_t lane = 0; lane < kInterleaveRowGroupSize; ++lane) {
+    leaf_ids[lane] = node_id[lane];
+  }
+}
+
+/*! \brief Select the interleaved kernel instantiated for the tree's uniform operator */
+template <typename ThresholdT, typename LeafOutputT, typename InputT>
+inline void EvaluateTreeBranchlessInterleavedDispatch(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray2DView<InputT> input_view,
+    std::uint64_t row_begin, int* leaf_ids) {
+  switch (tree.uniform_operator) {
+  case Operator::kLT:
+    EvaluateTreeBranchlessInterleaved<Operator::kLT>(tree, input_view, row_begin, leaf_ids);
+    break;
+  case Operator::kLE:
+    EvaluateTreeBranchlessInterleaved<Operator::kLE>(tree, input_view, row_begin, leaf_ids);
+    break;
+  case Operator::kGT:
+    EvaluateTreeBranchlessInterleaved<Operator::kGT>(tree, input_view, row_begin, leaf_ids);
+    break;
+  case Operator::kGE:
+    EvaluateTreeBranchlessInterleaved<Operator::kGE>(tree, input_view, row_begin, leaf_ids);
+    break;
+  default:
+    TREELITE_CHECK(false) << "Tree was marked branchless with operator "
+                          << OperatorToString(tree.uniform_operator);
+  }
+}
+
+/*!
+ * \brief Evaluate a tree stored as half-width compact records. Same traversal as
+ *        EvaluateTree, restricted to the purely numerical scalar-leaf case the encoding
+ *        supports; children are reached by adding a signed 16-bit offset to the current node
+ *        ID, so the IDs coincide with the full records and the leaf payload is read there.
+ */
+template <typename ThresholdT, typename LeafOutputT, typename InputT>
+int EvaluateTreeCompact(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row) {
+  CompactNode<ThresholdT> const* nodes = tree.compact_nodes.Data();
+  int node_id = 0;
+  for (;;) {
+    CompactNode<ThresholdT> const& node = nodes[node_id];
+    if (node.cleft_offset == 0) {  // leaf
+      break;
+    }
+    std::uint16_t const bits = node.bits;
+    InputT const fvalue = row(bits & kCompactNodeSplitIndexMask);
+    bool go_left;
+    if (std::isnan(fvalue)) {
+      go_left = (bits & kCompactNodeDefaultLeftMask) != 0;
+    } else {
+      auto const op = static_cast<Operator>(
+          (bits >> kCompactNodeOperatorShift) & kCompactNodeOperatorMask);
+      go_left = CompareValue(fvalue, node.threshold_or_leaf_value, op);
+    }
+    node_id += go_left ? node.cleft_offset : node.cright_offset;
+  }
+  return node_id;
+}
+
+/*!
+ * \brief Evaluate a complete fixed-depth tree, specialized for a compile-time depth. The
+ *        node arrays are in implicit heap order, so each level is a pure index computation
+ *        with no leaf check, and the loop unrolls fully since Depth is a template parameter.
+ */
+template <int Depth, typename ThresholdT, typename LeafOutputT, typename InputT>
+inline LeafOutputT EvaluateTreeFixedDepth(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row) {
+  std::uint32_t const* bits_arr = tree.fixed_bits.Data();
+  ThresholdT const* thresholds = tree.fixed_threshold.Data();
+  Operator const op = tree.uniform_operator;
+  std::uint32_t node = 0;
+  for (int level = 0; level < Depth; ++level) {
+    std::uint32_t const bits = bits_arr[node];
+    InputT const fvalue = row(bits & kCompiledNodeSplitIndexMask);
+    bool const go_left = std::isnan(fvalue) ? (bits & kCompiledNodeDefaultLeftMask) != 0
+                                            : CompareValue(fvalue, thresholds[node], op);
+    node = 2 * node + 2 - static_cast<std::uint32_t>(go_left);
+  }
+  return tree.fixed_leaf_value[node - ((std::uint32_t(1) << Depth) - 1)];
+}
+
+template <typename ThresholdT, typename LeafOutputT, typename InputT>
+inline LeafOutputT EvaluateTreeFixedDepthDispatch(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, CArray1DView<InputT> row) {
+  switch (tree.fixed_depth) {
+  case 1:
+    return EvaluateTreeFixedDepth<1>(tree, row);
+  case 2:
+    return EvaluateTreeFixedDepth<2>(tree, row);
+  case 3:
+    return EvaluateTreeFixedDepth<3>(tree, row);
+  case 4:
+    return EvaluateTreeFixedDepth<4>(tree, row);
+  case 5:
+    return EvaluateTreeFixedDepth<5>(tree, row);
+  case 6:
+    return EvaluateTreeFixedDepth<6>(tree, row);
+  case 7:
+    return EvaluateTreeFixedDepth<7>(tree, row);
+  case 8:
+    return EvaluateTreeFixedDepth<8>(tree, row);
+  default:
+    TREELITE_CHECK(false) << "Invalid fixed depth " << tree.fixed_depth;
+    return LeafOutputT{};
+  }
+}
+
+/*!
+ * \brief Evaluate a quantized tree on a pre-binned row. Same traversal as the compiled
+ *        tree, but comparisons run on 16-bit bin ranks, so the working set per node is a
+ *        fraction of the full-precision record. Missing values are marked with the
+ *        kQuantizedMissing sentinel during binning, since NaN has no 16-bit encoding.
+ */
+template <typename ThresholdT, typename LeafOutputT>
+int EvaluateTreeQuantized(
+    CompiledTree<ThresholdT, LeafOutputT> const& tree, std::uint16_t const* row) {
+  CompiledNode<std::uint16_t> const* nodes = tree.quantized_nodes.Data();
+  int node_id = 0;
+  for (;;) {
+    CompiledNode<std::uint16_t> const& node = nodes[node_id];
+    if (node.cleft == -1) {  // leaf
+      break;
+    }
+    std::uint32_t const bits = node.bits;
+    std::uint16_t const fvalue = row[bits & kCompiledNodeSplitIndexMask];
+    if (fvalue == kQuantizedMissing) {
+      node_id = (bits & kCompiledNodeDefaultLeftMask) ? node.cleft : node.cright;
+    } else {
+      auto const op = static_cast<Operator>(
+          (bits >> kCompiledNodeOperatorShift) & kCompiledNodeOperatorMask);
+      std::uint16_t const threshold = node.threshold_or_leaf_value;
+      bool cond = false;
+      switch (op) {
+      case Operator::kLT:
+        cond = fvalue < threshold;
+        break;
+      case Operator::kLE:
+        cond = fvalue <= threshold;
+        break;
+      case Operator::kEQ:
+        cond = fvalue == threshold;
+        break;
+      case Operator::kGT:
+        cond = fvalue > threshold;
+        break;
+      case Operator::kGE:
+        cond = fvalue >= threshold;
+        break;
+      default:
+        TREELITE_CHECK(false) << "Unrecognized comparison operator " << static_cast<int>(op);
+      }
+      node_id = cond ? node.cleft : node.cright;
+    }
+  }
+  return node_id;
+}
+
+/*!
+ * \brief Bin a range of input rows against the per-feature bin boundaries. A value v maps to
+ *        (number of boundaries < v) + (number of boundaries <= v), so that every comparison
+ *        operator gives the same answer on the ranks as on the raw values; NaN maps to the
+ *        missing-value sentinel.
+ */
+template <typename ThresholdT, typename LeafOutputT, typename InputT>
+void QuantizeRows(CompiledModelPreset<ThresholdT, LeafOutputT> const& preset,
+    CArray2DView<InputT> input_view, std::uint64_t row_begin, std::uint64_t row_end,
+    std::uint16_t* out) {
+  auto const num_feature = input_view.extent(1);
+  for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+    for (std::uint64_t fid = 0; fid < num_feature; ++fid) {
+      InputT const fvalue = input_view(row_id, fid);
+      std::uint16_t quantized;
+      if (std::isnan(fvalue)) {
+        quantized = kQuantizedMissing;
+      } else {
+        ThresholdT const* first = preset.bin_boundaries.Data() + preset.bin_begin[fid];
+        ThresholdT const* last = preset.bin_boundaries.Data() + preset.bin_end[fid];
+        auto const lower = std::lower_bound(first, last, fvalue) - first;
+        auto const upper = std::upper_bound(first, last, fvalue) - first;
+        quantized = static_cast<std::uint16_t>(lower + upper);
+      }
+      out[(row_id - row_begin) * num_feature + fid] = quantized;
+    }
+  }
+}
+
+template <typename LeafOutputT, typename InputT>
+void OutputLeafVector(Model const& model, LeafOutputT const* leaf_out, int tree_id,
+    std::uint64_t row_id, std::int32_t max_num_class, Array3DView<InputT> output_view) {
   if (model.target_id[tree_id] == -1 && model.class_id[tree_id] == -1) {
     std::vector<std::int32_t> const expected_shape{model.num_target, max_num_class};
     TREELITE_CHECK(model.leaf_vector_shape.AsVector() == expected_shape);
 
-    auto leaf_view = Array2DView<LeafOutputT>(leaf_out.data(), model.num_target, max_num_class);
+    auto leaf_view = CArray2DView<LeafOutputT>(leaf_out, model.num_target, max_num_class);
     for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
       for (std::int32_t class_id = 0; class_id < model.num_class[target_id]; ++class_id) {
         output_view(target_id, row_id, class_id) += leaf_view(target_id, class_id);
@@ -132,7 +649,7 @@ void OutputLeafVector(Model const& model, Tree<ThresholdT, LeafOutputT> const& t
     std::vector<std::int32_t> const expected_leaf_shape{model.num_target, 1};
     TREELITE_CHECK(model.leaf_vector_shape.AsVector() == expected_leaf_shape);
 
-    auto leaf_view = Array2DView<LeafOutputT>(leaf_out.data(), model.num_target, 1);
+    auto leaf_view = CArray2DView<LeafOutputT>(leaf_out, model.num_target, 1);
     auto const class_id = model.class_id[tree_id];
     for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
       output_view(target_id, row_id, class_id) += leaf_view(target_id, 0);
@@ -141,7 +658,7 @@ void OutputLeafVector(Model const& model, Tree<ThresholdT, LeafOutputT> const& t
     std::vector<std::int32_t> const expected_leaf_shape{1, max_num_class};
     TREELITE_CHECK(model.leaf_vector_shape.AsVector() == expected_leaf_shape);
 
-    auto leaf_view = Array2DView<LeafOutputT>(leaf_out.data(), 1, max_num_class);
+    auto leaf_view = CArray2DView<LeafOutputT>(leaf_out, 1, max_num_class);
     auto const target_id = model.target_id[tree_id];
     for (std::int32_t class_id = 0; class_id < model.num_class[target_id]; ++class_id) {
       output_view(target_id, row_id, class_id) += leaf_view(0, class_id);
@@ -156,9 +673,9 @@ void OutputLeafVector(Model const& model, Tree<ThresholdT, LeafOutputT> const& t
   }
 }
 
-template <typename ThresholdT, typename LeafOutputT, typename InputT>
-void OutputLeafValue(Model const& model, Tree<ThresholdT, LeafOutputT> const& tree, int tree_id,
-    int leaf_id, std::uint64_t row_id, Array3DView<InputT> output_view) {
+template <typename LeafOutputT, typename InputT>
+void OutputLeafValue(Model const& model, LeafOutputT leaf_value, int tree_id, std::uint64_t row_id,
+    Array3DView<InputT> output_view) {
   auto const target_id = model.target_id[tree_id];
   auto const class_id = model.class_id[tree_id];
   TREELITE_CHECK(target_id != -1 && class_id != -1);
@@ -166,63 +683,73 @@ void OutputLeafValue(Model const& model, Tree<ThresholdT, LeafOutputT> const& tr
   std::vector<std::int32_t> const expected_leaf_shape{1, 1};
   TREELITE_CHECK(model.leaf_vector_shape.AsVector() == expected_leaf_shape);
 
-  output_view(target_id, row_id, class_id) += tree.LeafValue(leaf_id);
+  output_view(target_id, row_id, class_id) += leaf_value;
 }
 
-template <typename InputT>
-void PredictRaw(Model const& model, InputT const* input, std::uint64_t num_row, InputT* output,
-    detail::threading_utils::ThreadConfig const& thread_config) {
-  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
-  auto max_num_class
-      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
-  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+/*!
+ * \brief Decode one bfloat16-encoded leaf vector into the thread's scratch buffer, for
+ *        models compiled with reduced leaf precision. Only the stored representation is
+ *        narrowed; accumulation happens in full precision as usual.
+ */
+template <typename LeafOutputT>
+LeafOutputT const* DecodeHalfLeafVector(
+    std::uint16_t const* half, std::uint32_t num_elem, LeafOutputT* scratch) {
+  for (std::uint32_t i = 0; i < num_elem; ++i) {
+    scratch[i] = static_cast<LeafOutputT>(Bfloat16ToFloat(half[i]));
+  }
+  return scratch;
+}
+
+// Count, for every (target, class) pair, the number of trees contributing to it.
+// The counts are the divisors used for tree averaging.
+inline std::vector<std::size_t> ComputeAverageFactor(
+    Model const& model, std::int32_t max_num_class) {
   std::size_t const num_tree = model.GetNumTree();
-  std::fill_n(output, output_view.size(), InputT{});  // Fill with 0's
-  std::visit(
-      [&](auto&& concrete_model) {
-        detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
-            detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t row_id, int) {
-              auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
-              static_assert(std::is_same_v<decltype(row), CArray1DView<InputT>>);
-              for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
-                auto const& tree = concrete_model.trees[tree_id];
-                int const leaf_id = EvaluateTree(tree, row);
-                if (tree.HasLeafVector(leaf_id)) {
-                  OutputLeafVector(
-                      model, tree, tree_id, leaf_id, row_id, max_num_class, output_view);
-                } else {
-                  OutputLeafValue(model, tree, tree_id, leaf_id, row_id, output_view);
-                }
-              }
-            });
-      },
-      model.variant_);
-  // Apply tree averaging
-  if (model.average_tree_output) {
-    std::vector<std::size_t> average_factor(model.num_target * max_num_class, 0);
-    auto average_factor_view
-        = Array2DView<std::size_t>(average_factor.data(), model.num_target, max_num_class);
-    for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
-      if (model.target_id[tree_id] < 0 && model.class_id[tree_id] < 0) {
-        for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
-          for (std::int32_t class_id = 0; class_id < model.num_class[target_id]; ++class_id) {
-            average_factor_view(target_id, class_id) += 1;
-          }
-        }
-      } else if (model.target_id[tree_id] < 0) {
-        std::int32_t const class_id = model.class_id[tree_id];
-        for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
-          average_factor_view(target_id, class_id) += 1;
-        }
-      } else if (model.class_id[tree_id] < 0) {
-        std::int32_t const target_id = model.target_id[tree_id];
+  std::vector<std::size_t> average_factor(model.num_target * max_num_class, 0);
+  auto average_factor_view
+      = Array2DView<std::size_t>(average_factor.data(), model.num_target, max_num_class);
+  for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+    if (model.target_id[tree_id] < 0 && model.class_id[tree_id] < 0) {
+      for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
         for (std::int32_t class_id = 0; class_id < model.num_class[target_id]; ++class_id) {
           average_factor_view(target_id, class_id) += 1;
         }
-      } else {
-        average_factor_view(model.target_id[tree_id], model.class_id[tree_id]) += 1;
       }
+    } else if (model.target_id[tree_id] < 0) {
+      std::int32_t const class_id = model.class_id[tree_id];
+      for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
+        average_factor_view(target_id, class_id) += 1;
+      }
+    } else if (model.class_id[tree_id] < 0) {
+      std::int32_t const target_id = model.target_id[tree_id];
+      for (std::int32_t class_id = 0; class_id < model.num_class[target_id]; ++class_id) {
+        average_factor_view(target_id, class_id) += 1;
+      }
+    } else {
+      average_factor_view(model.target_id[tree_id], model.class_id[tree_id]) += 1;
+    }
+  }
+  return average_factor;
+}
+
+// Apply tree averaging, if the model calls for it, and then add base scores.
+// A caller that scores repeatedly (e.g. PredictSession) can pass a precomputed
+// average factor table to avoid recomputing and reallocating it on every call.
+template <typename InputT>
+void ApplyAverageFactorAndBaseScores(Model const& model, std::uint64_t num_row,
+    std::int32_t max_num_class, Array3DView<InputT> output_view,
+    detail::threading_utils::ThreadConfig const& thread_config,
+    std::vector<std::size_t> const* cached_average_factor = nullptr) {
+  TREELITE_TRACE_SCOPE("gtil::average_base_scores");
+  // Apply tree averaging
+  if (model.average_tree_output) {
+    std::vector<std::size_t> average_factor;
+    if (!cached_average_factor) {
+      average_factor = ComputeAverageFactor(model, max_num_class);
+      cached_average_factor = &average_factor;
     }
+    auto average_factor_view = CArray2DView<std::size_t>(
+        cached_average_factor->data(), model.num_target, max_num_class);
     for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
       detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
           detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t row_id, int) {
@@ -246,76 +773,910 @@ void PredictRaw(Model const& model, InputT const* input, std::uint64_t num_row,
   }
 }
 
+/*!
+ * \brief Finalize rows [row_begin, row_end): apply tree averaging (average_factor may be
+ *        null when the model does not average), add base scores, and run the post-processor.
+ *        Factored out so the fused prediction path can finalize a block of rows at the end
+ *        of its tree loop, while the block is still resident in cache, instead of re-reading
+ *        the whole output array in a second sweep.
+ */
 template <typename InputT>
-void ApplyPostProcessor(Model const& model, InputT* output, std::uint64_t num_row,
-    Configuration const& pred_config, detail::threading_utils::ThreadConfig const& thread_config) {
-  auto postprocessor_func = gtil::GetPostProcessorFunc<InputT>(model.postprocessor);
-  auto max_num_class
-      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
-  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+void ApplyAverageAndBaseToRange(Model const& model, std::int32_t target_id,
+    std::uint64_t row_begin, std::uint64_t row_end, std::size_t const* average_factor,
+    std::int32_t max_num_class, Array3DView<InputT> output_view) {
+  std::int32_t const num_class = model.num_class[target_id];
+  auto base_score_view
+      = CArray2DView<double>(model.base_scores.Data(), model.num_target, max_num_class);
+  for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+    if (average_factor) {
+      auto average_factor_view
+          = CArray2DView<std::size_t>(average_factor, model.num_target, max_num_class);
+      for (std::int32_t class_id = 0; class_id < num_class; ++class_id) {
+        output_view(target_id, row_id, class_id)
+            /= static_cast<InputT>(average_factor_view(target_id, class_id));
+      }
+    }
+    for (std::int32_t class_id = 0; class_id < num_class; ++class_id) {
+      output_view(target_id, row_id, class_id) += base_score_view(target_id, class_id);
+    }
+  }
+}
 
+template <typename InputT>
+void FinalizeRowRange(Model const& model, std::uint64_t row_begin, std::uint64_t row_end,
+    std::size_t const* average_factor, std::int32_t max_num_class,
+    PostProcessorFunc<InputT> postprocessor_func, Array3DView<InputT> output_view) {
   for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
     std::int32_t const num_class = model.num_class[target_id];
-    detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
-        detail::threading_utils::ParallelSchedule::Static(), [&](std::size_t row_id, int) {
-          auto row = stdex::submdspan(output_view, target_id, row_id, stdex::full_extent);
-          static_assert(std::is_same_v<decltype(row), Array1DView<InputT>>);
-          postprocessor_func(model, num_class, row.data_handle());
-        });
+    ApplyAverageAndBaseToRange(
+        model, target_id, row_begin, row_end, average_factor, max_num_class, output_view);
+    for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+      auto row = stdex::submdspan(output_view, target_id, row_id, stdex::full_extent);
+      static_assert(std::is_same_v<decltype(row), Array1DView<InputT>>);
+      postprocessor_func(model, num_class, row.data_handle());
+    }
   }
 }
 
+// Batch variant: one post-processor dispatch covers the whole row range of a target
 template <typename InputT>
-void PredictLeaf(Model const& model, InputT const* input, std::uint64_t num_row, InputT* output,
-    detail::threading_utils::ThreadConfig const& thread_config) {
-  auto const num_tree = model.GetNumTree();
-  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
-  auto output_view = Array2DView<InputT>(output, num_row, num_tree);
-  std::visit(
-      [&](auto&& concrete_model) {
+void FinalizeRowRange(Model const& model, std::uint64_t row_begin, std::uint64_t row_end,
+    std::size_t const* average_factor, std::int32_t max_num_class,
+    PostProcessorBatchFunc<InputT> postprocessor_batch_func, Array3DView<InputT> output_view) {
+  for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
+    std::int32_t const num_class = model.num_class[target_id];
+    ApplyAverageAndBaseToRange(
+        model, target_id, row_begin, row_end, average_factor, max_num_class, output_view);
+    if (num_class == max_num_class) {
+      postprocessor_batch_func(
+          model, num_class, row_end - row_begin, &output_view(target_id, row_begin, 0));
+    } else {
+      // Rows of this target are padded to max_num_class, so they are not contiguous;
+      // process them one row at a time
+      for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+        postprocessor_batch_func(model, num_class, 1, &output_view(target_id, row_id, 0));
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Whether to schedule threads across trees instead of rows. With fewer rows than
+ *        threads, the row-parallel schedule would leave most threads idle, which hurts
+ *        latency-sensitive serving of single rows against large ensembles.
+ */
+inline bool UseTreeParallel(
+    std::uint64_t num_row, detail::threading_utils::ThreadConfig const& thread_config) {
+  return thread_config.nthread > 1 && num_row < thread_config.nthread;
+}
+
+/*!
+ * \brief Tree-parallel schedule: each thread accumulates its partition of the trees into a
+ *        private scratch output, and the partial sums are reduced at the end. The static
+ *        schedule hands each thread a contiguous ascending range of trees, so reducing the
+ *        partial sums in thread order keeps the tree accumulation order ascending.
+ *        Each thread's accumulator lives in its scratch arena for the model, so the
+ *        steady state allocates nothing; only a pointer table is kept on the calling
+ *        thread for the reduction.
+ */
+template <typename InputT, typename FuncT>
+void AccumulateTreeParallel(Model const& model, std::size_t num_tree,
+    Array3DView<InputT> output_view, detail::threading_utils::ThreadConfig const& thread_config,
+    FuncT process_tree) {
+  InputT** partial_ptrs = ScratchStore::Get(model).Get<InputT*>(
+      ScratchSlot::kPointerTable, thread_config.nthread);
+  std::fill_n(partial_ptrs, thread_config.nthread, nullptr);
+  detail::threading_utils::ParallelFor(std::size_t(0), num_tree, thread_config,
+      detail::threading_utils::ParallelSchedule::Static(),
+      [&](std::size_t tree_id, int thread_id) {
+        InputT* partial = partial_ptrs[thread_id];
+        if (!partial) {  // First tree handled by this thread in this call
+          partial = ScratchStore::Get(model).Get<InputT>(
+              ScratchSlot::kPartialSums, output_view.size());
+          std::fill_n(partial, output_view.size(), InputT{});
+          partial_ptrs[thread_id] = partial;
+        }
+        auto partial_view = Array3DView<InputT>(
+            partial, output_view.extent(0), output_view.extent(1), output_view.extent(2));
+        process_tree(tree_id, partial_view);
+      });
+  // The first partial is copied rather than added, so the output buffer does not need to
+  // be zeroed before the traversal
+  bool first_partial = true;
+  for (std::uint32_t thread_id = 0; thread_id < thread_config.nthread; ++thread_id) {
+    if (!partial_ptrs[thread_id]) {
+      continue;  // Thread was not handed any tree
+    }
+    if (first_partial) {
+      std::copy_n(partial_ptrs[thread_id], output_view.size(), output_view.data_handle());
+      first_partial = false;
+    } else {
+      for (std::size_t i = 0; i < output_view.size(); ++i) {
+        output_view.data_handle()[i] += partial_ptrs[thread_id][i];
+      }
+    }
+  }
+  if (first_partial) {  // No tree ran; the output is all zeros by definition
+    std::fill_n(output_view.data_handle(), output_view.size(), InputT{});
+  }
+}
+
+/*!
+ * \brief Zero the output slice of rows [row_begin, row_end). Called at the head of each
+ *        block's tree loop, so the zero fill happens while the block is about to be cache
+ *        resident, instead of sweeping the whole output matrix cold before the traversal.
+ */
+template <typename OutputT>
+inline void ZeroOutputRows(
+    Array3DView<OutputT> output_view, std::uint64_t row_begin, std::uint64_t row_end) {
+  std::uint64_t const width = output_view.extent(2);
+  for (std::uint64_t target_id = 0; target_id < output_view.extent(0); ++target_id) {
+    std::fill_n(&output_view(target_id, row_begin, 0), (row_end - row_begin) * width, OutputT{});
+  }
+}
+
+/* Tree traversal and accumulation shared by PredictRaw and the fused PredictDefault.
+ * finalize_block(row_begin, row_end) is called once every row in the range has received the
+ * contribution of every tree; the fused path uses it to post-process a block while it is
+ * still hot in cache, and PredictRaw passes a no-op.
+ * When kCollectStats is set, each thread accumulates traversal counters that are merged
+ * into *stats after the parallel loop; the instrumentation compiles away entirely in the
+ * default instantiation. kNoMissing propagates the caller's all-valid guarantee into the
+ * traversal, dropping the per-node NaN check. */
+template <bool kCollectStats = false, bool kNoMissing = false, typename InputViewT,
+    typename OutputT, typename FinalizeBlockT>
+void PredictRawImpl(Model const& model, InputViewT input_view, std::uint64_t num_row,
+    OutputT* output, detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched, FinalizeBlockT finalize_block,
+    PredictionStats* stats = nullptr, NumaReplicatedModelImpl const* numa = nullptr) {
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<OutputT>(output, model.num_target, num_row, max_num_class);
+  std::size_t const num_tree = model.GetNumTree();
+  std::uint64_t const num_block = (num_row + kRowBlockSize - 1) / kRowBlockSize;
+  std::vector<TraversalCounters> counters;
+  std::vector<std::uint64_t> per_tree_visits;
+  if constexpr (kCollectStats) {
+    counters.resize(thread_config.nthread);
+    per_tree_visits.assign(std::size_t(thread_config.nthread) * num_tree, 0);
+  }
+  std::visit(
+      [&](auto&& concrete_model) {
+        // The tree-parallel schedule does not expose thread IDs to the per-tree callback;
+        // statistics collection always takes the row-block path
+        if (!kCollectStats && UseTreeParallel(num_row, thread_config)) {
+          AccumulateTreeParallel<OutputT>(model, num_tree, output_view, thread_config,
+              [&](std::size_t tree_id, Array3DView<OutputT> partial_view) {
+                using PresetT
+                    = std::remove_const_t<std::remove_reference_t<decltype(concrete_model)>>;
+                auto const& trees = numa
+                                        ? std::get<PresetT>(numa->LocalReplica().variant_).trees
+                                        : concrete_model.trees;
+                auto const& tree = trees[tree_id];
+                for (std::uint64_t row_id = 0; row_id < num_row; ++row_id) {
+                  auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                  int const leaf_id = EvaluateTree<false, kNoMissing>(tree, row);
+                  if (tree.HasLeafVector(leaf_id)) {
+                    OutputLeafVector(model, tree.LeafVectorSpan(leaf_id).first, tree_id, row_id,
+                        max_num_class, partial_view);
+                  } else {
+                    OutputLeafValue(model, tree.LeafValue(leaf_id), tree_id, row_id, partial_view);
+                  }
+                }
+              });
+          finalize_block(std::uint64_t(0), num_row);
+          return;
+        }
+        detail::threading_utils::ParallelFor(std::uint64_t(0), num_block, thread_config,
+            row_sched, [&](std::uint64_t block_id, int thread_id) {
+              std::uint64_t const row_begin = block_id * kRowBlockSize;
+              std::uint64_t const row_end = std::min(row_begin + kRowBlockSize, num_row);
+              ZeroOutputRows(output_view, row_begin, row_end);
+              // Route the block to the replica local to the NUMA node this thread runs on
+              using PresetT
+                  = std::remove_const_t<std::remove_reference_t<decltype(concrete_model)>>;
+              auto const& trees = numa
+                                      ? std::get<PresetT>(numa->LocalReplica().variant_).trees
+                                      : concrete_model.trees;
+              for (std::size_t tree_begin = 0; tree_begin < num_tree;
+                   tree_begin += kTreeBlockSize) {
+                std::size_t const tree_end = std::min(tree_begin + kTreeBlockSize, num_tree);
+                for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+                  auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                  for (std::size_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+                    auto const& tree = trees[tree_id];
+                    int leaf_id;
+                    if constexpr (kCollectStats) {
+                      TraversalCounters& c = counters[thread_id];
+                      std::uint64_t const visits_before = c.num_node_visit;
+                      leaf_id = EvaluateTree<true>(tree, row, &c);
+                      ++c.num_tree_traversal;
+                      per_tree_visits[std::size_t(thread_id) * num_tree + tree_id]
+                          += c.num_node_visit - visits_before;
+                    } else {
+                      leaf_id = EvaluateTree<false, kNoMissing>(tree, row);
+                    }
+                    if (tree.HasLeafVector(leaf_id)) {
+                      OutputLeafVector(model, tree.LeafVectorSpan(leaf_id).first, tree_id, row_id,
+                          max_num_class, output_view);
+                    } else {
+                      OutputLeafValue(
+                          model, tree.LeafValue(leaf_id), tree_id, row_id, output_view);
+                    }
+                  }
+                }
+              }
+              finalize_block(row_begin, row_end);
+            });
+      },
+      model.variant_);
+  if constexpr (kCollectStats) {
+    stats->num_row = num_row;
+    stats->node_visit_per_tree.assign(num_tree, 0);
+    for (std::uint32_t thread_id = 0; thread_id < thread_config.nthread; ++thread_id) {
+      stats->num_tree_traversal += counters[thread_id].num_tree_traversal;
+      stats->num_node_visit += counters[thread_id].num_node_visit;
+      stats->num_missing_branch += counters[thread_id].num_missing_branch;
+      stats->num_categorical_visit += counters[thread_id].num_categorical_visit;
+      for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+        stats->node_visit_per_tree[tree_id]
+            += per_tree_visits[std::size_t(thread_id) * num_tree + tree_id];
+      }
+    }
+  }
+}
+
+template <bool kCollectStats = false, bool kNoMissing = false, typename InputViewT,
+    typename OutputT>
+void PredictRaw(Model const& model, InputViewT input_view, std::uint64_t num_row, OutputT* output,
+    detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched
+    = detail::threading_utils::ParallelSchedule::Static(),
+    PredictionStats* stats = nullptr, NumaReplicatedModelImpl const* numa = nullptr,
+    std::vector<std::size_t> const* cached_average_factor = nullptr) {
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<OutputT>(output, model.num_target, num_row, max_num_class);
+  {
+    TREELITE_TRACE_SCOPE("gtil::traversal");
+    PredictRawImpl<kCollectStats, kNoMissing>(model, input_view, num_row, output, thread_config,
+        row_sched, [](std::uint64_t, std::uint64_t) {}, stats, numa);
+  }
+  ApplyAverageFactorAndBaseScores(
+      model, num_row, max_num_class, output_view, thread_config, cached_average_factor);
+}
+
+/* Fused equivalent of PredictRaw + ApplyAverageFactorAndBaseScores + ApplyPostProcessor:
+ * each block of rows is finalized at the end of its tree loop, so the output array is
+ * written once instead of being swept three more times. */
+template <bool kCollectStats = false, bool kNoMissing = false, typename InputViewT,
+    typename OutputT>
+void PredictDefault(Model const& model, InputViewT input_view, std::uint64_t num_row,
+    OutputT* output, detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched,
+    PostProcessorFunc<OutputT> postprocessor_func,
+    PostProcessorBatchFunc<OutputT> postprocessor_batch_func = nullptr,
+    PredictionStats* stats = nullptr, NumaReplicatedModelImpl const* numa = nullptr,
+    std::vector<std::size_t> const* cached_average_factor = nullptr) {
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<OutputT>(output, model.num_target, num_row, max_num_class);
+  std::vector<std::size_t> average_factor;
+  if (model.average_tree_output && !cached_average_factor) {
+    average_factor = ComputeAverageFactor(model, max_num_class);
+    cached_average_factor = &average_factor;
+  }
+  std::size_t const* average_factor_ptr
+      = model.average_tree_output ? cached_average_factor->data() : nullptr;
+  // Fused path: block finalization happens inside the traversal, so it is part of this phase
+  TREELITE_TRACE_SCOPE("gtil::traversal");
+  PredictRawImpl<kCollectStats, kNoMissing>(
+      model, input_view, num_row, output, thread_config, row_sched,
+      [&](std::uint64_t row_begin, std::uint64_t row_end) {
+        if (postprocessor_batch_func) {
+          FinalizeRowRange(model, row_begin, row_end, average_factor_ptr, max_num_class,
+              postprocessor_batch_func, output_view);
+        } else {
+          FinalizeRowRange(model, row_begin, row_end, average_factor_ptr, max_num_class,
+              postprocessor_func, output_view);
+        }
+      },
+      stats, numa);
+}
+
+/*! \brief Per-model output state of the multi-model pass */
+template <typename OutputT>
+struct MultiModelTarget {
+  Model const* model;
+  OutputT* output;
+  Array3DView<OutputT> output_view;
+  std::int32_t max_num_class;
+  std::vector<std::size_t> average_factor;
+  PostProcessorFunc<OutputT> postprocessor_func{nullptr};
+  PostProcessorBatchFunc<OutputT> postprocessor_batch_func{nullptr};
+};
+
+/*!
+ * \brief Shared traversal pass of PredictMulti: each row block is fed to every model's tree
+ *        loop while it is cache resident, so the input matrix streams from memory once
+ *        rather than once per model. When post-processors are supplied, each model's block
+ *        is finalized in place at the end of its tree loop, like PredictDefault.
+ */
+template <typename InputT, typename OutputT>
+void PredictMultiImpl(std::vector<MultiModelTarget<OutputT>>& targets, InputT const* input,
+    std::uint64_t num_row, detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched, bool finalize_blocks) {
+  auto input_view = CArray2DView<InputT>(input, num_row, targets.front().model->num_feature);
+  std::uint64_t const num_block = (num_row + kRowBlockSize - 1) / kRowBlockSize;
+  detail::threading_utils::ParallelFor(std::uint64_t(0), num_block, thread_config, row_sched,
+      [&](std::uint64_t block_id, int) {
+        std::uint64_t const row_begin = block_id * kRowBlockSize;
+        std::uint64_t const row_end = std::min(row_begin + kRowBlockSize, num_row);
+        for (auto& target : targets) {
+          Model const& model = *target.model;
+          auto output_view = target.output_view;
+          ZeroOutputRows(output_view, row_begin, row_end);
+          std::size_t const num_tree = model.GetNumTree();
+          std::visit(
+              [&](auto&& concrete_model) {
+                for (std::size_t tree_begin = 0; tree_begin < num_tree;
+                     tree_begin += kTreeBlockSize) {
+                  std::size_t const tree_end = std::min(tree_begin + kTreeBlockSize, num_tree);
+                  for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    static_assert(std::is_same_v<decltype(row), CArray1DView<InputT>>);
+                    for (std::size_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+                      auto const& tree = concrete_model.trees[tree_id];
+                      int const leaf_id = EvaluateTree(tree, row);
+                      if (tree.HasLeafVector(leaf_id)) {
+                        OutputLeafVector(model, tree.LeafVectorSpan(leaf_id).first, tree_id,
+                            row_id, target.max_num_class, output_view);
+                      } else {
+                        OutputLeafValue(
+                            model, tree.LeafValue(leaf_id), tree_id, row_id, output_view);
+                      }
+                    }
+                  }
+                }
+              },
+              model.variant_);
+          if (finalize_blocks) {
+            if (target.postprocessor_batch_func) {
+              FinalizeRowRange(model, row_begin, row_end,
+                  target.average_factor.empty() ? nullptr : target.average_factor.data(),
+                  target.max_num_class, target.postprocessor_batch_func, output_view);
+            } else {
+              FinalizeRowRange(model, row_begin, row_end,
+                  target.average_factor.empty() ? nullptr : target.average_factor.data(),
+                  target.max_num_class, target.postprocessor_func, output_view);
+            }
+          }
+        }
+      });
+}
+
+template <typename InputT, typename FinalizeBlockT>
+void PredictRawImpl(CompiledModelImpl const& compiled, InputT const* input, std::uint64_t num_row,
+    InputT* output, detail::threading_utils::ThreadConfig const& thread_config,
+    [[maybe_unused]] bool use_simd, detail::threading_utils::ParallelSchedule row_sched,
+    FinalizeBlockT finalize_block) {
+  Model const& model = *compiled.model;
+  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+  std::uint64_t const num_block = (num_row + kRowBlockSize - 1) / kRowBlockSize;
+  std::visit(
+      [&](auto&& compiled_preset) {
+        using CompiledPresetT
+            = std::remove_const_t<std::remove_reference_t<decltype(compiled_preset)>>;
+        using LeafOutputT = typename CompiledPresetT::leaf_output_type;
+        std::size_t const num_tree = compiled_preset.trees.size();
+        if (UseTreeParallel(num_row, thread_config)) {
+          std::uint16_t* quantized_input = nullptr;
+          if (compiled_preset.quantized) {
+            quantized_input = ScratchStore::Get(model).Get<std::uint16_t>(
+                ScratchSlot::kQuantizedInput, num_row * model.num_feature);
+            QuantizeRows(compiled_preset, input_view, 0, num_row, quantized_input);
+          }
+          std::uint32_t* cat_codes = nullptr;
+          if (compiled.num_cat_feature > 0) {
+            cat_codes = ScratchStore::Get(model).Get<std::uint32_t>(
+                ScratchSlot::kCategoryCodes, num_row * compiled.num_cat_feature);
+            DecodeCategoryRows(compiled, input_view, 0, num_row, cat_codes);
+          }
+          AccumulateTreeParallel<InputT>(model, num_tree, output_view, thread_config,
+              [&](std::size_t tree_id, Array3DView<InputT> partial_view) {
+                auto const& tree = compiled_preset.trees[tree_id];
+                if (tree.dedup_root >= 0) {
+                  auto const* pool = compiled_preset.dedup_nodes.Data();
+                  for (std::uint64_t row_id = 0; row_id < num_row; ++row_id) {
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    int const leaf_id = EvaluateTreeShared(pool, tree.dedup_root, row);
+                    OutputLeafValue(model, pool[leaf_id].threshold_or_leaf_value, tree_id,
+                        row_id, partial_view);
+                  }
+                  return;
+                }
+                LeafOutputT* leaf_scratch = compiled_preset.reduced_precision_leaf
+                    ? ScratchStore::Get(model).Get<LeafOutputT>(
+                          ScratchSlot::kDecodedLeafVector, compiled.leaf_vector_length)
+                    : nullptr;
+                std::uint64_t row_start = 0;
+                if (tree.branchless && tree.compact_nodes.Empty()
+                    && tree.quantized_nodes.Empty()) {
+                  int leaf_ids[kInterleaveRowGroupSize];
+                  for (; row_start + kInterleaveRowGroupSize <= num_row;
+                       row_start += kInterleaveRowGroupSize) {
+                    EvaluateTreeBranchlessInterleavedDispatch(
+                        tree, input_view, row_start, leaf_ids);
+                    for (std::uint64_t lane = 0; lane < kInterleaveRowGroupSize; ++lane) {
+                      OutputLeafValue(model,
+                          tree.nodes[leaf_ids[lane]].threshold_or_leaf_value, tree_id,
+                          row_start + lane, partial_view);
+                    }
+                  }
+                }
+                for (std::uint64_t row_id = row_start; row_id < num_row; ++row_id) {
+                  if (tree.fixed_depth > 0 && tree.quantized_nodes.Empty()) {
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    OutputLeafValue(model, EvaluateTreeFixedDepthDispatch(tree, row), tree_id,
+                        row_id, partial_view);
+                    continue;
+                  }
+                  int leaf_id;
+                  if (!tree.quantized_nodes.Empty()) {
+                    leaf_id = EvaluateTreeQuantized(
+                        tree, quantized_input + row_id * model.num_feature);
+                  } else {
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    if (!tree.compact_nodes.Empty()) {
+                      leaf_id = EvaluateTreeCompact(tree, row);
+                    } else if (tree.branchless) {
+                      leaf_id = EvaluateTreeBranchlessDispatch(tree, row);
+                    } else {
+                      leaf_id = EvaluateTree(tree, row,
+                          cat_codes ? cat_codes + row_id * compiled.num_cat_feature : nullptr,
+                          compiled.cat_feature_slot.data());
+                    }
+                  }
+                  auto const& leaf = tree.nodes[leaf_id];
+                  if (leaf.aux != kCompiledNodeInvalidAux) {
+                    OutputLeafVector(model,
+                        leaf_scratch
+                            ? DecodeHalfLeafVector(tree.leaf_vector_half.Data() + leaf.aux,
+                                  compiled.leaf_vector_length, leaf_scratch)
+                            : tree.leaf_vector.Data() + leaf.aux,
+                        tree_id, row_id, max_num_class, partial_view);
+                  } else {
+                    OutputLeafValue(
+                        model, leaf.threshold_or_leaf_value, tree_id, row_id, partial_view);
+                  }
+                }
+              });
+          finalize_block(std::uint64_t(0), num_row);
+          return;
+        }
+        detail::threading_utils::ParallelFor(std::uint64_t(0), num_block, thread_config,
+            row_sched, [&](std::uint64_t block_id, int) {
+              std::uint64_t const row_begin = block_id * kRowBlockSize;
+              std::uint64_t const row_end = std::min(row_begin + kRowBlockSize, num_row);
+              ZeroOutputRows(output_view, row_begin, row_end);
+              // Rows of the block are binned once into this thread's scratch arena and
+              // reused across all quantized trees
+              std::uint16_t* quantized_input = nullptr;
+              if (compiled_preset.quantized) {
+                quantized_input = ScratchStore::Get(model).Get<std::uint16_t>(
+                    ScratchSlot::kQuantizedInput,
+                    (row_end - row_begin) * model.num_feature);
+                QuantizeRows(compiled_preset, input_view, row_begin, row_end, quantized_input);
+              }
+              // Categorical columns are likewise decoded once per block
+              std::uint32_t* cat_codes = nullptr;
+              if (compiled.num_cat_feature > 0) {
+                cat_codes = ScratchStore::Get(model).Get<std::uint32_t>(
+                    ScratchSlot::kCategoryCodes,
+                    (row_end - row_begin) * compiled.num_cat_feature);
+                DecodeCategoryRows(compiled, input_view, row_begin, row_end, cat_codes);
+              }
+              LeafOutputT* leaf_scratch = compiled_preset.reduced_precision_leaf
+                  ? ScratchStore::Get(model).Get<LeafOutputT>(
+                        ScratchSlot::kDecodedLeafVector, compiled.leaf_vector_length)
+                  : nullptr;
+              for (std::size_t tree_begin = 0; tree_begin < num_tree;
+                   tree_begin += kTreeBlockSize) {
+                std::size_t const tree_end = std::min(tree_begin + kTreeBlockSize, num_tree);
+                for (std::size_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+                  auto const& tree = compiled_preset.trees[tree_id];
+                  std::uint64_t row_id = row_begin;
+                  if (tree.dedup_root >= 0) {
+                    auto const* pool = compiled_preset.dedup_nodes.Data();
+                    for (; row_id < row_end; ++row_id) {
+                      auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                      int const leaf_id = EvaluateTreeShared(pool, tree.dedup_root, row);
+                      OutputLeafValue(model, pool[leaf_id].threshold_or_leaf_value, tree_id,
+                          row_id, output_view);
+                    }
+                    continue;
+                  }
+                  if (!tree.quantized_nodes.Empty()) {
+                    for (; row_id < row_end; ++row_id) {
+                      int const leaf_id = EvaluateTreeQuantized(
+                          tree, quantized_input + (row_id - row_begin) * model.num_feature);
+                      auto const& leaf = tree.nodes[leaf_id];
+                      if (leaf.aux != kCompiledNodeInvalidAux) {
+                        OutputLeafVector(model,
+                            leaf_scratch
+                                ? DecodeHalfLeafVector(tree.leaf_vector_half.Data() + leaf.aux,
+                                      compiled.leaf_vector_length, leaf_scratch)
+                                : tree.leaf_vector.Data() + leaf.aux,
+                            tree_id, row_id, max_num_class, output_view);
+                      } else {
+                        OutputLeafValue(
+                            model, leaf.threshold_or_leaf_value, tree_id, row_id, output_view);
+                      }
+                    }
+                    continue;
+                  }
+                  if (tree.fixed_depth > 0) {
+                    for (; row_id < row_end; ++row_id) {
+                      auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                      OutputLeafValue(model, EvaluateTreeFixedDepthDispatch(tree, row), tree_id,
+                          row_id, output_view);
+                    }
+                    continue;
+                  }
+#if defined(__AVX2__)
+                  using CompiledPresetT
+                      = std::remove_const_t<std::remove_reference_t<decltype(compiled_preset)>>;
+                  if constexpr (std::is_same_v<InputT, float>
+                                && std::is_same_v<typename CompiledPresetT::threshold_type,
+                                    float>) {
+                    if (use_simd && tree.simd_compatible) {
+                      std::int32_t leaf_ids[kSimdRowGroupSize];
+                      for (; row_id + kSimdRowGroupSize <= row_end;
+                           row_id += kSimdRowGroupSize) {
+                        EvaluateTreeSimdX8(tree, input + row_id * model.num_feature,
+                            model.num_feature, leaf_ids);
+                        for (std::uint64_t lane = 0; lane < kSimdRowGroupSize; ++lane) {
+                          OutputLeafValue(model,
+                              tree.nodes[leaf_ids[lane]].threshold_or_leaf_value, tree_id,
+                              row_id + lane, output_view);
+                        }
+                      }
+                    }
+                  }
+#endif  // defined(__AVX2__)
+                  if (tree.branchless && tree.compact_nodes.Empty()) {
+                    // Branchless trees carry scalar leaves only, so each lane's output is a
+                    // plain accumulate
+                    int leaf_ids[kInterleaveRowGroupSize];
+                    for (; row_id + kInterleaveRowGroupSize <= row_end;
+                         row_id += kInterleaveRowGroupSize) {
+                      EvaluateTreeBranchlessInterleavedDispatch(
+                          tree, input_view, row_id, leaf_ids);
+                      for (std::uint64_t lane = 0; lane < kInterleaveRowGroupSize; ++lane) {
+                        OutputLeafValue(model,
+                            tree.nodes[leaf_ids[lane]].threshold_or_leaf_value, tree_id,
+                            row_id + lane, output_view);
+                      }
+                    }
+                  }
+                  for (; row_id < row_end; ++row_id) {
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    static_assert(std::is_same_v<decltype(row), CArray1DView<InputT>>);
+                    int leaf_id;
+                    if (!tree.compact_nodes.Empty()) {
+                      leaf_id = EvaluateTreeCompact(tree, row);
+                    } else if (tree.branchless) {
+                      leaf_id = EvaluateTreeBranchlessDispatch(tree, row);
+                    } else {
+                      leaf_id = EvaluateTree(tree, row,
+                          cat_codes ? cat_codes
+                                  + (row_id - row_begin) * compiled.num_cat_feature
+                                    : nullptr,
+                          compiled.cat_feature_slot.data());
+                    }
+                    auto const& leaf = tree.nodes[leaf_id];
+                    if (leaf.aux != kCompiledNodeInvalidAux) {
+                      OutputLeafVector(model,
+                          leaf_scratch
+                              ? DecodeHalfLeafVector(tree.leaf_vector_half.Data() + leaf.aux,
+                                    compiled.leaf_vector_length, leaf_scratch)
+                              : tree.leaf_vector.Data() + leaf.aux,
+                          tree_id, row_id, max_num_class, output_view);
+                    } else {
+                      OutputLeafValue(
+                          model, leaf.threshold_or_leaf_value, tree_id, row_id, output_view);
+                    }
+                  }
+                }
+              }
+              finalize_block(row_begin, row_end);
+            });
+      },
+      compiled.variant_);
+}
+
+template <typename InputT>
+void PredictRaw(CompiledModelImpl const& compiled, InputT const* input, std::uint64_t num_row,
+    InputT* output, detail::threading_utils::ThreadConfig const& thread_config, bool use_simd,
+    detail::threading_utils::ParallelSchedule row_sched
+    = detail::threading_utils::ParallelSchedule::Static()) {
+  Model const& model = *compiled.model;
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+  {
+    TREELITE_TRACE_SCOPE("gtil::traversal");
+    PredictRawImpl(compiled, input, num_row, output, thread_config, use_simd, row_sched,
+        [](std::uint64_t, std::uint64_t) {});
+  }
+  ApplyAverageFactorAndBaseScores(model, num_row, max_num_class, output_view, thread_config);
+}
+
+template <typename InputT>
+void PredictDefault(CompiledModelImpl const& compiled, InputT const* input, std::uint64_t num_row,
+    InputT* output, detail::threading_utils::ThreadConfig const& thread_config, bool use_simd,
+    detail::threading_utils::ParallelSchedule row_sched,
+    PostProcessorFunc<InputT> postprocessor_func,
+    PostProcessorBatchFunc<InputT> postprocessor_batch_func = nullptr) {
+  Model const& model = *compiled.model;
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+  std::vector<std::size_t> average_factor;
+  if (model.average_tree_output) {
+    average_factor = ComputeAverageFactor(model, max_num_class);
+  }
+  TREELITE_TRACE_SCOPE("gtil::traversal");
+  PredictRawImpl(compiled, input, num_row, output, thread_config, use_simd, row_sched,
+      [&](std::uint64_t row_begin, std::uint64_t row_end) {
+        if (postprocessor_batch_func) {
+          FinalizeRowRange(model, row_begin, row_end,
+              average_factor.empty() ? nullptr : average_factor.data(), max_num_class,
+              postprocessor_batch_func, output_view);
+        } else {
+          FinalizeRowRange(model, row_begin, row_end,
+              average_factor.empty() ? nullptr : average_factor.data(), max_num_class,
+              postprocessor_func, output_view);
+        }
+      });
+}
+
+/*!
+ * \brief Run func(row_id, row_view) over every row of a CSR matrix.
+ * Each thread owns one dense scratch row in its arena for the model, pre-filled with NaN
+ * ("missing") on the thread's first row of the call; a row's stored entries are scattered
+ * in before the callback runs and reset afterwards, so the cost of densification is
+ * proportional to the number of stored entries, not to num_feature.
+ */
+template <typename InputT, typename FuncT>
+void ForEachRowCSR(Model const& model, CSRView<InputT> input,
+    detail::threading_utils::ThreadConfig const& thread_config, FuncT func) {
+  std::int32_t const num_feature = model.num_feature;
+  InputT** row_ptrs = ScratchStore::Get(model).Get<InputT*>(
+      ScratchSlot::kPointerTable, thread_config.nthread);
+  std::fill_n(row_ptrs, thread_config.nthread, nullptr);
+  detail::threading_utils::ParallelFor(std::uint64_t(0), input.num_row, thread_config,
+      detail::threading_utils::ParallelSchedule::Static(),
+      [&](std::uint64_t row_id, int thread_id) {
+        InputT* dense_row = row_ptrs[thread_id];
+        if (!dense_row) {  // First row handled by this thread in this call
+          dense_row = ScratchStore::Get(model).Get<InputT>(
+              ScratchSlot::kDenseRow, num_feature);
+          std::fill_n(dense_row, num_feature, std::numeric_limits<InputT>::quiet_NaN());
+          row_ptrs[thread_id] = dense_row;
+        }
+        for (std::uint64_t i = input.row_ptr[row_id]; i < input.row_ptr[row_id + 1]; ++i) {
+          if (input.col_ind[i] < static_cast<std::uint64_t>(num_feature)) {
+            dense_row[input.col_ind[i]] = input.data[i];
+          }
+        }
+        func(row_id, CArray1DView<InputT>(dense_row, num_feature));
+        for (std::uint64_t i = input.row_ptr[row_id]; i < input.row_ptr[row_id + 1]; ++i) {
+          if (input.col_ind[i] < static_cast<std::uint64_t>(num_feature)) {
+            dense_row[input.col_ind[i]] = std::numeric_limits<InputT>::quiet_NaN();
+          }
+        }
+      });
+}
+
+template <typename InputT>
+void PredictRaw(Model const& model, CSRView<InputT> input, InputT* output,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  auto output_view = Array3DView<InputT>(output, model.num_target, input.num_row, max_num_class);
+  std::size_t const num_tree = model.GetNumTree();
+  std::visit(
+      [&](auto&& concrete_model) {
+        ForEachRowCSR(model, input, thread_config,
+            [&](std::uint64_t row_id, CArray1DView<InputT> row) {
+              ZeroOutputRows(output_view, row_id, row_id + 1);
+              for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+                auto const& tree = concrete_model.trees[tree_id];
+                int const leaf_id = EvaluateTree(tree, row);
+                if (tree.HasLeafVector(leaf_id)) {
+                  OutputLeafVector(model, tree.LeafVectorSpan(leaf_id).first, tree_id, row_id,
+                      max_num_class, output_view);
+                } else {
+                  OutputLeafValue(model, tree.LeafValue(leaf_id), tree_id, row_id, output_view);
+                }
+              }
+            });
+      },
+      model.variant_);
+  ApplyAverageFactorAndBaseScores(model, input.num_row, max_num_class, output_view, thread_config);
+}
+
+template <typename InputT, typename OutputT>
+void PredictLeaf(Model const& model, CSRView<InputT> input, OutputT* output,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  auto const num_tree = model.GetNumTree();
+  auto output_view = Array2DView<OutputT>(output, input.num_row, num_tree);
+  std::visit(
+      [&](auto&& concrete_model) {
+        ForEachRowCSR(model, input, thread_config,
+            [&](std::uint64_t row_id, CArray1DView<InputT> row) {
+              for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+                auto const& tree = concrete_model.trees[tree_id];
+                int const leaf_id = EvaluateTree(tree, row);
+                output_view(row_id, tree_id) = static_cast<OutputT>(leaf_id);
+              }
+            });
+      },
+      model.variant_);
+}
+
+template <typename InputT>
+void PredictScoreByTree(Model const& model, CSRView<InputT> input, InputT* output,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  auto const num_tree = model.GetNumTree();
+  std::uint64_t const leaf_len = model.leaf_vector_shape[0] * model.leaf_vector_shape[1];
+  auto output_view = Array3DView<InputT>(output, input.num_row, num_tree, leaf_len);
+  // Every slot is written in full (short leaves are padded with 0's in place), so no
+  // upfront zeroing sweep of the output matrix is needed
+  std::visit(
+      [&](auto&& concrete_model) {
+        ForEachRowCSR(model, input, thread_config,
+            [&](std::uint64_t row_id, CArray1DView<InputT> row) {
+              for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
+                auto const& tree = concrete_model.trees[tree_id];
+                int const leaf_id = EvaluateTree(tree, row);
+                std::uint64_t filled = 1;
+                if (tree.HasLeafVector(leaf_id)) {
+                  auto const [leafvec, leafvec_len] = tree.LeafVectorSpan(leaf_id);
+                  for (std::size_t i = 0; i < leafvec_len; ++i) {
+                    output_view(row_id, tree_id, i) = leafvec[i];
+                  }
+                  filled = leafvec_len;
+                } else {
+                  output_view(row_id, tree_id, 0) = tree.LeafValue(leaf_id);
+                }
+                for (std::uint64_t i = filled; i < leaf_len; ++i) {
+                  output_view(row_id, tree_id, i) = InputT{};
+                }
+              }
+            });
+      },
+      model.variant_);
+}
+
+template <typename InputT>
+void ApplyPostProcessor(Model const& model, PostProcessorFunc<InputT> postprocessor_func,
+    std::int32_t max_num_class, InputT* output, std::uint64_t num_row,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  TREELITE_TRACE_SCOPE("gtil::postprocess");
+  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+
+  for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
+    std::int32_t const num_class = model.num_class[target_id];
+    detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
+        detail::threading_utils::ParallelSchedule::Static(), [&](std::size_t row_id, int) {
+          auto row = stdex::submdspan(output_view, target_id, row_id, stdex::full_extent);
+          static_assert(std::is_same_v<decltype(row), Array1DView<InputT>>);
+          postprocessor_func(model, num_class, row.data_handle());
+        });
+  }
+}
+
+// Batch variant: threads work on blocks of rows, with one post-processor dispatch per block
+template <typename InputT>
+void ApplyPostProcessor(Model const& model, PostProcessorBatchFunc<InputT> postprocessor_batch_func,
+    std::int32_t max_num_class, InputT* output, std::uint64_t num_row,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  auto output_view = Array3DView<InputT>(output, model.num_target, num_row, max_num_class);
+  std::uint64_t const num_block = (num_row + kRowBlockSize - 1) / kRowBlockSize;
+  for (std::int32_t target_id = 0; target_id < model.num_target; ++target_id) {
+    std::int32_t const num_class = model.num_class[target_id];
+    detail::threading_utils::ParallelFor(std::uint64_t(0), num_block, thread_config,
+        detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t block_id, int) {
+          std::uint64_t const row_begin = block_id * kRowBlockSize;
+          std::uint64_t const row_end = std::min(row_begin + kRowBlockSize, num_row);
+          if (num_class == max_num_class) {
+            postprocessor_batch_func(
+                model, num_class, row_end - row_begin, &output_view(target_id, row_begin, 0));
+          } else {
+            for (std::uint64_t row_id = row_begin; row_id < row_end; ++row_id) {
+              postprocessor_batch_func(model, num_class, 1, &output_view(target_id, row_id, 0));
+            }
+          }
+        });
+  }
+}
+
+template <typename InputT>
+void ApplyPostProcessor(Model const& model, InputT* output, std::uint64_t num_row,
+    Configuration const& config, detail::threading_utils::ThreadConfig const& thread_config) {
+  auto max_num_class
+      = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+  if (config.use_fast_math) {
+    ApplyPostProcessor(model, gtil::GetPostProcessorBatchFunc<InputT>(model.postprocessor),
+        max_num_class, output, num_row, thread_config);
+  } else {
+    ApplyPostProcessor(model, gtil::GetPostProcessorFunc<InputT>(model.postprocessor),
+        max_num_class, output, num_row, thread_config);
+  }
+}
+
+template <typename InputViewT, typename OutputT>
+void PredictLeaf(Model const& model, InputViewT input_view, std::uint64_t num_row, OutputT* output,
+    detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched
+    = detail::threading_utils::ParallelSchedule::Static()) {
+  auto const num_tree = model.GetNumTree();
+  auto output_view = Array2DView<OutputT>(output, num_row, num_tree);
+  std::visit(
+      [&](auto&& concrete_model) {
         std::size_t const num_tree = concrete_model.trees.size();
         detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
-            detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t row_id, int) {
+            row_sched, [&](std::uint64_t row_id, int) {
               auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
-              static_assert(std::is_same_v<decltype(row), CArray1DView<InputT>>);
               for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
                 auto const& tree = concrete_model.trees[tree_id];
                 int const leaf_id = EvaluateTree(tree, row);
-                output_view(row_id, tree_id) = leaf_id;
+                output_view(row_id, tree_id) = static_cast<OutputT>(leaf_id);
               }
             });
       },
       model.variant_);
 }
 
-template <typename InputT>
-void PredictScoreByTree(Model const& model, InputT const* input, std::uint64_t num_row,
-    InputT* output, detail::threading_utils::ThreadConfig const& thread_config) {
-  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
+template <typename InputViewT, typename OutputT>
+void PredictScoreByTree(Model const& model, InputViewT input_view, std::uint64_t num_row,
+    OutputT* output, detail::threading_utils::ThreadConfig const& thread_config,
+    detail::threading_utils::ParallelSchedule row_sched
+    = detail::threading_utils::ParallelSchedule::Static()) {
   auto const num_tree = model.GetNumTree();
   auto max_num_class
       = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
-  auto output_view = Array3DView<InputT>(
-      output, num_row, num_tree, model.leaf_vector_shape[0] * model.leaf_vector_shape[1]);
-  std::fill_n(output, output_view.size(), InputT{});  // Fill with 0's
+  std::uint64_t const leaf_len = model.leaf_vector_shape[0] * model.leaf_vector_shape[1];
+  auto output_view = Array3DView<OutputT>(output, num_row, num_tree, leaf_len);
+  // Every slot is written in full (short leaves are padded with 0's in place), so no
+  // upfront zeroing sweep of the output matrix is needed
   std::visit(
       [&](auto&& concrete_model) {
         std::size_t const num_tree = concrete_model.trees.size();
         detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
-            detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t row_id, int) {
+            row_sched, [&](std::uint64_t row_id, int) {
               auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
-              static_assert(std::is_same_v<decltype(row), CArray1DView<InputT>>);
               for (std::size_t tree_id = 0; tree_id < num_tree; ++tree_id) {
                 auto const& tree = concrete_model.trees[tree_id];
                 int const leaf_id = EvaluateTree(tree, row);
+                std::uint64_t filled = 1;
                 if (tree.HasLeafVector(leaf_id)) {
-                  auto const leafvec = tree.LeafVector(leaf_id);
-                  for (std::size_t i = 0; i < leafvec.size(); ++i) {
+                  auto const [leafvec, leafvec_len] = tree.LeafVectorSpan(leaf_id);
+                  for (std::size_t i = 0; i < leafvec_len; ++i) {
                     output_view(row_id, tree_id, i) = leafvec[i];
                   }
+                  filled = leafvec_len;
                 } else {
                   output_view(row_id, tree_id, 0) = tree.LeafValue(leaf_id);
                 }
+                for (std::uint64_t i = filled; i < leaf_len; ++i) {
+                  output_view(row_id, tree_id, i) = OutputT{};
+                }
               }
             });
       },
@@ -323,8 +1684,7 @@ void PredictScoreByTree(Model const& model, InputT const* input, std::uint64_t n
 }
 
 template <typename InputT>
-void Predict(Model const& model, InputT const* input, std::uint64_t num_row, InputT* output,
-    Configuration const& config) {
+void CheckInputType(Model const& model) {
   TypeInfo leaf_output_type = model.GetLeafOutputType();
   TypeInfo input_type = TypeInfoFromType<InputT>();
   if (leaf_output_type != input_type) {
@@ -336,24 +1696,626 @@ void Predict(Model const& model, InputT const* input, std::uint64_t num_row, Inp
     TREELITE_LOG(FATAL) << "Incorrect input type passed to GTIL predict(). "
                         << "Expected: " << expected << ", Got: " << got;
   }
-  auto thread_config = detail::threading_utils::ThreadConfig(config.nthread);
+}
+
+/*!
+ * \brief Validate the input / output element types of the dense Predict path. The output
+ *        type must match the model's leaf output type, since the output buffer is also the
+ *        accumulator. The input type may additionally be float32 against a float64 model
+ *        (mixed precision): thresholds are compared against the float input directly and
+ *        leaf outputs accumulate in double, so float32 feature pipelines need not
+ *        up-convert their rows.
+ */
+template <typename InputT, typename OutputT>
+void CheckInputOutputType(Model const& model) {
+  CheckInputType<OutputT>(model);
+  if constexpr (!std::is_same_v<InputT, OutputT>) {
+    if (!(std::is_same_v<InputT, float> && std::is_same_v<OutputT, double>)) {
+      TREELITE_LOG(FATAL) << "Incorrect input type passed to GTIL predict(). "
+                          << "The input type must match the model's leaf output type; "
+                          << "the only mixed-precision combination supported is "
+                          << "float32 input against a float64 model.";
+    }
+  }
+}
+
+// Schedule for the traversal row loop
+inline detail::threading_utils::ParallelSchedule RowSchedule(Configuration const& config) {
+  return config.use_work_stealing ? detail::threading_utils::ParallelSchedule::WorkStealing()
+                                  : detail::threading_utils::ParallelSchedule::Static();
+}
+
+// Build a ThreadConfig from the GTIL configuration
+inline detail::threading_utils::ThreadConfig MakeThreadConfig(Configuration const& config) {
+  namespace tu = detail::threading_utils;
+  tu::ThreadConfig thread_config{config.nthread,
+      config.use_thread_pool ? tu::ParallelBackend::kThreadPool : tu::ParallelBackend::kOpenMP};
+  switch (config.thread_affinity) {
+  case ThreadAffinity::kNone:
+    break;
+  case ThreadAffinity::kCompact:
+    thread_config.affinity = tu::AffinityPolicy::kCompact;
+    break;
+  case ThreadAffinity::kScatter:
+    thread_config.affinity = tu::AffinityPolicy::kScatter;
+    break;
+  case ThreadAffinity::kExplicit:
+    TREELITE_CHECK(!config.affinity_cpu_list.empty())
+        << "Thread affinity policy \"explicit\" requires a non-empty affinity_cpu_list";
+    thread_config.affinity = tu::AffinityPolicy::kExplicit;
+    thread_config.cpu_list = config.affinity_cpu_list;
+    break;
+  }
+  return thread_config;
+}
+
+/*!
+ * \brief Whether the cascade engine handles this (model, config) pair. Validates the
+ *        configuration when the cascade is requested for an applicable prediction type.
+ */
+inline bool UseCascade(Model const& model, Configuration const& config) {
+  if (config.cascade_stage_size == 0) {
+    return false;
+  }
+  if (config.pred_kind != PredictKind::kPredictDefault
+      && config.pred_kind != PredictKind::kPredictRaw) {
+    // Per-tree and leaf-ID predictions need every tree by definition
+    return false;
+  }
+  TREELITE_CHECK(model.num_target == 1 && model.num_class[0] == 1
+                 && model.leaf_vector_shape[0] * model.leaf_vector_shape[1] == 1)
+      << "Cascade prediction requires a single-target model with scalar outputs";
+  TREELITE_CHECK_LE(config.cascade_threshold_low, config.cascade_threshold_high)
+      << "cascade_threshold_low must not exceed cascade_threshold_high";
+  return true;
+}
+
+/*!
+ * \brief Row-blocked traversal with staged early exit: trees are evaluated in stages of
+ *        config.cascade_stage_size, and at each stage boundary the rows whose partial raw
+ *        score has left (cascade_threshold_low, cascade_threshold_high) are dropped from
+ *        the block's active list. On ensembles where most rows are decided early, only the
+ *        undecided tail pays for the full ensemble. Retired rows keep their partial score;
+ *        the "default" kind post-processes each block in place like PredictDefault.
+ */
+template <typename InputViewT, typename OutputT>
+void PredictCascade(Model const& model, InputViewT input_view, std::uint64_t num_row,
+    OutputT* output, Configuration const& config,
+    detail::threading_utils::ThreadConfig const& thread_config) {
+  auto output_view = Array3DView<OutputT>(output, 1, num_row, 1);
+  std::size_t const num_tree = model.GetNumTree();
+  std::size_t const stage_size = config.cascade_stage_size;
+  auto const threshold_low = static_cast<OutputT>(config.cascade_threshold_low);
+  auto const threshold_high = static_cast<OutputT>(config.cascade_threshold_high);
+  bool const fused_default = config.pred_kind == PredictKind::kPredictDefault;
+  PostProcessorFunc<OutputT> postprocessor_func
+      = fused_default ? GetPostProcessorFunc<OutputT>(model.postprocessor) : nullptr;
+  std::vector<std::size_t> average_factor;
+  if (model.average_tree_output) {
+    average_factor = ComputeAverageFactor(model, 1);
+  }
+  std::uint64_t const num_block = (num_row + kRowBlockSize - 1) / kRowBlockSize;
+  TREELITE_TRACE_SCOPE("gtil::cascade_traversal");
+  std::visit(
+      [&](auto&& concrete_model) {
+        detail::threading_utils::ParallelFor(std::uint64_t(0), num_block, thread_config,
+            RowSchedule(config), [&](std::uint64_t block_id, int) {
+              std::uint64_t const row_begin = block_id * kRowBlockSize;
+              std::uint64_t const row_end = std::min(row_begin + kRowBlockSize, num_row);
+              ZeroOutputRows(output_view, row_begin, row_end);
+              // IDs of the rows still undecided, compacted at every stage boundary
+              std::uint32_t active[kRowBlockSize];
+              std::uint64_t num_active = row_end - row_begin;
+              for (std::uint64_t i = 0; i < num_active; ++i) {
+                active[i] = static_cast<std::uint32_t>(row_begin + i);
+              }
+              for (std::size_t stage_begin = 0; stage_begin < num_tree && num_active > 0;
+                   stage_begin += stage_size) {
+                std::size_t const stage_end = std::min(stage_begin + stage_size, num_tree);
+                // Tree-block tiling within the stage, as in PredictRawImpl
+                for (std::size_t tree_begin = stage_begin; tree_begin < stage_end;
+                     tree_begin += kTreeBlockSize) {
+                  std::size_t const tree_end = std::min(tree_begin + kTreeBlockSize, stage_end);
+                  for (std::uint64_t i = 0; i < num_active; ++i) {
+                    std::uint64_t const row_id = active[i];
+                    auto row = stdex::submdspan(input_view, row_id, stdex::full_extent);
+                    for (std::size_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+                      auto const& tree = concrete_model.trees[tree_id];
+                      int const leaf_id = EvaluateTree(tree, row);
+                      output_view(0, row_id, 0) += static_cast<OutputT>(tree.LeafValue(leaf_id));
+                    }
+                  }
+                }
+                if (stage_end < num_tree) {
+                  std::uint64_t num_kept = 0;
+                  for (std::uint64_t i = 0; i < num_active; ++i) {
+                    OutputT const score = output_view(0, active[i], 0);
+                    if (score > threshold_low && score < threshold_high) {
+                      active[num_kept++] = active[i];
+                    }
+                  }
+                  num_active = num_kept;
+                }
+              }
+              if (fused_default) {
+                FinalizeRowRange(model, row_begin, row_end,
+                    average_factor.empty() ? nullptr : average_factor.data(),
+                    std::int32_t(1), postprocessor_func, output_view);
+              }
+            });
+      },
+      model.variant_);
+  if (!fused_default) {
+    ApplyAverageFactorAndBaseScores(model, num_row, 1, output_view, thread_config,
+        average_factor.empty() ? nullptr : &average_factor);
+  }
+}
+
+// Prediction-kind dispatch shared by the row-major and column-major dense entry points;
+// the traversal loops are generic over the input view's layout. kNoMissing carries an
+// all-valid guarantee into the default and raw traversal kernels; the remaining kinds
+// (and the cascade) read little per node and keep the ordinary NaN-checking kernels.
+template <bool kNoMissing = false, typename InputViewT, typename OutputT>
+void PredictDense(Model const& model, InputViewT input_view, std::uint64_t num_row,
+    OutputT* output, Configuration const& config) {
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("gtil::predict");
+  auto thread_config = MakeThreadConfig(config);
+  if (UseCascade(model, config)) {
+    PredictCascade(model, input_view, num_row, output, config, thread_config);
+    return;
+  }
+  if (config.pred_kind == PredictKind::kPredictDefault) {
+    PredictDefault<false, kNoMissing>(model, input_view, num_row, output, thread_config,
+        RowSchedule(config), gtil::GetPostProcessorFunc<OutputT>(model.postprocessor),
+        config.use_fast_math ? gtil::GetPostProcessorBatchFunc<OutputT>(model.postprocessor)
+                             : nullptr);
+  } else if (config.pred_kind == PredictKind::kPredictRaw) {
+    PredictRaw<false, kNoMissing>(
+        model, input_view, num_row, output, thread_config, RowSchedule(config));
+  } else if (config.pred_kind == PredictKind::kPredictLeafID) {
+    PredictLeaf(model, input_view, num_row, output, thread_config, RowSchedule(config));
+  } else if (config.pred_kind == PredictKind::kPredictPerTree) {
+    PredictScoreByTree(model, input_view, num_row, output, thread_config, RowSchedule(config));
+  } else {
+    TREELITE_LOG(FATAL) << "Not implemented";
+  }
+}
+
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint64_t num_row, OutputT* output,
+    Configuration const& config) {
+  CheckInputOutputType<InputT, OutputT>(model);
+  PredictDense(
+      model, CArray2DView<InputT>(input, num_row, model.num_feature), num_row, output, config);
+}
+
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint8_t const* validity,
+    std::uint64_t num_row, OutputT* output, Configuration const& config) {
+  CheckInputOutputType<InputT, OutputT>(model);
+  auto const num_feature = static_cast<std::uint64_t>(model.num_feature);
+  if (validity == nullptr) {
+    // All cells guaranteed valid: dispatch traversal kernels with the per-node NaN check
+    // compiled out
+    PredictDense<true>(
+        model, CArray2DView<InputT>(input, num_row, num_feature), num_row, output, config);
+    return;
+  }
+  // Cells under a cleared bit may hold arbitrary payloads, so the bitmap is consulted once
+  // up front: masked cells are rewritten as NaN in a batch-local copy and the ordinary
+  // kernels run unchanged, instead of every node visit testing the bitmap
+  std::vector<InputT> masked(num_row * num_feature);
+  auto thread_config = MakeThreadConfig(config);
+  detail::threading_utils::ParallelFor(std::uint64_t(0), num_row, thread_config,
+      detail::threading_utils::ParallelSchedule::Static(), [&](std::uint64_t row_id, int) {
+        for (std::uint64_t col = 0; col < num_feature; ++col) {
+          std::uint64_t const cell = row_id * num_feature + col;
+          bool const valid = ((validity[cell / 8] >> (cell % 8)) & 1) != 0;
+          masked[cell] = valid ? input[cell] : std::numeric_limits<InputT>::quiet_NaN();
+        }
+      });
+  PredictDense(
+      model, CArray2DView<InputT>(masked.data(), num_row, num_feature), num_row, output, config);
+}
+
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, InputLayout layout, std::uint64_t num_row,
+    OutputT* output, Configuration const& config) {
+  CheckInputOutputType<InputT, OutputT>(model);
+  if (layout == InputLayout::kRowMajor) {
+    PredictDense(
+        model, CArray2DView<InputT>(input, num_row, model.num_feature), num_row, output, config);
+  } else {
+    // Columnar (Arrow-style) batches are consumed in place: rows become strided slices
+    PredictDense(model, CColMajorArray2DView<InputT>(input, num_row, model.num_feature), num_row,
+        output, config);
+  }
+}
+
+template <typename InputT, typename OutputT>
+void Predict(Model const& model, InputT const* input, std::uint64_t num_row,
+    std::uint64_t row_stride, std::uint64_t elem_stride, OutputT* output,
+    Configuration const& config) {
+  CheckInputOutputType<InputT, OutputT>(model);
+  TREELITE_CHECK_GT(row_stride, 0) << "row_stride must be positive";
+  TREELITE_CHECK_GT(elem_stride, 0) << "elem_stride must be positive";
+  using ExtentsT = stdex::dextents<std::uint64_t, 2>;
+  auto const mapping = stdex::layout_stride::mapping<ExtentsT>{
+      ExtentsT{num_row, static_cast<std::uint64_t>(model.num_feature)},
+      std::array<std::uint64_t, 2>{row_stride, elem_stride}};
+  PredictDense(model, CStridedArray2DView<InputT>{input, mapping}, num_row, output, config);
+}
+
+void Warmup(Model const& model, Configuration const& config) {
+  // Fault in the model's pages first, with kernel read-ahead where available
+  model.Warmup();
+  // Then run one row block of synthetic rows through the configured prediction path, so
+  // the traversal loops, the thread pool, and the post-processor tables are all hot before
+  // real traffic arrives. Alternate all-zero and all-missing rows, so both comparison
+  // outcomes and the default (missing-value) branches get exercised.
+  auto const run = [&](auto type_tag) {
+    using InputT = decltype(type_tag);
+    std::uint64_t const num_row = kRowBlockSize;
+    std::vector<InputT> input(num_row * model.num_feature, InputT(0));
+    for (std::uint64_t row_id = 1; row_id < num_row; row_id += 2) {
+      std::fill_n(input.begin() + row_id * model.num_feature, model.num_feature,
+          std::numeric_limits<InputT>::quiet_NaN());
+    }
+    auto const output_shape = GetOutputShape(model, num_row, config);
+    std::uint64_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<InputT> output(output_size);
+    Predict(model, input.data(), num_row, output.data(), config);
+  };
+  if (model.GetThresholdType() == TypeInfo::kFloat32) {
+    run(float{});
+  } else {
+    run(double{});
+  }
+}
+
+template <typename InputT>
+void Predict(Model const& model, InputT const* input, std::uint64_t num_row, InputT* output,
+    Configuration const& config, PredictionStats* stats) {
+  CheckInputType<InputT>(model);
+  *stats = PredictionStats{};
+  auto thread_config = MakeThreadConfig(config);
+  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
+  if (config.pred_kind == PredictKind::kPredictDefault) {
+    PredictDefault<true>(model, input_view, num_row, output, thread_config, RowSchedule(config),
+        gtil::GetPostProcessorFunc<InputT>(model.postprocessor),
+        config.use_fast_math ? gtil::GetPostProcessorBatchFunc<InputT>(model.postprocessor)
+                             : nullptr,
+        stats);
+  } else if (config.pred_kind == PredictKind::kPredictRaw) {
+    PredictRaw<true>(
+        model, input_view, num_row, output, thread_config, RowSchedule(config), stats);
+  } else {
+    // Statistics are only collected for the default and raw prediction kinds
+    Predict(model, input, num_row, output, config);
+    stats->num_row = num_row;
+  }
+}
+
+template <typename InputT>
+void Predict(CompiledModel const& compiled_model, InputT const* input, std::uint64_t num_row,
+    InputT* output, Configuration const& config) {
+  Model const& model = compiled_model.GetSourceModel();
+  CompiledModelImpl const& compiled = compiled_model.Impl();
+  CheckInputType<InputT>(model);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("gtil::predict");
+  auto thread_config = MakeThreadConfig(config);
   if (config.pred_kind == PredictKind::kPredictDefault) {
-    PredictRaw(model, input, num_row, output, thread_config);
-    ApplyPostProcessor(model, output, num_row, config, thread_config);
+    PredictDefault(compiled, input, num_row, output, thread_config, config.use_simd,
+        RowSchedule(config), gtil::GetPostProcessorFunc<InputT>(model.postprocessor),
+        config.use_fast_math ? gtil::GetPostProcessorBatchFunc<InputT>(model.postprocessor)
+                             : nullptr);
   } else if (config.pred_kind == PredictKind::kPredictRaw) {
-    PredictRaw(model, input, num_row, output, thread_config);
+    PredictRaw(compiled, input, num_row, output, thread_config, config.use_simd,
+        RowSchedule(config));
   } else if (config.pred_kind == PredictKind::kPredictLeafID) {
-    PredictLeaf(model, input, num_row, output, thread_config);
+    // Leaf IDs are identical between the compiled and the original representation
+    PredictLeaf(model, CArray2DView<InputT>(input, num_row, model.num_feature), num_row, output,
+        thread_config, RowSchedule(config));
   } else if (config.pred_kind == PredictKind::kPredictPerTree) {
-    PredictScoreByTree(model, input, num_row, output, thread_config);
+    PredictScoreByTree(model, CArray2DView<InputT>(input, num_row, model.num_feature), num_row,
+        output, thread_config, RowSchedule(config));
   } else {
     TREELITE_LOG(FATAL) << "Not implemented";
   }
 }
 
+template <typename InputT, typename OutputT>
+void Predict(NumaReplicatedModel const& replicated_model, InputT const* input,
+    std::uint64_t num_row, OutputT* output, Configuration const& config) {
+  Model const& model = replicated_model.GetSourceModel();
+  NumaReplicatedModelImpl const& numa = replicated_model.Impl();
+  CheckInputOutputType<InputT, OutputT>(model);
+  auto thread_config = MakeThreadConfig(config);
+  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
+  if (config.pred_kind == PredictKind::kPredictDefault) {
+    PredictDefault(model, input_view, num_row, output, thread_config, RowSchedule(config),
+        gtil::GetPostProcessorFunc<OutputT>(model.postprocessor),
+        config.use_fast_math ? gtil::GetPostProcessorBatchFunc<OutputT>(model.postprocessor)
+                             : nullptr,
+        nullptr, &numa);
+  } else if (config.pred_kind == PredictKind::kPredictRaw) {
+    PredictRaw(
+        model, input_view, num_row, output, thread_config, RowSchedule(config), nullptr, &numa);
+  } else {
+    // The remaining prediction kinds read little tree data per row; use the source model
+    Predict(model, input, num_row, output, config);
+  }
+}
+
+template <typename InputT, typename OutputT>
+void PredictMulti(std::vector<Model const*> const& models, InputT const* input,
+    std::uint64_t num_row, std::vector<OutputT*> const& outputs, Configuration const& config) {
+  TREELITE_CHECK(!models.empty()) << "PredictMulti requires at least one model";
+  TREELITE_CHECK_EQ(models.size(), outputs.size())
+      << "PredictMulti requires one output buffer per model";
+  for (Model const* model : models) {
+    CheckInputOutputType<InputT, OutputT>(*model);
+    TREELITE_CHECK_EQ(model->num_feature, models.front()->num_feature)
+        << "All models passed to PredictMulti must consume the same feature set";
+  }
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("gtil::predict");
+  auto thread_config = MakeThreadConfig(config);
+  if ((config.pred_kind != PredictKind::kPredictDefault
+          && config.pred_kind != PredictKind::kPredictRaw)
+      || UseTreeParallel(num_row, thread_config)) {
+    // The remaining prediction kinds are light on input bandwidth, and a batch small
+    // enough for the tree-parallel schedule fits in cache anyway; score independently
+    for (std::size_t i = 0; i < models.size(); ++i) {
+      Predict(*models[i], input, num_row, outputs[i], config);
+    }
+    return;
+  }
+  std::vector<MultiModelTarget<OutputT>> targets;
+  targets.reserve(models.size());
+  for (std::size_t i = 0; i < models.size(); ++i) {
+    Model const& model = *models[i];
+    MultiModelTarget<OutputT> target;
+    target.model = &model;
+    target.output = outputs[i];
+    target.max_num_class
+        = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+    target.output_view
+        = Array3DView<OutputT>(outputs[i], model.num_target, num_row, target.max_num_class);
+    if (config.pred_kind == PredictKind::kPredictDefault) {
+      if (model.average_tree_output) {
+        target.average_factor = ComputeAverageFactor(model, target.max_num_class);
+      }
+      target.postprocessor_func = gtil::GetPostProcessorFunc<OutputT>(model.postprocessor);
+      if (config.use_fast_math) {
+        target.postprocessor_batch_func
+            = gtil::GetPostProcessorBatchFunc<OutputT>(model.postprocessor);
+      }
+    }
+    targets.push_back(std::move(target));
+  }
+  PredictMultiImpl(targets, input, num_row, thread_config, RowSchedule(config),
+      config.pred_kind == PredictKind::kPredictDefault);
+  if (config.pred_kind == PredictKind::kPredictRaw) {
+    for (auto& target : targets) {
+      ApplyAverageFactorAndBaseScores(
+          *target.model, num_row, target.max_num_class, target.output_view, thread_config);
+    }
+  }
+}
+
+template <typename InputT>
+void Predict(
+    Model const& model, CSRView<InputT> input, InputT* output, Configuration const& config) {
+  CheckInputType<InputT>(model);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("gtil::predict");
+  auto thread_config = MakeThreadConfig(config);
+  if (config.pred_kind == PredictKind::kPredictDefault) {
+    PredictRaw(model, input, output, thread_config);
+    ApplyPostProcessor(model, output, input.num_row, config, thread_config);
+  } else if (config.pred_kind == PredictKind::kPredictRaw) {
+    PredictRaw(model, input, output, thread_config);
+  } else if (config.pred_kind == PredictKind::kPredictLeafID) {
+    PredictLeaf(model, input, output, thread_config);
+  } else if (config.pred_kind == PredictKind::kPredictPerTree) {
+    PredictScoreByTree(model, input, output, thread_config);
+  } else {
+    TREELITE_LOG(FATAL) << "Not implemented";
+  }
+}
+
+template <typename InputT>
+void PredictLeaf(Model const& model, InputT const* input, std::uint64_t num_row,
+    std::int32_t* output, Configuration const& config) {
+  CheckInputType<InputT>(model);
+  auto thread_config = MakeThreadConfig(config);
+  PredictLeaf(model, CArray2DView<InputT>(input, num_row, model.num_feature), num_row, output,
+      thread_config, RowSchedule(config));
+}
+
+/*! \brief Cached state of PredictSession: everything Predict() would set up per call */
+struct PredictSessionImpl {
+  Model const* model;
+  Configuration config;
+  detail::threading_utils::ThreadConfig thread_config;
+  // Post-processors resolved once; the alternatives match the model's leaf output type
+  std::variant<PostProcessorFunc<float>, PostProcessorFunc<double>> postprocessor_func;
+  std::variant<PostProcessorBatchFunc<float>, PostProcessorBatchFunc<double>>
+      postprocessor_batch_func;
+  // Tree-averaging divisors, computed once; empty when the model does not average
+  std::vector<std::size_t> average_factor;
+
+  PredictSessionImpl(Model const& model, Configuration const& config)
+      : model{&model}, config{config}, thread_config{MakeThreadConfig(config)} {
+    if (model.GetLeafOutputType() == TypeInfo::kFloat32) {
+      postprocessor_func = GetPostProcessorFunc<float>(model.postprocessor);
+      postprocessor_batch_func = GetPostProcessorBatchFunc<float>(model.postprocessor);
+    } else {
+      postprocessor_func = GetPostProcessorFunc<double>(model.postprocessor);
+      postprocessor_batch_func = GetPostProcessorBatchFunc<double>(model.postprocessor);
+    }
+    if (model.average_tree_output) {
+      auto max_num_class
+          = *std::max_element(model.num_class.Data(), model.num_class.Data() + model.num_target);
+      average_factor = ComputeAverageFactor(model, max_num_class);
+    }
+  }
+};
+
+PredictSession::PredictSession(Model const& model, Configuration const& config)
+    : impl_{std::make_unique<PredictSessionImpl>(model, config)} {}
+PredictSession::~PredictSession() = default;
+PredictSession::PredictSession(PredictSession&&) noexcept = default;
+PredictSession& PredictSession::operator=(PredictSession&&) noexcept = default;
+
+std::vector<std::uint64_t> PredictSession::GetOutputShape(std::uint64_t num_row) const {
+  return gtil::GetOutputShape(*impl_->model, num_row, impl_->config);
+}
+
+template <typename InputT>
+void PredictSession::Predict(InputT const* input, std::uint64_t num_row, InputT* output) const {
+  Model const& model = *impl_->model;
+  CheckInputType<InputT>(model);  // cheap; only builds strings on failure
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("gtil::predict");
+  auto const& config = impl_->config;
+  auto const& thread_config = impl_->thread_config;
+  auto input_view = CArray2DView<InputT>(input, num_row, model.num_feature);
+  auto const* average_factor
+      = model.average_tree_output ? &impl_->average_factor : nullptr;
+  if (UseCascade(model, config)) {
+    PredictCascade(model, input_view, num_row, output, config, thread_config);
+    return;
+  }
+  if (config.pred_kind == PredictKind::kPredictDefault) {
+    PredictDefault(model, input_view, num_row, output, thread_config, RowSchedule(config),
+        std::get<PostProcessorFunc<InputT>>(impl_->postprocessor_func),
+        config.use_fast_math
+            ? std::get<PostProcessorBatchFunc<InputT>>(impl_->postprocessor_batch_func)
+            : nullptr,
+        nullptr, nullptr, average_factor);
+  } else if (config.pred_kind == PredictKind::kPredictRaw) {
+    PredictRaw(model, input_view, num_row, output, thread_config, RowSchedule(config), nullptr,
+        nullptr, average_factor);
+  } else if (config.pred_kind == PredictKind::kPredictLeafID) {
+    PredictLeaf(model, input_view, num_row, output, thread_config, RowSchedule(config));
+  } else if (config.pred_kind == PredictKind::kPredictPerTree) {
+    PredictScoreByTree(model, input_view, num_row, output, thread_config, RowSchedule(config));
+  } else {
+    TREELITE_LOG(FATAL) << "Not implemented";
+  }
+}
+
+template <typename InputT>
+void PredictStream(Model const& model, ChunkReadFunc<InputT> reader, ChunkWriteFunc<InputT> writer,
+    std::uint64_t chunk_rows, Configuration const& config) {
+  TREELITE_CHECK_GT(chunk_rows, 0) << "chunk_rows must be positive";
+  TREELITE_CHECK(reader) << "reader callback must not be empty";
+  TREELITE_CHECK(writer) << "writer callback must not be empty";
+  PredictSession session{model, config};
+  auto const chunk_shape = session.GetOutputShape(chunk_rows);
+  std::uint64_t const chunk_output_size = std::accumulate(
+      chunk_shape.begin(), chunk_shape.end(), std::uint64_t(1), std::multiplies<>());
+  auto const num_feature = static_cast<std::uint64_t>(model.num_feature);
+
+  /* Two sets of buffers; while chunk k is being traversed, chunk (k+1) is read into the
+   * other input buffer and the predictions for chunk (k-1) drain from the other output
+   * buffer, both on background threads. At most one read and one write are in flight, and
+   * writes are issued in chunk order, so the writer sees an ordered stream. */
+  std::vector<InputT> input_buffer[2];
+  std::vector<InputT> output_buffer[2];
+  for (int i = 0; i < 2; ++i) {
+    input_buffer[i].resize(chunk_rows * num_feature);
+    output_buffer[i].resize(chunk_output_size);
+  }
+  auto issue_read = [&reader, chunk_rows](InputT* buffer) {
+    return std::async(std::launch::async,
+        [&reader, buffer, chunk_rows]() { return reader(buffer, chunk_rows); });
+  };
+  std::future<std::uint64_t> read_future = issue_read(input_buffer[0].data());
+  std::future<void> write_future;
+  int cur = 0;
+  for (;;) {
+    std::uint64_t const num_row = read_future.get();
+    if (num_row == 0) {
+      break;
+    }
+    TREELITE_CHECK_LE(num_row, chunk_rows) << "reader produced more rows than requested";
+    read_future = issue_read(input_buffer[1 - cur].data());
+    // output_buffer[cur] was last handed to the writer two chunks ago; that write completed
+    // before the previous chunk's write was issued, so the buffer is free to overwrite.
+    session.Predict(input_buffer[cur].data(), num_row, output_buffer[cur].data());
+    if (write_future.valid()) {
+      write_future.get();
+    }
+    write_future = std::async(std::launch::async,
+        [&writer, output = output_buffer[cur].data(), num_row]() { writer(output, num_row); });
+    cur = 1 - cur;
+  }
+  if (write_future.valid()) {
+    write_future.get();
+  }
+}
+
 template void Predict<float>(
     Model const&, float const*, std::uint64_t, float*, Configuration const&);
 template void Predict<double>(
     Model const&, double const*, std::uint64_t, double*, Configuration const&);
+template void Predict<float, double>(
+    Model const&, float const*, std::uint64_t, double*, Configuration const&);
+template void Predict<float>(Model const&, float const*, std::uint8_t const*, std::uint64_t,
+    float*, Configuration const&);
+template void Predict<double>(Model const&, double const*, std::uint8_t const*, std::uint64_t,
+    double*, Configuration const&);
+template void Predict<float, double>(Model const&, float const*, std::uint8_t const*,
+    std::uint64_t, double*, Configuration const&);
+template void Predict<float>(
+    Model const&, float const*, InputLayout, std::uint64_t, float*, Configuration const&);
+template void Predict<double>(
+    Model const&, double const*, InputLayout, std::uint64_t, double*, Configuration const&);
+template void Predict<float, double>(
+    Model const&, float const*, InputLayout, std::uint64_t, double*, Configuration const&);
+template void Predict<float>(Model const&, float const*, std::uint64_t, std::uint64_t,
+    std::uint64_t, float*, Configuration const&);
+template void Predict<double>(Model const&, double const*, std::uint64_t, std::uint64_t,
+    std::uint64_t, double*, Configuration const&);
+template void Predict<float, double>(Model const&, float const*, std::uint64_t, std::uint64_t,
+    std::uint64_t, double*, Configuration const&);
+template void Predict<float>(
+    Model const&, float const*, std::uint64_t, float*, Configuration const&, PredictionStats*);
+template void Predict<double>(
+    Model const&, double const*, std::uint64_t, double*, Configuration const&, PredictionStats*);
+template void PredictSession::Predict<float>(float const*, std::uint64_t, float*) const;
+template void PredictSession::Predict<double>(double const*, std::uint64_t, double*) const;
+template void Predict<float>(Model const&, CSRView<float>, float*, Configuration const&);
+template void Predict<double>(Model const&, CSRView<double>, double*, Configuration const&);
+template void PredictLeaf<float>(
+    Model const&, float const*, std::uint64_t, std::int32_t*, Configuration const&);
+template void PredictLeaf<double>(
+    Model const&, double const*, std::uint64_t, std::int32_t*, Configuration const&);
+template void Predict<float>(
+    CompiledModel const&, float const*, std::uint64_t, float*, Configuration const&);
+template void Predict<double>(
+    CompiledModel const&, double const*, std::uint64_t, double*, Configuration const&);
+template void Predict<float>(
+    NumaReplicatedModel const&, float const*, std::uint64_t, float*, Configuration const&);
+template void Predict<double>(
+    NumaReplicatedModel const&, double const*, std::uint64_t, double*, Configuration const&);
+template void Predict<float, double>(
+    NumaReplicatedModel const&, float const*, std::uint64_t, double*, Configuration const&);
+template void PredictMulti<float>(std::vector<Model const*> const&, float const*, std::uint64_t,
+    std::vector<float*> const&, Configuration const&);
+template void PredictMulti<double>(std::vector<Model const*> const&, double const*, std::uint64_t,
+    std::vector<double*> const&, Configuration const&);
+template void PredictMulti<float, double>(std::vector<Model const*> const&, float const*,
+    std::uint64_t, std::vector<double*> const&, Configuration const&);
+template void PredictStream<float>(
+    Model const&, ChunkReadFunc<float>, ChunkWriteFunc<float>, std::uint64_t, Configuration const&);
+template void PredictStream<double>(Model const&, ChunkReadFunc<double>, ChunkWriteFunc<double>,
+    std::uint64_t, Configuration const&);
 
 }  // namespace treelite::gtil
@@ -0,0 +1,122 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file scratch.h
+ * \author Hyunsu Cho
+ * \brief Per-thread, per-model scratch arenas for the GTIL prediction engine
+ */
+
+#ifndef SRC_GTIL_SCRATCH_H_
+#define SRC_GTIL_SCRATCH_H_
+
+#include <treelite/thread_local.h>
+#include <treelite/tree.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace treelite {
+namespace gtil {
+
+/*! \brief Named scratch buffers within one arena. Each slot has at most one live use at a
+ *         time within a Predict call. */
+enum class ScratchSlot : int {
+  /*! \brief Private accumulators of the tree-parallel schedule */
+  kPartialSums = 0,
+  /*! \brief Binned input rows for quantized trees */
+  kQuantizedInput,
+  /*! \brief Densified row for sparse (CSR) inputs */
+  kDenseRow,
+  /*! \brief Decoded category codes of the block's rows, for models with categorical tests */
+  kCategoryCodes,
+  /*! \brief One decoded leaf vector, for models compiled with reduced leaf precision */
+  kDecodedLeafVector,
+  /*! \brief Per-thread pointer table used to reduce worker buffers on the calling thread */
+  kPointerTable,
+  kScratchSlotCount_
+};
+
+/*!
+ * \brief Scratch arena backing one (thread, model) pair. Buffers grow on first use and keep
+ *        their capacity across Predict calls, so steady-state prediction does not allocate.
+ *        Buffer contents are unspecified on entry; callers that need zero- or NaN-filled
+ *        memory must fill it themselves.
+ */
+class ScratchArena {
+ public:
+  /*!
+   * \brief Get the buffer for the given slot, grown to hold at least count elements of T.
+   *        The returned pointer stays valid until the next Get() call for the same slot.
+   * \param slot Slot to fetch
+   * \param count Minimum number of elements of type T the buffer must hold
+   */
+  template <typename T>
+  T* Get(ScratchSlot slot, std::size_t count) {
+    auto& buffer = buffers_[static_cast<int>(slot)];
+    // Backing store is an array of uint64_t, so any scalar or pointer type is
+    // sufficiently aligned
+    std::size_t const num_words = (count * sizeof(T) + sizeof(std::uint64_t) - 1)
+                                  / sizeof(std::uint64_t);
+    if (buffer.size < num_words) {
+      buffer.data = std::make_unique<std::uint64_t[]>(num_words);
+      buffer.size = num_words;
+    }
+    return reinterpret_cast<T*>(buffer.data.get());
+  }
+
+ private:
+  struct Buffer {
+    std::unique_ptr<std::uint64_t[]> data{nullptr};
+    std::size_t size{0};  // in words of uint64_t
+  };
+  std::array<Buffer, static_cast<int>(ScratchSlot::kScratchSlotCount_)> buffers_;
+};
+
+/*!
+ * \brief Thread-local registry of scratch arenas, keyed by model identity. Entries are
+ *        created on first use and dropped lazily after their model is destroyed: a stale
+ *        entry is detected through the model's expired instance token, either when a new
+ *        model reuses the same key or during the periodic sweep.
+ */
+class ScratchStore {
+ public:
+  /*! \brief Get the calling thread's scratch arena for the given model */
+  static ScratchArena& Get(Model const& model) {
+    std::shared_ptr<void> token = model.GetInstanceToken();
+    auto* map = ThreadLocalStore<ArenaMap>::Get();
+    auto [it, inserted] = map->try_emplace(token.get());
+    if (inserted || it->second.token.expired()) {
+      if (!inserted) {
+        // A destroyed model's token was reused for this model; drop the stale buffers
+        it->second.arena = ScratchArena{};
+      }
+      it->second.token = token;
+      if (map->size() > kSweepThreshold) {
+        for (auto sweep_it = map->begin(); sweep_it != map->end();) {
+          if (sweep_it->first != token.get() && sweep_it->second.token.expired()) {
+            sweep_it = map->erase(sweep_it);
+          } else {
+            ++sweep_it;
+          }
+        }
+      }
+    }
+    return it->second.arena;
+  }
+
+ private:
+  struct Entry {
+    std::weak_ptr<void> token;
+    ScratchArena arena;
+  };
+  using ArenaMap = std::unordered_map<void const*, Entry>;
+  // Sweep expired entries once the map outgrows this many models
+  static constexpr std::size_t kSweepThreshold = 16;
+};
+
+}  // namespace gtil
+}  // namespace treelite
+
+#endif  // SRC_GTIL_SCRATCH_H_
@@ -0,0 +1,127 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file simd.h
+ * \author Hyunsu Cho
+ * \brief Vectorized tree evaluation kernels, operating on the compiled (flattened)
+ *        model representation
+ */
+
+#ifndef SRC_GTIL_SIMD_H_
+#define SRC_GTIL_SIMD_H_
+
+#include <treelite/enum/operator.h>
+#include <treelite/logging.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "./compiled_model.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace treelite::gtil {
+
+#if defined(__AVX2__)
+
+constexpr bool kHasSimdKernel = true;
+/*! \brief Number of rows evaluated in lockstep by the vectorized kernel */
+constexpr std::uint64_t kSimdRowGroupSize = 8;
+
+namespace detail_simd {
+
+/*!
+ * \brief Evaluate one compiled tree for 8 consecutive rows in lockstep, with the comparison
+ *        operator fixed at compile time. All 8 lanes advance one tree level per iteration:
+ *        node records are fetched with gathers, feature values are compared against the
+ *        per-lane thresholds, and the next node IDs are selected with blends. Lanes that
+ *        reached a leaf keep their node ID frozen until all lanes are done.
+ */
+template <int CmpImm>
+inline void EvaluateTreeSimdX8Impl(CompiledTree<float, float> const& tree,
+    float const* input_rows, std::int32_t num_feature, std::int32_t* out_leaf_ids) {
+  auto const* base = reinterpret_cast<std::int32_t const*>(tree.nodes.Data());
+  constexpr std::int32_t kNodeSize = static_cast<std::int32_t>(sizeof(CompiledNode<float>));
+  constexpr std::int32_t kCLeftOffset = 4;
+  constexpr std::int32_t kCRightOffset = 8;
+  constexpr std::int32_t kBitsOffset = 12;
+
+  __m256i const minus_one = _mm256_set1_epi32(-1);
+  // Byte offset of each lane's row within input_rows
+  __m256i const row_offset = _mm256_mullo_epi32(
+      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(num_feature));
+
+  __m256i node_id = _mm256_setzero_si256();
+  for (;;) {
+    __m256i const node_offset = _mm256_mullo_epi32(node_id, _mm256_set1_epi32(kNodeSize));
+    __m256i const cleft = _mm256_i32gather_epi32(
+        base, _mm256_add_epi32(node_offset, _mm256_set1_epi32(kCLeftOffset)), 1);
+    __m256i const is_leaf = _mm256_cmpeq_epi32(cleft, minus_one);
+    if (_mm256_movemask_epi8(is_leaf) == -1) {
+      break;
+    }
+    __m256i const cright = _mm256_i32gather_epi32(
+        base, _mm256_add_epi32(node_offset, _mm256_set1_epi32(kCRightOffset)), 1);
+    __m256i const bits = _mm256_i32gather_epi32(
+        base, _mm256_add_epi32(node_offset, _mm256_set1_epi32(kBitsOffset)), 1);
+    __m256 const threshold
+        = _mm256_i32gather_ps(reinterpret_cast<float const*>(base), node_offset, 1);
+    __m256i const split_index
+        = _mm256_and_si256(bits, _mm256_set1_epi32(kCompiledNodeSplitIndexMask));
+    __m256 const fvalue
+        = _mm256_i32gather_ps(input_rows, _mm256_add_epi32(row_offset, split_index), 4);
+    // Comparison is false for NaN (ordered predicate); missing values take the default child
+    __m256i const cond = _mm256_castps_si256(_mm256_cmp_ps(fvalue, threshold, CmpImm));
+    __m256i const is_nan = _mm256_castps_si256(_mm256_cmp_ps(fvalue, fvalue, _CMP_UNORD_Q));
+    // kCompiledNodeDefaultLeftMask is the sign bit, so an arithmetic shift yields the mask
+    __m256i const default_left = _mm256_srai_epi32(bits, 31);
+    __m256i const go_left = _mm256_blendv_epi8(cond, default_left, is_nan);
+    __m256i const next_id = _mm256_blendv_epi8(cright, cleft, go_left);
+    node_id = _mm256_blendv_epi8(next_id, node_id, is_leaf);
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_leaf_ids), node_id);
+}
+
+}  // namespace detail_simd
+
+/*!
+ * \brief Evaluate one compiled tree for 8 consecutive rows simultaneously.
+ *        The tree must have simd_compatible set (numerical test nodes with a uniform
+ *        comparison operator, scalar leaf outputs only).
+ * \param tree Compiled tree to evaluate
+ * \param input_rows Pointer to the first of the 8 rows (dense, row-major)
+ * \param num_feature Number of features per row
+ * \param out_leaf_ids Output buffer for the 8 leaf node IDs
+ */
+inline void EvaluateTreeSimdX8(CompiledTree<float, float> const& tree, float const* input_rows,
+    std::int32_t num_feature, std::int32_t* out_leaf_ids) {
+  switch (tree.uniform_operator) {
+  case Operator::kLT:
+    detail_simd::EvaluateTreeSimdX8Impl<_CMP_LT_OQ>(tree, input_rows, num_feature, out_leaf_ids);
+    break;
+  case Operator::kLE:
+    detail_simd::EvaluateTreeSimdX8Impl<_CMP_LE_OQ>(tree, input_rows, num_feature, out_leaf_ids);
+    break;
+  case Operator::kGT:
+    detail_simd::EvaluateTreeSimdX8Impl<_CMP_GT_OQ>(tree, input_rows, num_feature, out_leaf_ids);
+    break;
+  case Operator::kGE:
+    detail_simd::EvaluateTreeSimdX8Impl<_CMP_GE_OQ>(tree, input_rows, num_feature, out_leaf_ids);
+    break;
+  default:
+    TREELITE_CHECK(false) << "Unsupported operator for vectorized evaluation: "
+                          << OperatorToString(tree.uniform_operator);
+  }
+}
+
+#else  // defined(__AVX2__)
+
+constexpr bool kHasSimdKernel = false;
+constexpr std::uint64_t kSimdRowGroupSize = 1;
+
+#endif  // defined(__AVX2__)
+
+}  // namespace treelite::gtil
+
+#endif  // SRC_GTIL_SIMD_H_
@@ -8,18 +8,23 @@
 
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <treelite/contiguous_array.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/enum/operator.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/tree_node_type.h>
 #include <treelite/logging.h>
 #include <treelite/tree.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <ostream>
 #include <type_traits>
+#include <variant>
+#include <vector>
 
 namespace {
 
@@ -177,9 +182,7 @@ void DumpTreeAsJSON(WriterType& writer, Tree<ThresholdType, LeafOutputType> cons
 }
 
 template <typename WriterType>
-void DumpModelAsJSON(WriterType& writer, Model const& model) {
-  writer.StartObject();
-
+void DumpModelMetadataAsJSON(WriterType& writer, Model const& model) {
   writer.Key("num_feature");
   writer.Int(model.num_feature);
   writer.Key("task_type");
@@ -195,6 +198,13 @@ void DumpModelAsJSON(WriterType& writer, Model const& model) {
   WriteArray(writer, model.class_id);
 
   SerializeModelParametersToJSON(writer, model);
+}
+
+template <typename WriterType>
+void DumpModelAsJSON(WriterType& writer, Model const& model) {
+  writer.StartObject();
+
+  DumpModelMetadataAsJSON(writer, model);
 
   writer.Key("trees");
   writer.StartArray();
@@ -210,15 +220,61 @@ void DumpModelAsJSON(WriterType& writer, Model const& model) {
   writer.EndObject();
 }
 
+/*!
+ * rief Variant of DumpModelAsJSON that renders the trees concurrently. Each worker
+ *        thread renders one tree into a per-thread buffer; the buffers are stitched into
+ *        the output stream in order, one window of trees at a time, so memory stays
+ *        bounded by one rendered tree per thread. The metadata and the rendered trees
+ *        stream straight to the ostream; the whole document is never held in memory.
+ */
+template <typename WriterType>
+void DumpModelAsJSONParallel(WriterType& writer, Model const& model) {
+  namespace threading_utils = treelite::detail::threading_utils;
+
+  writer.StartObject();
+
+  DumpModelMetadataAsJSON(writer, model);
+
+  writer.Key("trees");
+  writer.StartArray();
+  std::visit(
+      [&writer](auto&& concrete_model) {
+        threading_utils::ThreadConfig thread_config(0);
+        std::size_t const num_tree = concrete_model.trees.size();
+        auto const window = static_cast<std::size_t>(thread_config.nthread);
+        std::vector<rapidjson::StringBuffer> buffers(window);
+        for (std::size_t window_begin = 0; window_begin < num_tree; window_begin += window) {
+          std::size_t const window_end = std::min(window_begin + window, num_tree);
+          threading_utils::ParallelFor(window_begin, window_end, thread_config,
+              threading_utils::ParallelSchedule::Static(1), [&](std::size_t tree_id, int) {
+                rapidjson::StringBuffer& buffer = buffers[tree_id - window_begin];
+                buffer.Clear();  // Keeps the allocation from the previous window
+                rapidjson::Writer<rapidjson::StringBuffer> tree_writer(buffer);
+                DumpTreeAsJSON(tree_writer, concrete_model.trees[tree_id]);
+              });
+          for (std::size_t tree_id = window_begin; tree_id < window_end; ++tree_id) {
+            rapidjson::StringBuffer const& buffer = buffers[tree_id - window_begin];
+            writer.RawValue(buffer.GetString(), buffer.GetSize(), rapidjson::kObjectType);
+          }
+        }
+      },
+      model.variant_);
+  writer.EndArray();
+
+  writer.EndObject();
+}
+
 void Model::DumpAsJSON(std::ostream& fo, bool pretty_print) const {
   rapidjson::OStreamWrapper os(fo);
   if (pretty_print) {
+    // PrettyWriter cannot re-indent pre-rendered tree fragments, so the pretty dump
+    // (meant for human inspection of small models) stays single-threaded
     rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(os);
     writer.SetFormatOptions(rapidjson::PrettyFormatOptions::kFormatSingleLineArray);
     DumpModelAsJSON(writer, *this);
   } else {
     rapidjson::Writer<rapidjson::OStreamWrapper> writer(os);
-    DumpModelAsJSON(writer, *this);
+    DumpModelAsJSONParallel(writer, *this);
   }
 }
 
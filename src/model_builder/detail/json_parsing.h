@@ -10,8 +10,8 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
-#include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/typeinfo.h>
 #include <treelite/logging.h>
@@ -214,7 +214,9 @@ std::optional<std::string> ParseAttributes(DocumentT const& obj, std::string con
   if (itr != obj.MemberEnd()) {
     TREELITE_CHECK(itr->value.IsObject()) << "Expected an object for field '" << field_name << "'";
     rapidjson::StringBuffer buffer;
-    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    // Attributes are stored as an opaque JSON string; render them compactly, which is
+    // considerably faster than pretty-printing for large blobs and keeps the string small
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
     itr->value.Accept(writer);
     result = std::string(buffer.GetString());
   } else {
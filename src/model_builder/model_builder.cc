@@ -84,12 +84,21 @@ class ModelBuilderImpl : public ModelBuilder {
   }
 
   void StartTree() override {
-    CheckStateWithDiagnostic("StartTree()", {ModelBuilderState::kExpectTree}, current_state_);
+    std::size_t expected_num_nodes = 0;
+    if (total_node_count_hint_ > 0 && metadata_initialized_ && expected_num_tree_ > 0) {
+      expected_num_nodes = total_node_count_hint_ / expected_num_tree_;
+    }
+    StartTreeImpl(expected_num_nodes);
+  }
 
-    current_tree_ = Tree<ThresholdT, LeafOutputT>();
-    current_tree_.Init();
+  void StartTree(std::size_t expected_num_nodes) override {
+    StartTreeImpl(expected_num_nodes);
+  }
 
-    current_state_ = ModelBuilderState::kExpectNode;
+  void TotalNodeCountHint(std::size_t total_num_nodes) override {
+    TREELITE_CHECK(metadata_initialized_)
+        << "TotalNodeCountHint() requires the metadata to have been initialized";
+    total_node_count_hint_ = total_num_nodes;
   }
 
   void EndTree() override {
@@ -141,6 +150,75 @@ class ModelBuilderImpl : public ModelBuilder {
     current_state_ = ModelBuilderState::kExpectTree;
   }
 
+  void BulkTree(std::int32_t num_nodes, std::vector<std::int32_t> const& left_child,
+      std::vector<std::int32_t> const& right_child, std::vector<std::int32_t> const& split_index,
+      std::vector<double> const& threshold, std::vector<bool> const& default_left, Operator cmp,
+      std::vector<double> const& leaf_value) override {
+    CheckStateWithDiagnostic("BulkTree()", {ModelBuilderState::kExpectTree}, current_state_);
+    TREELITE_CHECK_GT(num_nodes, 0)
+        << "Cannot have an empty tree. Please supply at least one node.";
+    auto const num_nodes_ = static_cast<std::size_t>(num_nodes);
+    TREELITE_CHECK_EQ(left_child.size(), num_nodes_) << "left_child must have num_nodes elements";
+    TREELITE_CHECK_EQ(right_child.size(), num_nodes_) << "right_child must have num_nodes elements";
+    TREELITE_CHECK_EQ(split_index.size(), num_nodes_) << "split_index must have num_nodes elements";
+    TREELITE_CHECK_EQ(threshold.size(), num_nodes_) << "threshold must have num_nodes elements";
+    TREELITE_CHECK_EQ(default_left.size(), num_nodes_)
+        << "default_left must have num_nodes elements";
+    TREELITE_CHECK(!leaf_value.empty() && leaf_value.size() % num_nodes_ == 0)
+        << "leaf_value must have num_nodes times [leaf vector length] elements";
+    std::size_t const leaf_size = leaf_value.size() / num_nodes_;
+    if (metadata_initialized_) {
+      TREELITE_CHECK_EQ(leaf_size, expected_leaf_size_)
+          << "Expected leaf output of length " << expected_leaf_size_;
+    }
+
+    Tree<ThresholdT, LeafOutputT> tree;
+    tree.Init();
+    tree.AllocNodes(num_nodes);
+
+    std::vector<bool> orphaned(num_nodes_, true);
+    orphaned[0] = false;  // Root node is by definition not orphaned
+    std::vector<LeafOutputT> leaf_vector(leaf_size);  // Scratch space for vector leaf outputs
+    for (std::int32_t i = 0; i < num_nodes; ++i) {
+      std::int32_t const cleft = left_child[i];
+      std::int32_t const cright = right_child[i];
+      if (cleft == -1) {
+        TREELITE_CHECK_EQ(cright, -1)
+            << "Node " << i << " has left child -1 (leaf) but right child " << cright;
+        if (leaf_size == 1) {
+          tree.SetLeaf(i, static_cast<LeafOutputT>(leaf_value[i]));
+        } else {
+          std::transform(leaf_value.begin() + i * leaf_size,
+              leaf_value.begin() + (i + 1) * leaf_size, leaf_vector.begin(),
+              [](double e) { return static_cast<LeafOutputT>(e); });
+          tree.SetLeafVector(i, leaf_vector);
+        }
+      } else {
+        TREELITE_CHECK(cleft > 0 && cleft < num_nodes && cright > 0 && cright < num_nodes)
+            << "Node " << i << " has a child index out of range";
+        TREELITE_CHECK(cleft != i && cright != i && cleft != cright)
+            << "Node " << i << " must have two distinct children, other than itself";
+        if (metadata_initialized_) {
+          TREELITE_CHECK_LT(split_index[i], model_->num_feature)
+              << "split_index must be less than num_feature (" << model_->num_feature << ")";
+        }
+        tree.SetNumericalTest(
+            i, split_index[i], static_cast<ThresholdT>(threshold[i]), default_left[i], cmp);
+        tree.SetChildren(i, cleft, cright);
+        orphaned[cleft] = false;
+        orphaned[cright] = false;
+      }
+    }
+    auto itr = std::find(orphaned.begin(), orphaned.end(), true);
+    if (itr != orphaned.end()) {
+      TREELITE_LOG(FATAL) << "Node at index " << (itr - orphaned.begin()) << " is orphaned "
+                          << "-- it cannot be reached from the root node";
+    }
+
+    auto& trees = std::get<ModelPreset<ThresholdT, LeafOutputT>>(model_->variant_).trees;
+    trees.push_back(std::move(tree));
+  }
+
   void StartNode(int node_key) override {
     CheckStateWithDiagnostic("StartNode()", {ModelBuilderState::kExpectNode}, current_state_);
     TREELITE_CHECK_GE(node_key, 0) << "Node key cannot be negative";
@@ -292,6 +370,19 @@ class ModelBuilderImpl : public ModelBuilder {
   int current_node_id_;  // current node ID (internal)
   ModelBuilderState current_state_;
   bool metadata_initialized_{false};
+  std::size_t total_node_count_hint_{0};
+
+  void StartTreeImpl(std::size_t expected_num_nodes) {
+    CheckStateWithDiagnostic("StartTree()", {ModelBuilderState::kExpectTree}, current_state_);
+
+    current_tree_ = Tree<ThresholdT, LeafOutputT>();
+    current_tree_.Init();
+    if (expected_num_nodes > 0) {
+      current_tree_.ReserveNodes(expected_num_nodes);
+    }
+
+    current_state_ = ModelBuilderState::kExpectNode;
+  }
 
   void CheckStateWithDiagnostic(std::string const& func_name,
       std::vector<ModelBuilderState> const& valid_states, ModelBuilderState actual_state) {
@@ -372,6 +463,9 @@ class ModelBuilderImpl : public ModelBuilder {
     expected_num_tree_ = tree_annotation.num_tree;
     expected_leaf_size_ = std::accumulate(metadata.leaf_vector_shape.begin(),
         metadata.leaf_vector_shape.end(), std::int32_t(1), std::multiplies<>{});
+    std::visit(
+        [num_tree](auto&& model_preset) { model_preset.trees.reserve(num_tree); },
+        model_->variant_);
     metadata_initialized_ = true;
   }
 };
@@ -408,8 +502,11 @@ std::unique_ptr<ModelBuilder> GetModelBuilder(TypeInfo threshold_type, TypeInfo
 }
 
 std::unique_ptr<ModelBuilder> GetModelBuilder(std::string const& json_str) {
+  // Parse in situ on a scratch copy: string values then point into the buffer rather than
+  // being copied out one by one, which dominates for specs with large attribute blobs
+  std::vector<char> scratch(json_str.c_str(), json_str.c_str() + json_str.size() + 1);
   rapidjson::Document parsed_json;
-  parsed_json.Parse(json_str);
+  parsed_json.ParseInsitu(scratch.data());
   TREELITE_CHECK(!parsed_json.HasParseError())
       << "Error when parsing JSON string: offset " << parsed_json.GetErrorOffset() << ", "
       << rapidjson::GetParseError_En(parsed_json.GetParseError());
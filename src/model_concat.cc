@@ -5,14 +5,18 @@
  * \author Hyunsu Cho
  */
 
+#include <treelite/detail/threading_utils.h>
 #include <treelite/logging.h>
 #include <treelite/tree.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace treelite {
 
@@ -37,6 +41,73 @@ std::unique_ptr<Model> ConcatenateModelObjects(std::vector<Model const*> const&
   concatenated_model->base_scores = objs[0]->base_scores.Clone();
   concatenated_model->attributes = objs[0]->attributes;
 
+  std::visit(
+      [&objs, &concatenated_model](auto&& first_model_obj) {
+        using ModelType = std::remove_const_t<std::remove_reference_t<decltype(first_model_obj)>>;
+        TREELITE_CHECK(std::holds_alternative<ModelType>(concatenated_model->variant_));
+        auto& concatenated_model_concrete = std::get<ModelType>(concatenated_model->variant_);
+        for (std::size_t i = 0; i < objs.size(); ++i) {
+          TREELITE_CHECK(std::holds_alternative<ModelType>(objs[i]->variant_))
+              << "Model object at index " << i
+              << " has a different type than the first model object (at index 0)";
+          TREELITE_CHECK_EQ(concatenated_model->num_target, objs[i]->num_target)
+              << "Model object at index " << i
+              << "has a different num_target than the first model object (at index 0)";
+          TREELITE_CHECK(concatenated_model->num_class == objs[i]->num_class)
+              << "Model object at index " << i
+              << "has a different num_class than the first model object (at index 0)";
+          TREELITE_CHECK(concatenated_model->leaf_vector_shape == objs[i]->leaf_vector_shape)
+              << "Model object at index " << i
+              << "has a different leaf_vector_shape than the first model object (at index 0)";
+          concatenated_model->target_id.Extend(objs[i]->target_id);
+          concatenated_model->class_id.Extend(objs[i]->class_id);
+        }
+        // Flatten the source trees into one list and preallocate the destination slots, so
+        // the clones — each a deep copy of ~20 arrays — can proceed in parallel and the
+        // copying path runs at memory bandwidth instead of on one core
+        using TreeType = typename std::remove_reference_t<
+            decltype(concatenated_model_concrete.trees)>::value_type;
+        std::vector<TreeType const*> src_trees;
+        for (std::size_t i = 0; i < objs.size(); ++i) {
+          auto& casted = std::get<ModelType>(objs[i]->variant_);
+          for (auto const& tree : casted.trees) {
+            src_trees.push_back(&tree);
+          }
+        }
+        concatenated_model_concrete.trees.resize(src_trees.size());
+        auto thread_config = detail::threading_utils::ThreadConfig(0);  // use all threads
+        detail::threading_utils::ParallelFor(std::size_t(0), src_trees.size(), thread_config,
+            detail::threading_utils::ParallelSchedule::Static(), [&](std::size_t tree_id, int) {
+              concatenated_model_concrete.trees[tree_id] = src_trees[tree_id]->Clone();
+            });
+      },
+      objs[0]->variant_);
+  TREELITE_CHECK_EQ(concatenated_model->target_id.Size(), concatenated_model->GetNumTree());
+  TREELITE_CHECK_EQ(concatenated_model->class_id.Size(), concatenated_model->GetNumTree());
+  return concatenated_model;
+}
+
+std::unique_ptr<Model> ConcatenateModelObjects(std::vector<std::unique_ptr<Model>>&& objs) {
+  if (objs.empty()) {
+    return {};
+  }
+  TypeInfo const threshold_type = objs[0]->GetThresholdType();
+  TypeInfo const leaf_output_type = objs[0]->GetLeafOutputType();
+  std::unique_ptr<Model> concatenated_model = Model::Create(threshold_type, leaf_output_type);
+  // Header
+  concatenated_model->num_feature = objs[0]->num_feature;
+  concatenated_model->task_type = objs[0]->task_type;
+  // Task parameters
+  concatenated_model->num_target = objs[0]->num_target;
+  concatenated_model->num_class = objs[0]->num_class.Clone();
+  concatenated_model->leaf_vector_shape = objs[0]->leaf_vector_shape.Clone();
+  // Model parameters
+  concatenated_model->postprocessor = objs[0]->postprocessor;
+  concatenated_model->sigmoid_alpha = objs[0]->sigmoid_alpha;
+  concatenated_model->ratio_c = objs[0]->ratio_c;
+  concatenated_model->base_scores = objs[0]->base_scores.Clone();
+  concatenated_model->attributes = objs[0]->attributes;
+
   std::visit(
       [&objs, &concatenated_model](auto&& first_model_obj) {
         using ModelType = std::remove_const_t<std::remove_reference_t<decltype(first_model_obj)>>;
@@ -56,16 +127,32 @@ std::unique_ptr<Model> ConcatenateModelObjects(std::vector<Model const*> const&
               << "Model object at index " << i
               << "has a different leaf_vector_shape than the first model object (at index 0)";
           auto& casted = std::get<ModelType>(objs[i]->variant_);
-          std::transform(casted.trees.begin(), casted.trees.end(),
-              std::back_inserter(concatenated_model_concrete.trees),
-              [](const auto& tree) { return tree.Clone(); });
+          std::move(casted.trees.begin(), casted.trees.end(),
+              std::back_inserter(concatenated_model_concrete.trees));
           concatenated_model->target_id.Extend(objs[i]->target_id);
           concatenated_model->class_id.Extend(objs[i]->class_id);
+          // Moved trees may reference memory owned by the source model (a file mapping, a
+          // shared memory region, or an arena); take over those backings so they outlive
+          // the sources
+          if (objs[i]->mapped_file_) {
+            concatenated_model->retained_backings_.push_back(std::move(objs[i]->mapped_file_));
+          }
+          if (objs[i]->shm_region_) {
+            concatenated_model->retained_backings_.push_back(std::move(objs[i]->shm_region_));
+          }
+          if (objs[i]->arena_) {
+            concatenated_model->retained_backings_.push_back(std::move(objs[i]->arena_));
+          }
+          concatenated_model->retained_backings_.insert(
+              concatenated_model->retained_backings_.end(),
+              std::make_move_iterator(objs[i]->retained_backings_.begin()),
+              std::make_move_iterator(objs[i]->retained_backings_.end()));
         }
       },
       objs[0]->variant_);
   TREELITE_CHECK_EQ(concatenated_model->target_id.Size(), concatenated_model->GetNumTree());
   TREELITE_CHECK_EQ(concatenated_model->class_id.Size(), concatenated_model->GetNumTree());
+  objs.clear();
   return concatenated_model;
 }
 
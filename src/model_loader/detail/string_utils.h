@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <string>
+#include <string_view>
 
 namespace treelite::model_loader::detail {
 
@@ -24,6 +25,11 @@ inline void StringTrimFromEnd(std::string& s) {
       s.end());
 }
 
+inline void StringViewTrimFromEnd(std::string_view& s) {
+  auto const pos = s.find_last_not_of("\n\r ");
+  s = (pos == std::string_view::npos) ? std::string_view{} : s.substr(0, pos + 1);
+}
+
 }  // namespace treelite::model_loader::detail
 
 #endif  // SRC_MODEL_LOADER_DETAIL_STRING_UTILS_H_
@@ -10,6 +10,7 @@
 #include <treelite/tree.h>
 
 #include <memory>
+#include <optional>
 #include <stack>
 #include <string>
 #include <vector>
@@ -346,6 +347,12 @@ struct ParsedXGBoostModel {
   std::string objective_name{};
   std::int32_t size_leaf_vector{0};
   std::vector<float> weight_drop{};
+  // Model metadata, captured as-is so that the parallel loader can initialize
+  // per-worker builders with per-chunk slices of the tree annotation
+  std::optional<model_builder::Metadata> metadata{};
+  std::optional<model_builder::TreeAnnotation> tree_annotation{};
+  std::optional<model_builder::PostProcessorFunc> postprocessor{};
+  std::vector<double> base_scores{};
 };
 
 struct ParsedRegTreeParams {
@@ -569,6 +576,17 @@ class DelegatedHandler :
   rapidjson::Document const& get_handler_config() override {
     return handler_config_;
   }
+  /*! \brief seed the result with tree statistics obtained out of band. Used by the
+   *         parallel loader, which parses the trees separately and feeds this handler a
+   *         document whose trees array has been emptied; the statistics would otherwise
+   *         be derived from the parsed trees.
+   *  \param num_tree number of trees in the model
+   *  \param size_leaf_vector length of the leaf output of each tree
+   */
+  void set_tree_stats(std::int32_t num_tree, std::int32_t size_leaf_vector) {
+    result.num_tree = num_tree;
+    result.size_leaf_vector = size_leaf_vector;
+  }
   ParsedXGBoostModel get_result();
   bool Null();
   bool Bool(bool b);
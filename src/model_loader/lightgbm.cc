@@ -7,22 +7,28 @@
 
 #include "./detail/lightgbm.h"
 
-#include <treelite/detail/file_utils.h>
+#include <treelite/detail/mmap_file.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/typeinfo.h>
 #include <treelite/logging.h>
+#include <treelite/trace.h>
 #include <treelite/model_builder.h>
 #include <treelite/model_loader.h>
 #include <treelite/tree.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <queue>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -31,20 +37,26 @@
 
 namespace {
 
-inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi);
+inline std::unique_ptr<treelite::Model> ParseText(std::string_view text);
 
 }  // anonymous namespace
 
 namespace treelite::model_loader {
 
 std::unique_ptr<treelite::Model> LoadLightGBMModel(std::string const& filename) {
-  std::ifstream fi = treelite::detail::OpenFileForReadAsStream(filename);
-  return ParseStream(fi);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::lightgbm");
+  // Map the model file into memory, so that the parser can tokenize it in place without
+  // copying it through a stream abstraction
+  treelite::detail::MappedFile mapped_file{filename};
+  return ParseText(
+      std::string_view{static_cast<char const*>(mapped_file.Data()), mapped_file.Size()});
 }
 
 std::unique_ptr<treelite::Model> LoadLightGBMModelFromString(char const* model_str) {
-  std::istringstream is(model_str);
-  return ParseStream(is);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::lightgbm");
+  return ParseText(std::string_view{model_str});
 }
 
 }  // namespace treelite::model_loader
@@ -53,128 +65,84 @@ std::unique_ptr<treelite::Model> LoadLightGBMModelFromString(char const* model_s
 namespace {
 
 template <typename T>
-inline T TextToNumber(std::string const& str) {
+inline T TextToNumber(std::string_view str) {
   static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value
                     || std::is_same<T, int>::value || std::is_same<T, std::int8_t>::value
                     || std::is_same<T, std::uint32_t>::value
                     || std::is_same<T, std::uint64_t>::value,
       "unsupported data type for TextToNumber; use float, double, "
       "int, int8_t, uint32_t, or uint64_t");
-}
-
-template <>
-inline float TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  float val = std::strtof(str.c_str(), &endptr);
-  if (errno == ERANGE) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to double";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid floating-point number";
+  // std::from_chars converts in place, without locale lookups or intermediate copies
+  T val;
+  char const* const last = str.data() + str.size();
+  char const* ptr;
+  std::errc ec{};
+#if !defined(__cpp_lib_to_chars)
+  if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) {
+    // libc++ (notably on macOS) lacks the floating-point from_chars overloads; fall back
+    // to strtof/strtod through a stack copy, since they require NUL termination
+    char buf[128];
+    TREELITE_CHECK_LT(str.size(), sizeof(buf))
+        << "Numeric token is too long to convert: " << str;
+    std::memcpy(buf, str.data(), str.size());
+    buf[str.size()] = '\0';
+    errno = 0;
+    char* str_end;
+    if constexpr (std::is_same<T, float>::value) {
+      val = std::strtof(buf, &str_end);
+    } else {
+      val = std::strtod(buf, &str_end);
+    }
+    if (errno == ERANGE) {
+      ec = std::errc::result_out_of_range;
+    } else if (str_end == buf) {
+      ec = std::errc::invalid_argument;
+    }
+    ptr = str.data() + (str_end - buf);
+  } else
+#endif  // !defined(__cpp_lib_to_chars)
+  {
+    auto const result = std::from_chars(str.data(), last, val);
+    ptr = result.ptr;
+    ec = result.ec;
   }
-  return val;
-}
-
-template <>
-inline double TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  double val = std::strtod(str.c_str(), &endptr);
-  if (errno == ERANGE) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to double";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid floating-point number";
+  if (ec == std::errc::result_out_of_range) {
+    TREELITE_LOG(FATAL) << "Range error while converting string to number: " << str;
+  } else if (ec != std::errc{} || ptr != last) {
+    TREELITE_LOG(FATAL) << "String does not represent a valid number: " << str;
   }
   return val;
 }
 
-template <>
-inline int TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  auto val = std::strtol(str.c_str(), &endptr, 10);
-  if (errno == ERANGE || val < std::numeric_limits<int>::min()
-      || val > std::numeric_limits<int>::max()) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to int";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid integer";
-  }
-  return static_cast<int>(val);
-}
-
-template <>
-inline std::int8_t TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  auto val = std::strtol(str.c_str(), &endptr, 10);
-  if (errno == ERANGE || val < std::numeric_limits<std::int8_t>::min()
-      || val > std::numeric_limits<std::int8_t>::max()) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to int8_t";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid integer";
-  }
-  return static_cast<std::int8_t>(val);
-}
-
-template <>
-inline std::uint32_t TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  auto val = std::strtoul(str.c_str(), &endptr, 10);
-  if (errno == ERANGE || val > std::numeric_limits<std::uint32_t>::max()) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to uint32_t";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid integer";
-  }
-  return static_cast<std::uint32_t>(val);
-}
-
-template <>
-inline std::uint64_t TextToNumber(std::string const& str) {
-  errno = 0;
-  char* endptr;
-  auto val = std::strtoull(str.c_str(), &endptr, 10);
-  if (errno == ERANGE || val > std::numeric_limits<std::uint64_t>::max()) {
-    TREELITE_LOG(FATAL) << "Range error while converting string to uint64_t";
-  } else if (errno != 0) {
-    TREELITE_LOG(FATAL) << "Unknown error";
-  } else if (*endptr != '\0') {
-    TREELITE_LOG(FATAL) << "String does not represent a valid integer";
-  }
-  return static_cast<std::uint64_t>(val);
-}
-
-inline std::vector<std::string> Split(std::string const& text, char delim) {
-  std::vector<std::string> array;
-  std::istringstream ss(text);
-  std::string token;
-  while (std::getline(ss, token, delim)) {
-    array.push_back(token);
+inline std::vector<std::string_view> Split(std::string_view text, char delim) {
+  std::vector<std::string_view> array;
+  std::size_t begin = 0;
+  while (begin < text.size()) {
+    std::size_t end = text.find(delim, begin);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    array.push_back(text.substr(begin, end - begin));
+    begin = end + 1;
   }
   return array;
 }
 
 template <typename T>
-inline std::vector<T> TextToArray(std::string const& text, std::uint64_t num_entry) {
+inline std::vector<T> TextToArray(std::string_view text, std::uint64_t num_entry) {
   if (text.empty() && num_entry > 0) {
     TREELITE_LOG(FATAL) << "Cannot convert empty text into array";
   }
   std::vector<T> array;
-  std::istringstream ss(text);
-  std::string token;
+  array.reserve(num_entry);
+  std::size_t begin = 0;
   for (std::uint64_t i = 0; i < num_entry; ++i) {
-    std::getline(ss, token, ' ');
-    array.push_back(TextToNumber<T>(token));
+    std::size_t end = text.find(' ', begin);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    array.push_back(TextToNumber<T>(text.substr(begin, end - begin)));
+    begin = std::min(end + 1, text.size());
   }
   return array;
 }
@@ -220,40 +188,46 @@ inline std::vector<std::uint32_t> BitsetToList(std::uint32_t const* bits, std::s
   return result;
 }
 
-inline std::vector<std::string> LoadText(std::istream& fi) {
-  std::vector<std::string> lines;
-  std::string line;
-  while (std::getline(fi, line)) {
-    treelite::model_loader::detail::StringTrimFromEnd(line);
+inline std::vector<std::string_view> LoadText(std::string_view text) {
+  std::vector<std::string_view> lines;
+  std::size_t begin = 0;
+  while (begin < text.size()) {
+    std::size_t end = text.find('\n', begin);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    std::string_view line = text.substr(begin, end - begin);
+    treelite::model_loader::detail::StringViewTrimFromEnd(line);
     lines.push_back(line);
+    begin = end + 1;
   }
 
   return lines;
 }
 
-inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
+inline std::unique_ptr<treelite::Model> ParseText(std::string_view text) {
   std::vector<LGBTree> lgb_trees_;
   int max_feature_idx_;
   int num_class_;
   bool average_output_;
   std::string obj_name_;
-  std::vector<std::string> obj_param_;
+  std::vector<std::string_view> obj_param_;
 
-  /* 1. Parse input stream */
-  std::vector<std::string> lines = LoadText(fi);
-  std::unordered_map<std::string, std::string> global_dict;
-  std::vector<std::unordered_map<std::string, std::string>> tree_dict;
+  /* 1. Parse input text. Tokens are string_views into the input, so no per-token copies
+     are made; the input must stay alive for the duration of this function. */
+  std::vector<std::string_view> lines = LoadText(text);
+  std::unordered_map<std::string_view, std::string_view> global_dict;
+  std::vector<std::unordered_map<std::string_view, std::string_view>> tree_dict;
 
   bool in_tree = false;  // is current entry part of a tree?
   for (auto const& line : lines) {
-    std::istringstream ss(line);
-    std::string key, value, rest;
-    std::getline(ss, key, '=');
-    std::getline(ss, value, '=');
-    std::getline(ss, rest);
-    if (!rest.empty()) {
-      value += "=";
-      value += rest;
+    std::string_view key, value;
+    std::size_t const eq_pos = line.find('=');
+    if (eq_pos == std::string_view::npos) {
+      key = line;
+    } else {
+      key = line.substr(0, eq_pos);
+      value = line.substr(eq_pos + 1);
     }
     if (key == "Tree") {
       in_tree = true;
@@ -273,8 +247,8 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
       obj_name_ = "custom";
     } else {
       auto obj_strs = Split(it->second, ' ');
-      obj_name_ = obj_strs[0];
-      obj_param_ = std::vector<std::string>(obj_strs.begin() + 1, obj_strs.end());
+      obj_name_ = std::string{obj_strs[0]};
+      obj_param_ = std::vector<std::string_view>(obj_strs.begin() + 1, obj_strs.end());
     }
     obj_name_ = treelite::model_loader::detail::lightgbm::CanonicalObjective(obj_name_);
 
@@ -290,128 +264,133 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
     average_output_ = (it != global_dict.end());
   }
 
-  for (auto const& dict : tree_dict) {
-    lgb_trees_.emplace_back();
-    LGBTree& tree = lgb_trees_.back();
-
-    auto it = dict.find("num_leaves");
-    TREELITE_CHECK(it != dict.end()) << "Ill-formed LightGBM model file: need num_leaves";
-    tree.num_leaves = TextToNumber<int>(it->second);
-
-    it = dict.find("num_cat");
-    TREELITE_CHECK(it != dict.end()) << "Ill-formed LightGBM model file: need num_cat";
-    tree.num_cat = TextToNumber<int>(it->second);
-
-    it = dict.find("leaf_value");
-    TREELITE_CHECK(it != dict.end() && !it->second.empty())
-        << "Ill-formed LightGBM model file: need leaf_value";
-    tree.leaf_value = TextToArray<double>(it->second, tree.num_leaves);
-
-    it = dict.find("decision_type");
-    if (tree.num_leaves <= 1) {
-      tree.decision_type = std::vector<std::int8_t>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      if (it == dict.end()) {
-        tree.decision_type = std::vector<std::int8_t>(tree.num_leaves - 1, 0);
-      } else {
-        TREELITE_CHECK(!it->second.empty())
-            << "Ill-formed LightGBM model file: decision_type cannot be empty string";
-        tree.decision_type = TextToArray<std::int8_t>(it->second, tree.num_leaves - 1);
-      }
-    }
+  // Parse the Tree= sections concurrently; each section is independent of the others
+  namespace threading_utils = treelite::detail::threading_utils;
+  threading_utils::ThreadConfig thread_config(0);
+  lgb_trees_.resize(tree_dict.size());
+  threading_utils::ParallelFor(std::size_t(0), tree_dict.size(), thread_config,
+      threading_utils::ParallelSchedule::Static(), [&](std::size_t tree_id, int) {
+        auto const& dict = tree_dict[tree_id];
+        LGBTree& tree = lgb_trees_[tree_id];
+
+        auto it = dict.find("num_leaves");
+        TREELITE_CHECK(it != dict.end()) << "Ill-formed LightGBM model file: need num_leaves";
+        tree.num_leaves = TextToNumber<int>(it->second);
+
+        it = dict.find("num_cat");
+        TREELITE_CHECK(it != dict.end()) << "Ill-formed LightGBM model file: need num_cat";
+        tree.num_cat = TextToNumber<int>(it->second);
+
+        it = dict.find("leaf_value");
+        TREELITE_CHECK(it != dict.end() && !it->second.empty())
+            << "Ill-formed LightGBM model file: need leaf_value";
+        tree.leaf_value = TextToArray<double>(it->second, tree.num_leaves);
+
+        it = dict.find("decision_type");
+        if (tree.num_leaves <= 1) {
+          tree.decision_type = std::vector<std::int8_t>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          if (it == dict.end()) {
+            tree.decision_type = std::vector<std::int8_t>(tree.num_leaves - 1, 0);
+          } else {
+            TREELITE_CHECK(!it->second.empty())
+                << "Ill-formed LightGBM model file: decision_type cannot be empty string";
+            tree.decision_type = TextToArray<std::int8_t>(it->second, tree.num_leaves - 1);
+          }
+        }
 
-    if (tree.num_cat > 0) {
-      it = dict.find("cat_boundaries");
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need cat_boundaries";
-      tree.cat_boundaries = TextToArray<std::uint64_t>(it->second, tree.num_cat + 1);
-      it = dict.find("cat_threshold");
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need cat_threshold";
-      tree.cat_threshold = TextToArray<std::uint32_t>(it->second, tree.cat_boundaries.back());
-    }
+        if (tree.num_cat > 0) {
+          it = dict.find("cat_boundaries");
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need cat_boundaries";
+          tree.cat_boundaries = TextToArray<std::uint64_t>(it->second, tree.num_cat + 1);
+          it = dict.find("cat_threshold");
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need cat_threshold";
+          tree.cat_threshold = TextToArray<std::uint32_t>(it->second, tree.cat_boundaries.back());
+        }
 
-    it = dict.find("split_feature");
-    if (tree.num_leaves <= 1) {
-      tree.split_feature = std::vector<int>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need split_feature";
-      tree.split_feature = TextToArray<int>(it->second, tree.num_leaves - 1);
-    }
+        it = dict.find("split_feature");
+        if (tree.num_leaves <= 1) {
+          tree.split_feature = std::vector<int>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need split_feature";
+          tree.split_feature = TextToArray<int>(it->second, tree.num_leaves - 1);
+        }
 
-    it = dict.find("threshold");
-    if (tree.num_leaves <= 1) {
-      tree.threshold = std::vector<double>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need threshold";
-      tree.threshold = TextToArray<double>(it->second, tree.num_leaves - 1);
-    }
+        it = dict.find("threshold");
+        if (tree.num_leaves <= 1) {
+          tree.threshold = std::vector<double>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need threshold";
+          tree.threshold = TextToArray<double>(it->second, tree.num_leaves - 1);
+        }
 
-    it = dict.find("split_gain");
-    if (tree.num_leaves <= 1) {
-      tree.split_gain = std::vector<float>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      if (it != dict.end()) {
-        TREELITE_CHECK(!it->second.empty())
-            << "Ill-formed LightGBM model file: split_gain cannot be empty string";
-        tree.split_gain = TextToArray<float>(it->second, tree.num_leaves - 1);
-      } else {
-        tree.split_gain = std::vector<float>();
-      }
-    }
+        it = dict.find("split_gain");
+        if (tree.num_leaves <= 1) {
+          tree.split_gain = std::vector<float>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          if (it != dict.end()) {
+            TREELITE_CHECK(!it->second.empty())
+                << "Ill-formed LightGBM model file: split_gain cannot be empty string";
+            tree.split_gain = TextToArray<float>(it->second, tree.num_leaves - 1);
+          } else {
+            tree.split_gain = std::vector<float>();
+          }
+        }
 
-    it = dict.find("internal_count");
-    if (tree.num_leaves <= 1) {
-      tree.internal_count = std::vector<int>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      if (it != dict.end()) {
-        TREELITE_CHECK(!it->second.empty())
-            << "Ill-formed LightGBM model file: internal_count cannot be empty string";
-        tree.internal_count = TextToArray<int>(it->second, tree.num_leaves - 1);
-      } else {
-        tree.internal_count = std::vector<int>();
-      }
-    }
+        it = dict.find("internal_count");
+        if (tree.num_leaves <= 1) {
+          tree.internal_count = std::vector<int>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          if (it != dict.end()) {
+            TREELITE_CHECK(!it->second.empty())
+                << "Ill-formed LightGBM model file: internal_count cannot be empty string";
+            tree.internal_count = TextToArray<int>(it->second, tree.num_leaves - 1);
+          } else {
+            tree.internal_count = std::vector<int>();
+          }
+        }
 
-    it = dict.find("leaf_count");
-    if (tree.num_leaves == 0) {
-      tree.leaf_count = std::vector<int>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 0);
-      if (it != dict.end() && !it->second.empty()) {
-        tree.leaf_count = TextToArray<int>(it->second, tree.num_leaves);
-      } else {
-        tree.leaf_count = std::vector<int>();
-      }
-    }
+        it = dict.find("leaf_count");
+        if (tree.num_leaves == 0) {
+          tree.leaf_count = std::vector<int>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 0);
+          if (it != dict.end() && !it->second.empty()) {
+            tree.leaf_count = TextToArray<int>(it->second, tree.num_leaves);
+          } else {
+            tree.leaf_count = std::vector<int>();
+          }
+        }
 
-    it = dict.find("left_child");
-    if (tree.num_leaves <= 1) {
-      tree.left_child = std::vector<int>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need left_child";
-      tree.left_child = TextToArray<int>(it->second, tree.num_leaves - 1);
-    }
+        it = dict.find("left_child");
+        if (tree.num_leaves <= 1) {
+          tree.left_child = std::vector<int>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need left_child";
+          tree.left_child = TextToArray<int>(it->second, tree.num_leaves - 1);
+        }
 
-    it = dict.find("right_child");
-    if (tree.num_leaves <= 1) {
-      tree.right_child = std::vector<int>();
-    } else {
-      TREELITE_CHECK_GT(tree.num_leaves, 1);
-      TREELITE_CHECK(it != dict.end() && !it->second.empty())
-          << "Ill-formed LightGBM model file: need right_child";
-      tree.right_child = TextToArray<int>(it->second, tree.num_leaves - 1);
-    }
-  }
+        it = dict.find("right_child");
+        if (tree.num_leaves <= 1) {
+          tree.right_child = std::vector<int>();
+        } else {
+          TREELITE_CHECK_GT(tree.num_leaves, 1);
+          TREELITE_CHECK(it != dict.end() && !it->second.empty())
+              << "Ill-formed LightGBM model file: need right_child";
+          tree.right_child = TextToArray<int>(it->second, tree.num_leaves - 1);
+        }
+  });
 
   /* 2. Set model metadata */
   treelite::TaskType task_type;
@@ -516,89 +495,110 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
 
   treelite::model_builder::Metadata metadata{static_cast<std::int32_t>(max_feature_idx_ + 1),
       task_type, average_output_, 1, {static_cast<std::int32_t>(num_class_)}, {1, 1}};
-  treelite::model_builder::TreeAnnotation tree_annotation{
-      num_tree, std::vector<std::int32_t>(num_tree, 0), class_id};
-  auto builder = treelite::model_builder::GetModelBuilder(treelite::TypeInfo::kFloat64,
-      treelite::TypeInfo::kFloat64, metadata, tree_annotation, postprocessor.value(),
-      std::vector<double>(num_class_, 0.0));
-
-  // Traverse trees
-  for (auto const& lgb_tree : lgb_trees_) {
-    builder->StartTree();
-
-    // Assign node ID's so that a breadth-wise traversal would yield
-    // the monotonic sequence 0, 1, 2, ...
-    // We re-arrange nodes here, since LightGBM uses negative indices to distinguish leaf nodes
-    // from internal nodes.
-    std::queue<std::pair<int, int>> Q;  // (old ID, new ID) pair
-    if (lgb_tree.num_leaves == 0) {
-      continue;
-    } else if (lgb_tree.num_leaves == 1) {
-      // A constant-value tree with a single root node that's also a leaf
-      Q.emplace(-1, 0);
-    } else {
-      Q.emplace(0, 0);
-    }
-    while (!Q.empty()) {
-      auto [old_node_id, new_node_id] = Q.front();
-      Q.pop();
-      builder->StartNode(new_node_id);
-      if (old_node_id < 0) {  // leaf
-        builder->LeafScalar(lgb_tree.leaf_value[~old_node_id]);
-        if (!lgb_tree.leaf_count.empty()) {
-          int const data_count = lgb_tree.leaf_count[~old_node_id];
-          TREELITE_CHECK_GE(data_count, 0);
-          builder->DataCount(data_count);
-        }
-      } else {  // non-leaf
-        auto const split_index = static_cast<std::int32_t>(lgb_tree.split_feature[old_node_id]);
-        auto const missing_type = GetMissingType(lgb_tree.decision_type[old_node_id]);
-        int const left_child_old_id = lgb_tree.left_child[old_node_id];
-        int const left_child_new_id = new_node_id * 2 + 1;
-        int const right_child_old_id = lgb_tree.right_child[old_node_id];
-        int const right_child_new_id = new_node_id * 2 + 2;
-
-        if (GetDecisionType(lgb_tree.decision_type[old_node_id], kCategoricalMask)) {
-          // Categorical split
-          int const cat_idx = static_cast<int>(lgb_tree.threshold[old_node_id]);
-          std::vector<std::uint32_t> const left_categories
-              = BitsetToList(lgb_tree.cat_threshold.data() + lgb_tree.cat_boundaries[cat_idx],
-                  lgb_tree.cat_boundaries[cat_idx + 1] - lgb_tree.cat_boundaries[cat_idx]);
-          // For categorical splits, we ignore the missing type field. NaNs always get mapped to
-          // the right child node.
-          bool default_left = false;
-          builder->CategoricalTest(split_index, default_left, left_categories, false,
-              left_child_new_id, right_child_new_id);
-        } else {
-          // Numerical split
-          auto const threshold = static_cast<double>(lgb_tree.threshold[old_node_id]);
-          bool default_left
-              = GetDecisionType(lgb_tree.decision_type[old_node_id], kDefaultLeftMask);
-          bool const missing_value_to_zero = (missing_type != MissingType::kNaN);
-          if (missing_value_to_zero) {
-            // If missing_value_to_zero flag is true, all missing values get mapped to 0.0, so
-            // we need to override the default_left flag
-            default_left = 0.0 <= threshold;
+  std::vector<double> const base_scores(num_class_, 0.0);
+
+  /* 3. Build trees concurrently. Each worker builds a contiguous chunk of trees with its
+     own model builder; the per-chunk models are then merged in order, moving the trees. */
+  std::size_t const num_chunk = std::min(static_cast<std::size_t>(thread_config.nthread),
+      std::max<std::size_t>(lgb_trees_.size(), 1));
+  std::vector<std::unique_ptr<treelite::Model>> chunk_models(num_chunk);
+  threading_utils::ParallelFor(std::size_t(0), num_chunk, thread_config,
+      threading_utils::ParallelSchedule::Static(1), [&](std::size_t chunk_id, int) {
+        std::size_t const chunk_begin = chunk_id * lgb_trees_.size() / num_chunk;
+        std::size_t const chunk_end = (chunk_id + 1) * lgb_trees_.size() / num_chunk;
+        auto const chunk_size = static_cast<std::int32_t>(chunk_end - chunk_begin);
+        treelite::model_builder::TreeAnnotation chunk_annotation{chunk_size,
+            std::vector<std::int32_t>(chunk_size, 0),
+            std::vector<std::int32_t>(class_id.begin() + chunk_begin, class_id.begin() + chunk_end)};
+        auto builder = treelite::model_builder::GetModelBuilder(treelite::TypeInfo::kFloat64,
+            treelite::TypeInfo::kFloat64, metadata, chunk_annotation, postprocessor.value(),
+            base_scores);
+
+        // Traverse trees
+        for (std::size_t tree_id = chunk_begin; tree_id < chunk_end; ++tree_id) {
+          auto const& lgb_tree = lgb_trees_[tree_id];
+          // A binary tree with num_leaves leaf nodes has 2 * num_leaves - 1 nodes in total
+          builder->StartTree(
+              lgb_tree.num_leaves > 1 ? static_cast<std::size_t>(2 * lgb_tree.num_leaves - 1) : 1);
+
+          // Assign node ID's so that a breadth-wise traversal would yield
+          // the monotonic sequence 0, 1, 2, ...
+          // We re-arrange nodes here, since LightGBM uses negative indices to distinguish leaf nodes
+          // from internal nodes.
+          std::queue<std::pair<int, int>> Q;  // (old ID, new ID) pair
+          if (lgb_tree.num_leaves == 0) {
+            continue;
+          } else if (lgb_tree.num_leaves == 1) {
+            // A constant-value tree with a single root node that's also a leaf
+            Q.emplace(-1, 0);
+          } else {
+            Q.emplace(0, 0);
           }
-          builder->NumericalTest(split_index, threshold, default_left, treelite::Operator::kLE,
-              left_child_new_id, right_child_new_id);
-        }
-        if (!lgb_tree.internal_count.empty()) {
-          int const data_count = lgb_tree.internal_count[old_node_id];
-          TREELITE_CHECK_GE(data_count, 0);
-          builder->DataCount(data_count);
-        }
-        if (!lgb_tree.split_gain.empty()) {
-          builder->Gain(lgb_tree.split_gain[old_node_id]);
+          while (!Q.empty()) {
+            auto [old_node_id, new_node_id] = Q.front();
+            Q.pop();
+            builder->StartNode(new_node_id);
+            if (old_node_id < 0) {  // leaf
+              builder->LeafScalar(lgb_tree.leaf_value[~old_node_id]);
+              if (!lgb_tree.leaf_count.empty()) {
+                int const data_count = lgb_tree.leaf_count[~old_node_id];
+                TREELITE_CHECK_GE(data_count, 0);
+                builder->DataCount(data_count);
+              }
+            } else {  // non-leaf
+              auto const split_index = static_cast<std::int32_t>(lgb_tree.split_feature[old_node_id]);
+              auto const missing_type = GetMissingType(lgb_tree.decision_type[old_node_id]);
+              int const left_child_old_id = lgb_tree.left_child[old_node_id];
+              int const left_child_new_id = new_node_id * 2 + 1;
+              int const right_child_old_id = lgb_tree.right_child[old_node_id];
+              int const right_child_new_id = new_node_id * 2 + 2;
+
+              if (GetDecisionType(lgb_tree.decision_type[old_node_id], kCategoricalMask)) {
+                // Categorical split
+                int const cat_idx = static_cast<int>(lgb_tree.threshold[old_node_id]);
+                std::vector<std::uint32_t> const left_categories
+                    = BitsetToList(lgb_tree.cat_threshold.data() + lgb_tree.cat_boundaries[cat_idx],
+                        lgb_tree.cat_boundaries[cat_idx + 1] - lgb_tree.cat_boundaries[cat_idx]);
+                // For categorical splits, we ignore the missing type field. NaNs always get mapped to
+                // the right child node.
+                bool default_left = false;
+                builder->CategoricalTest(split_index, default_left, left_categories, false,
+                    left_child_new_id, right_child_new_id);
+              } else {
+                // Numerical split
+                auto const threshold = static_cast<double>(lgb_tree.threshold[old_node_id]);
+                bool default_left
+                    = GetDecisionType(lgb_tree.decision_type[old_node_id], kDefaultLeftMask);
+                bool const missing_value_to_zero = (missing_type != MissingType::kNaN);
+                if (missing_value_to_zero) {
+                  // If missing_value_to_zero flag is true, all missing values get mapped to 0.0, so
+                  // we need to override the default_left flag
+                  default_left = 0.0 <= threshold;
+                }
+                builder->NumericalTest(split_index, threshold, default_left, treelite::Operator::kLE,
+                    left_child_new_id, right_child_new_id);
+              }
+              if (!lgb_tree.internal_count.empty()) {
+                int const data_count = lgb_tree.internal_count[old_node_id];
+                TREELITE_CHECK_GE(data_count, 0);
+                builder->DataCount(data_count);
+              }
+              if (!lgb_tree.split_gain.empty()) {
+                builder->Gain(lgb_tree.split_gain[old_node_id]);
+              }
+              Q.emplace(left_child_old_id, left_child_new_id);
+              Q.emplace(right_child_old_id, right_child_new_id);
+            }
+            builder->EndNode();
+          }
+          builder->EndTree();
         }
-        Q.emplace(left_child_old_id, left_child_new_id);
-        Q.emplace(right_child_old_id, right_child_new_id);
-      }
-      builder->EndNode();
-    }
-    builder->EndTree();
+        chunk_models[chunk_id] = builder->CommitModel();
+  });
+  if (num_chunk == 1) {
+    return std::move(chunk_models[0]);
   }
-  return builder->CommitModel();
+  return treelite::ConcatenateModelObjects(std::move(chunk_models));
 }
 
 }  // anonymous namespace
@@ -10,6 +10,7 @@
 #include <treelite/logging.h>
 #include <treelite/model_builder.h>
 #include <treelite/model_loader.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/tree.h>
 
 #include <algorithm>
@@ -18,6 +19,7 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <vector>
 
 namespace treelite::model_loader::sklearn {
 
@@ -25,9 +27,10 @@ namespace detail {
 
 class RandomForestRegressorMixIn {
  public:
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
     n_targets_ = n_targets;
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kRegressor, true,
         static_cast<std::int32_t>(n_targets), std::vector<std::int32_t>(n_targets, 1),
         {n_targets, 1}};
@@ -60,9 +63,10 @@ class RandomForestRegressorMixIn {
 // n_classes=2.
 class RandomForestClassifierMixIn {
  public:
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      int n_targets, std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, int n_targets, std::int32_t const* n_classes) {
     n_targets_ = n_targets;
+    int const n_trees = tree_end - tree_begin;
     std::vector<std::int32_t> n_classes_(n_classes, n_classes + n_targets);
     if (!std::all_of(n_classes_.begin(), n_classes_.end(), [](auto e) { return e >= 2; })) {
       TREELITE_LOG(FATAL)
@@ -102,8 +106,10 @@ class IsolationForestMixIn {
  public:
   explicit IsolationForestMixIn(double ratio_c) : ratio_c_{ratio_c} {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets,
+      [[maybe_unused]] std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kIsolationForest, true, 1, {1}, {1, 1}};
     model_builder::TreeAnnotation tree_annotation{
         n_trees, std::vector<std::int32_t>(n_trees, 0), std::vector<std::int32_t>(n_trees, 0)};
@@ -128,8 +134,10 @@ class GradientBoostingRegressorMixIn {
  public:
   explicit GradientBoostingRegressorMixIn(double base_score) : base_score_{base_score} {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets,
+      [[maybe_unused]] std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kRegressor, false, 1, {1}, {1, 1}};
     model_builder::TreeAnnotation tree_annotation{
         n_trees, std::vector<std::int32_t>(n_trees, 0), std::vector<std::int32_t>(n_trees, 0)};
@@ -151,8 +159,9 @@ class GradientBoostingBinaryClassifierMixIn {
  public:
   explicit GradientBoostingBinaryClassifierMixIn(double base_score) : base_score_(base_score) {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
     std::vector<std::int32_t> target_id(n_trees, 0);
     std::vector<std::int32_t> class_id(n_trees, 0);
@@ -176,14 +185,15 @@ class GradientBoostingMulticlassClassifierMixIn {
   explicit GradientBoostingMulticlassClassifierMixIn(std::vector<double> const& base_scores)
       : base_scores_(base_scores) {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{
         n_features, TaskType::kMultiClf, false, 1, {n_classes[0]}, {1, 1}};
     std::vector<std::int32_t> target_id(n_trees, 0);
     std::vector<std::int32_t> class_id(n_trees);
-    for (int tree_id = 0; tree_id < n_trees; ++tree_id) {
-      class_id[tree_id] = tree_id % n_classes[0];
+    for (int tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+      class_id[tree_id - tree_begin] = tree_id % n_classes[0];
     }
     model_builder::TreeAnnotation tree_annotation{n_trees, target_id, class_id};
     model_builder::PostProcessorFunc postprocessor{"softmax"};
@@ -204,8 +214,10 @@ class HistGradientBoostingRegressorMixIn {
  public:
   explicit HistGradientBoostingRegressorMixIn(double base_score) : base_score_{base_score} {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets,
+      [[maybe_unused]] std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kRegressor, false, 1, {1}, {1, 1}};
     model_builder::TreeAnnotation tree_annotation{
         n_trees, std::vector<std::int32_t>(n_trees, 0), std::vector<std::int32_t>(n_trees, 0)};
@@ -227,8 +239,10 @@ class HistGradientBoostingBinaryClassifierMixIn {
  public:
   explicit HistGradientBoostingBinaryClassifierMixIn(double base_score) : base_score_{base_score} {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, [[maybe_unused]] std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets,
+      [[maybe_unused]] std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{n_features, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
     model_builder::TreeAnnotation tree_annotation{
         n_trees, std::vector<std::int32_t>(n_trees, 0), std::vector<std::int32_t>(n_trees, 0)};
@@ -246,14 +260,15 @@ class HistGradientBoostingMulticlassClassifierMixIn {
   explicit HistGradientBoostingMulticlassClassifierMixIn(std::vector<double> const& base_scores)
       : base_scores_{base_scores} {}
 
-  void HandleMetadata(model_builder::ModelBuilder& builder, int n_trees, int n_features,
-      [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+  void HandleMetadata(model_builder::ModelBuilder& builder, int tree_begin, int tree_end,
+      int n_features, [[maybe_unused]] int n_targets, std::int32_t const* n_classes) {
+    int const n_trees = tree_end - tree_begin;
     model_builder::Metadata metadata{
         n_features, TaskType::kMultiClf, false, 1, {n_classes[0]}, {1, 1}};
     std::vector<std::int32_t> target_id(n_trees, 0);
     std::vector<std::int32_t> class_id(n_trees);
-    for (int tree_id = 0; tree_id < n_trees; ++tree_id) {
-      class_id[tree_id] = tree_id % n_classes[0];
+    for (int tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+      class_id[tree_id - tree_begin] = tree_id % n_classes[0];
     }
     model_builder::TreeAnnotation tree_annotation{n_trees, target_id, class_id};
     model_builder::PostProcessorFunc postprocessor{"softmax"};
@@ -275,54 +290,74 @@ std::unique_ptr<Model> LoadSKLearnModel(MixIn& mixin, int n_trees, int n_feature
   TREELITE_CHECK_GT(n_trees, 0) << "n_trees must be at least 1";
   TREELITE_CHECK_GT(n_features, 0) << "n_features must be at least 1";
 
-  std::unique_ptr<model_builder::ModelBuilder> builder
-      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64);
-  mixin.HandleMetadata(*builder, n_trees, n_features, n_targets, n_classes);
-
-  for (int tree_id = 0; tree_id < n_trees; ++tree_id) {
-    std::int64_t const total_sample_cnt = n_node_samples[tree_id][0];
-    TREELITE_CHECK_LE(
-        node_count[tree_id], static_cast<std::int64_t>(std::numeric_limits<int>::max()))
-        << "Too many nodes in the tree";
-    int const n_nodes = static_cast<int>(node_count[tree_id]);
-
-    builder->StartTree();
-    for (int node_id = 0; node_id < n_nodes; ++node_id) {
-      int const left_child_id = static_cast<int>(children_left[tree_id][node_id]);
-      int const right_child_id = static_cast<int>(children_right[tree_id][node_id]);
-      std::int64_t sample_cnt = n_node_samples[tree_id][node_id];
-      double const weighted_sample_cnt = weighted_n_node_samples[tree_id][node_id];
-
-      builder->StartNode(node_id);
-      if (left_child_id == -1) {  // leaf node
-        mixin.HandleLeafNode(*builder, tree_id, node_id, value, n_classes);
-      } else {
-        std::int64_t const split_index = feature[tree_id][node_id];
-        double const split_cond = threshold[tree_id][node_id];
-        std::int64_t const left_child_sample_cnt = n_node_samples[tree_id][left_child_id];
-        std::int64_t const right_child_sample_cnt = n_node_samples[tree_id][right_child_id];
-        double const gain
-            = static_cast<double>(sample_cnt)
-              * (impurity[tree_id][node_id]
-                  - static_cast<double>(left_child_sample_cnt) * impurity[tree_id][left_child_id]
-                        / static_cast<double>(sample_cnt)
-                  - static_cast<double>(right_child_sample_cnt) * impurity[tree_id][right_child_id]
-                        / static_cast<double>(sample_cnt))
-              / static_cast<double>(total_sample_cnt);
-
-        TREELITE_CHECK_LE(split_index, std::numeric_limits<std::int32_t>::max())
-            << "split_index too large";
-        builder->NumericalTest(static_cast<std::int32_t>(split_index), split_cond, true,
-            Operator::kLE, left_child_id, right_child_id);
-        builder->Gain(gain);
-      }
-      builder->DataCount(sample_cnt);
-      builder->SumHess(weighted_sample_cnt);
-      builder->EndNode();
-    }
-    builder->EndTree();
+  namespace threading_utils = treelite::detail::threading_utils;
+
+  /* Convert the estimators in parallel. Each worker thread converts a contiguous range of
+   * trees through its own model builder, with all node storage for the range allocated up
+   * front; the per-chunk models are then combined by moving the trees into a single model. */
+  threading_utils::ThreadConfig thread_config(0);
+  std::size_t const num_chunk = std::min(
+      static_cast<std::size_t>(thread_config.nthread), static_cast<std::size_t>(n_trees));
+  std::vector<std::unique_ptr<Model>> chunk_models(num_chunk);
+  threading_utils::ParallelFor(std::size_t(0), num_chunk, thread_config,
+      threading_utils::ParallelSchedule::Static(1), [&](std::size_t chunk_id, int) {
+        int const tree_begin = static_cast<int>(chunk_id * n_trees / num_chunk);
+        int const tree_end = static_cast<int>((chunk_id + 1) * n_trees / num_chunk);
+        std::unique_ptr<model_builder::ModelBuilder> builder
+            = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64);
+        mixin.HandleMetadata(*builder, tree_begin, tree_end, n_features, n_targets, n_classes);
+        builder->TotalNodeCountHint(static_cast<std::size_t>(std::accumulate(
+            node_count + tree_begin, node_count + tree_end, static_cast<std::int64_t>(0))));
+
+        for (int tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+          std::int64_t const total_sample_cnt = n_node_samples[tree_id][0];
+          TREELITE_CHECK_LE(
+              node_count[tree_id], static_cast<std::int64_t>(std::numeric_limits<int>::max()))
+              << "Too many nodes in the tree";
+          int const n_nodes = static_cast<int>(node_count[tree_id]);
+
+          builder->StartTree(static_cast<std::size_t>(n_nodes));
+          for (int node_id = 0; node_id < n_nodes; ++node_id) {
+            int const left_child_id = static_cast<int>(children_left[tree_id][node_id]);
+            int const right_child_id = static_cast<int>(children_right[tree_id][node_id]);
+            std::int64_t sample_cnt = n_node_samples[tree_id][node_id];
+            double const weighted_sample_cnt = weighted_n_node_samples[tree_id][node_id];
+
+            builder->StartNode(node_id);
+            if (left_child_id == -1) {  // leaf node
+              mixin.HandleLeafNode(*builder, tree_id, node_id, value, n_classes);
+            } else {
+              std::int64_t const split_index = feature[tree_id][node_id];
+              double const split_cond = threshold[tree_id][node_id];
+              std::int64_t const left_child_sample_cnt = n_node_samples[tree_id][left_child_id];
+              std::int64_t const right_child_sample_cnt = n_node_samples[tree_id][right_child_id];
+              double const gain
+                  = static_cast<double>(sample_cnt)
+                    * (impurity[tree_id][node_id]
+                        - static_cast<double>(left_child_sample_cnt)
+                              * impurity[tree_id][left_child_id] / static_cast<double>(sample_cnt)
+                        - static_cast<double>(right_child_sample_cnt)
+                              * impurity[tree_id][right_child_id] / static_cast<double>(sample_cnt))
+                    / static_cast<double>(total_sample_cnt);
+
+              TREELITE_CHECK_LE(split_index, std::numeric_limits<std::int32_t>::max())
+                  << "split_index too large";
+              builder->NumericalTest(static_cast<std::int32_t>(split_index), split_cond, true,
+                  Operator::kLE, left_child_id, right_child_id);
+              builder->Gain(gain);
+            }
+            builder->DataCount(sample_cnt);
+            builder->SumHess(weighted_sample_cnt);
+            builder->EndNode();
+          }
+          builder->EndTree();
+        }
+        chunk_models[chunk_id] = builder->CommitModel();
+      });
+  if (num_chunk == 1) {
+    return std::move(chunk_models[0]);
   }
-  return builder->CommitModel();
+  return ConcatenateModelObjects(std::move(chunk_models));
 }
 
 #pragma pack(1)
@@ -359,7 +394,7 @@ std::unique_ptr<treelite::Model> LoadHistGradientBoostingImpl(MixIn& mixin, int
 
   std::unique_ptr<model_builder::ModelBuilder> builder
       = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64);
-  mixin.HandleMetadata(*builder, n_trees, n_features, 1, &n_classes);
+  mixin.HandleMetadata(*builder, 0, n_trees, n_features, 1, &n_classes);
 
   auto check = [](std::uint32_t const* bitmap, int val, unsigned int row) {
     return (bitmap[8 * row + val / 32] >> (val % 32)) & 1;
@@ -371,7 +406,7 @@ std::unique_ptr<treelite::Model> LoadHistGradientBoostingImpl(MixIn& mixin, int
         << "Too many nodes in the tree";
     int const n_nodes = static_cast<int>(node_count[tree_id]);
 
-    builder->StartTree();
+    builder->StartTree(static_cast<std::size_t>(n_nodes));
     for (int node_id = 0; node_id < n_nodes; ++node_id) {
       auto const node = nodes[tree_id][node_id];
       std::uint32_t const* left_cat_bitmap = raw_left_cat_bitsets[tree_id];
@@ -9,9 +9,10 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
-#include <rapidjson/filereadstream.h>
 #include <treelite/detail/file_utils.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/logging.h>
+#include <treelite/trace.h>
 #include <treelite/model_loader.h>
 #include <treelite/tree.h>
 
@@ -20,13 +21,16 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "detail/string_utils.h"
 #include "detail/xgboost.h"
@@ -36,6 +40,9 @@ namespace {
 template <typename StreamType, typename ErrorHandlerFunc>
 std::unique_ptr<treelite::Model> ParseStream(std::unique_ptr<StreamType> input_stream,
     ErrorHandlerFunc error_handler, rapidjson::Document const& config);
+template <typename ErrorHandlerFunc>
+std::unique_ptr<treelite::Model> ParseStringParallel(char const* json_str, std::size_t length,
+    ErrorHandlerFunc error_handler, rapidjson::Document const& config);
 template <class Iter, class T>
 Iter BinarySearch(Iter begin, Iter end, T const& val);
 
@@ -45,46 +52,22 @@ namespace treelite::model_loader {
 
 std::unique_ptr<treelite::Model> LoadXGBoostModel(
     std::string const& filename, char const* config_json) {
-  char read_buffer[65536];
-
-  FILE* fp = treelite::detail::OpenFileForReadAsFilePtr(filename);
-
-  auto input_stream
-      = std::make_unique<rapidjson::FileReadStream>(fp, read_buffer, sizeof(read_buffer));
-  auto error_handler = [fp](std::size_t offset) -> std::string {
-    std::size_t cur = (offset >= 50 ? (offset - 50) : 0);
-    std::fseek(fp, cur, SEEK_SET);
-    int c;
-    std::ostringstream oss, oss2;
-    for (int i = 0; i < 100; ++i) {
-      c = std::fgetc(fp);
-      if (c == EOF) {
-        break;
-      }
-      oss << static_cast<char>(c);
-      if (cur == offset) {
-        oss2 << "^";
-      } else {
-        oss2 << "~";
-      }
-      ++cur;
-    }
-    std::fclose(fp);
-    return oss.str() + "\n" + oss2.str();
-  };
-  rapidjson::Document parsed_config;
-  parsed_config.Parse(config_json);
-  TREELITE_CHECK(!parsed_config.HasParseError())
-      << "Error when parsing JSON config: offset " << parsed_config.GetErrorOffset() << ", "
-      << rapidjson::GetParseError_En(parsed_config.GetParseError());
-  auto parsed_model = ParseStream(std::move(input_stream), error_handler, parsed_config);
-  std::fclose(fp);
-  return parsed_model;
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::xgboost_json");
+  // Read the whole model file into memory, so that the parallel parser can slice the
+  // trees array into per-thread chunks
+  auto ifs = treelite::detail::OpenFileForReadAsStream(filename);
+  auto const file_size = std::filesystem::file_size(std::filesystem::u8path(filename));
+  std::string json_str(static_cast<std::size_t>(file_size), '\0');
+  ifs.read(json_str.data(), static_cast<std::streamsize>(json_str.size()));
+  TREELITE_CHECK(ifs) << "Failed to read " << filename;
+  return LoadXGBoostModelFromString(json_str.c_str(), json_str.size(), config_json);
 }
 
 std::unique_ptr<treelite::Model> LoadXGBoostModelFromString(
     char const* json_str, std::size_t length, char const* config_json) {
-  auto input_stream = std::make_unique<rapidjson::MemoryStream>(json_str, length);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::xgboost_json");
   auto error_handler = [json_str](std::size_t offset) -> std::string {
     std::size_t cur = (offset >= 50 ? (offset - 50) : 0);
     std::ostringstream oss, oss2;
@@ -107,6 +90,13 @@ std::unique_ptr<treelite::Model> LoadXGBoostModelFromString(
   TREELITE_CHECK(!parsed_config.HasParseError())
       << "Error when parsing JSON config: offset " << parsed_config.GetErrorOffset() << ", "
       << rapidjson::GetParseError_En(parsed_config.GetParseError());
+  // Fast path: locate the trees array with a raw byte scan and parse the tree objects in
+  // parallel. Falls back to the single-threaded parser when the scan cannot unambiguously
+  // locate the trees array.
+  if (auto parsed_model = ParseStringParallel(json_str, length, error_handler, parsed_config)) {
+    return parsed_model;
+  }
+  auto input_stream = std::make_unique<rapidjson::MemoryStream>(json_str, length);
   return ParseStream(std::move(input_stream), error_handler, parsed_config);
 }
 
@@ -312,7 +302,7 @@ bool RegTreeHandler::EndObject(std::size_t) {
     return false;
   }
 
-  model_builder.StartTree();
+  model_builder.StartTree(static_cast<std::size_t>(num_nodes));
   for (std::int32_t node_id = 0; node_id < num_nodes; ++node_id) {
     model_builder.StartNode(node_id);
     if (left_children[node_id] == -1) {
@@ -620,6 +610,11 @@ bool LearnerHandler::EndObject(std::size_t) {
   treelite::model_builder::TreeAnnotation tree_annotation{num_tree, target_id, class_id};
   output.builder->InitializeMetadata(
       metadata, tree_annotation, postprocessor, base_scores, std::nullopt);
+  // Keep a copy of the metadata, for the parallel loader
+  output.metadata = metadata;
+  output.tree_annotation = tree_annotation;
+  output.postprocessor = postprocessor;
+  output.base_scores = base_scores;
 
   return pop_handler();
 }
@@ -799,4 +794,263 @@ std::unique_ptr<treelite::Model> ParseStream(std::unique_ptr<StreamType> input_s
   return model;
 }
 
+/*! \brief Byte extents of the trees array in an XGBoost JSON document */
+struct TreeArrayExtents {
+  std::size_t array_begin;  // Position of the opening '[' of the trees array
+  std::size_t array_end;  // Position one past the closing ']'
+  std::vector<std::pair<std::size_t, std::size_t>> tree_extents;  // [begin, end) per tree object
+};
+
+/*!
+ * \brief Scan the raw JSON text for the "trees": [...] array and record the byte extent of
+ *        each tree object, without parsing any values. The scanner tracks string and escape
+ *        state, so brackets inside string literals are ignored. Returns std::nullopt unless
+ *        the document contains exactly one "trees" key whose value is an array of objects;
+ *        the caller must then fall back to the single-threaded parser.
+ * \param json JSON text
+ * \param length Length of the JSON text
+ */
+std::optional<TreeArrayExtents> ScanTreeArray(char const* json, std::size_t length) {
+  std::optional<TreeArrayExtents> found;
+  // Advance *pos past the string literal starting at *pos (which must point at '"').
+  // Returns false if the string is unterminated.
+  auto skip_string = [json, length](std::size_t* pos) {
+    for (std::size_t i = *pos + 1; i < length; ++i) {
+      if (json[i] == '\\') {
+        ++i;
+      } else if (json[i] == '"') {
+        *pos = i + 1;
+        return true;
+      }
+    }
+    return false;
+  };
+  auto skip_whitespace = [json, length](std::size_t* pos) {
+    while (*pos < length
+           && (json[*pos] == ' ' || json[*pos] == '\t' || json[*pos] == '\n'
+               || json[*pos] == '\r')) {
+      ++*pos;
+    }
+  };
+  // Advance *pos past the value starting at *pos, tracking nesting depth. Used to skip
+  // whole tree objects without parsing them.
+  auto skip_value = [json, length, &skip_string](std::size_t* pos) {
+    std::size_t depth = 0;
+    std::size_t i = *pos;
+    while (i < length) {
+      char const c = json[i];
+      if (c == '"') {
+        if (!skip_string(&i)) {
+          return false;
+        }
+        continue;
+      } else if (c == '{' || c == '[') {
+        ++depth;
+      } else if (c == '}' || c == ']') {
+        --depth;
+      }
+      ++i;
+      if (depth == 0) {
+        *pos = i;
+        return true;
+      }
+    }
+    return false;
+  };
+
+  std::size_t pos = 0;
+  while (pos < length) {
+    char const c = json[pos];
+    if (c != '"') {
+      ++pos;
+      continue;
+    }
+    std::size_t const str_begin = pos + 1;
+    if (!skip_string(&pos)) {
+      return std::nullopt;
+    }
+    std::size_t const str_end = pos - 1;
+    constexpr char kTreesKey[] = "trees";
+    if (str_end - str_begin != sizeof(kTreesKey) - 1
+        || std::char_traits<char>::compare(json + str_begin, kTreesKey, sizeof(kTreesKey) - 1)
+               != 0) {
+      continue;
+    }
+    // Candidate key; check for ": [" (modulo whitespace)
+    skip_whitespace(&pos);
+    if (pos >= length || json[pos] != ':') {
+      continue;
+    }
+    ++pos;
+    skip_whitespace(&pos);
+    if (pos >= length || json[pos] != '[') {
+      continue;
+    }
+    // Collect the extent of each element; all elements must be objects
+    TreeArrayExtents extents;
+    extents.array_begin = pos;
+    ++pos;
+    skip_whitespace(&pos);
+    bool well_formed = true;
+    while (pos < length && json[pos] != ']') {
+      if (json[pos] != '{') {
+        well_formed = false;
+        break;
+      }
+      std::size_t const tree_begin = pos;
+      if (!skip_value(&pos)) {
+        return std::nullopt;  // Unterminated object
+      }
+      extents.tree_extents.emplace_back(tree_begin, pos);
+      skip_whitespace(&pos);
+      if (pos < length && json[pos] == ',') {
+        ++pos;
+        skip_whitespace(&pos);
+      }
+    }
+    if (!well_formed || pos >= length) {
+      continue;  // Not an array of objects; cannot be the trees array
+    }
+    extents.array_end = pos + 1;  // One past ']'
+    if (found.has_value()) {
+      return std::nullopt;  // Ambiguous: two candidate trees arrays
+    }
+    found = std::move(extents);
+    pos = found->array_end;
+  }
+  return found;
+}
+
+/*!
+ * \brief Two-phase parallel parser for XGBoost JSON. Phase 1 scans the raw text for the
+ *        byte extent of each tree object and parses the tree objects in parallel, with an
+ *        independent handler stack and model builder per thread. Phase 2 parses the
+ *        document with the trees array emptied out, which yields the model metadata at a
+ *        tiny fraction of the full parsing cost. The per-thread models are then merged in
+ *        order, moving the trees. Returns nullptr when the trees array cannot be located
+ *        unambiguously; the caller must then fall back to the single-threaded parser.
+ */
+template <typename ErrorHandlerFunc>
+std::unique_ptr<treelite::Model> ParseStringParallel(char const* json_str, std::size_t length,
+    ErrorHandlerFunc error_handler, rapidjson::Document const& config) {
+  namespace loader_detail = treelite::model_loader::detail;
+  namespace threading_utils = treelite::detail::threading_utils;
+  auto const extents = ScanTreeArray(json_str, length);
+  if (!extents.has_value() || extents->tree_extents.empty()) {
+    return nullptr;
+  }
+  auto const& tree_extents = extents->tree_extents;
+  std::size_t const num_tree = tree_extents.size();
+
+  threading_utils::ThreadConfig thread_config(0);
+  std::size_t const num_chunk = std::min(static_cast<std::size_t>(thread_config.nthread), num_tree);
+  std::vector<std::size_t> chunk_begin(num_chunk + 1);
+  for (std::size_t i = 0; i <= num_chunk; ++i) {
+    chunk_begin[i] = i * num_tree / num_chunk;
+  }
+
+  /* Phase 1: parse the tree objects, one chunk of trees per thread */
+  std::vector<std::unique_ptr<treelite::model_builder::ModelBuilder>> builders(num_chunk);
+  std::vector<std::vector<loader_detail::ParsedRegTreeParams>> reg_tree_params(num_chunk);
+  std::vector<rapidjson::ParseResult> chunk_result(num_chunk);
+  std::vector<std::size_t> chunk_error_offset(num_chunk);
+  threading_utils::ParallelFor(std::size_t(0), num_chunk, thread_config,
+      threading_utils::ParallelSchedule::Static(1), [&](std::size_t chunk_id, int) {
+        auto handler = loader_detail::DelegatedHandler::create_empty(config);
+        builders[chunk_id] = treelite::model_builder::GetModelBuilder(
+            treelite::TypeInfo::kFloat32, treelite::TypeInfo::kFloat32);
+        handler->push_delegate(std::make_shared<loader_detail::RegTreeArrayHandler>(
+            handler, reg_tree_params[chunk_id], *builders[chunk_id]));
+        for (std::size_t tree_id = chunk_begin[chunk_id]; tree_id < chunk_begin[chunk_id + 1];
+             ++tree_id) {
+          auto const [tree_begin, tree_end] = tree_extents[tree_id];
+          rapidjson::MemoryStream input_stream(json_str + tree_begin, tree_end - tree_begin);
+          rapidjson::Reader reader;
+          rapidjson::ParseResult result
+              = reader.Parse<rapidjson::ParseFlag::kParseNanAndInfFlag>(input_stream, *handler);
+          if (!result) {
+            chunk_result[chunk_id] = result;
+            chunk_error_offset[chunk_id] = tree_begin + result.Offset();
+            return;
+          }
+        }
+      });
+  for (std::size_t chunk_id = 0; chunk_id < num_chunk; ++chunk_id) {
+    if (!chunk_result[chunk_id]) {
+      std::size_t const offset = chunk_error_offset[chunk_id];
+      TREELITE_LOG(FATAL) << "Provided JSON could not be parsed as XGBoost model. "
+                          << "Parsing error at offset " << offset << ": "
+                          << rapidjson::GetParseError_En(chunk_result[chunk_id].Code()) << "\n"
+                          << error_handler(offset);
+    }
+    TREELITE_CHECK_EQ(reg_tree_params[chunk_id].size(),
+        chunk_begin[chunk_id + 1] - chunk_begin[chunk_id])
+        << "Unexpected number of trees parsed";
+  }
+  std::int32_t const size_leaf_vector = reg_tree_params[0][0].size_leaf_vector;
+  for (auto const& chunk_params : reg_tree_params) {
+    for (loader_detail::ParsedRegTreeParams const& e : chunk_params) {
+      TREELITE_CHECK_EQ(e.size_leaf_vector, size_leaf_vector)
+          << "We currently don't support loading model whose trees have different output size";
+    }
+  }
+
+  /* Phase 2: parse the document with the trees array emptied out, to obtain the metadata */
+  std::string reduced;
+  reduced.reserve(length - (extents->array_end - extents->array_begin) + 2);
+  reduced.append(json_str, extents->array_begin + 1);  // Up to and including '['
+  reduced.append(json_str + extents->array_end - 1, length - (extents->array_end - 1));
+  auto metadata_handler = loader_detail::DelegatedHandler::create(config);
+  metadata_handler->set_tree_stats(static_cast<std::int32_t>(num_tree), size_leaf_vector);
+  rapidjson::MemoryStream metadata_stream(reduced.c_str(), reduced.size());
+  rapidjson::Reader metadata_reader;
+  rapidjson::ParseResult metadata_result
+      = metadata_reader.Parse<rapidjson::ParseFlag::kParseNanAndInfFlag>(
+          metadata_stream, *metadata_handler);
+  if (!metadata_result) {
+    TREELITE_LOG(FATAL) << "Provided JSON could not be parsed as XGBoost model. "
+                        << "Parsing error outside the trees array: "
+                        << rapidjson::GetParseError_En(metadata_result.Code());
+  }
+  loader_detail::ParsedXGBoostModel parsed = metadata_handler->get_result();
+  TREELITE_CHECK(parsed.metadata.has_value() && parsed.tree_annotation.has_value()
+                 && parsed.postprocessor.has_value())
+      << "Ill-formed XGBoost model: missing learner metadata";
+  auto const& tree_annotation = *parsed.tree_annotation;
+  TREELITE_CHECK_EQ(tree_annotation.target_id.size(), num_tree);
+  TREELITE_CHECK_EQ(tree_annotation.class_id.size(), num_tree);
+
+  /* Merge the per-thread models in order, moving the trees */
+  std::vector<std::unique_ptr<treelite::Model>> chunk_models(num_chunk);
+  for (std::size_t chunk_id = 0; chunk_id < num_chunk; ++chunk_id) {
+    std::size_t const begin = chunk_begin[chunk_id];
+    std::size_t const end = chunk_begin[chunk_id + 1];
+    treelite::model_builder::TreeAnnotation chunk_annotation{static_cast<std::int32_t>(end - begin),
+        std::vector<std::int32_t>(
+            tree_annotation.target_id.begin() + begin, tree_annotation.target_id.begin() + end),
+        std::vector<std::int32_t>(
+            tree_annotation.class_id.begin() + begin, tree_annotation.class_id.begin() + end)};
+    builders[chunk_id]->InitializeMetadata(
+        *parsed.metadata, chunk_annotation, *parsed.postprocessor, parsed.base_scores,
+        std::nullopt);
+    chunk_models[chunk_id] = builders[chunk_id]->CommitModel();
+  }
+  auto model = treelite::ConcatenateModelObjects(std::move(chunk_models));
+
+  // Apply Dart weights
+  if (!parsed.weight_drop.empty()) {
+    auto& trees = std::get<treelite::ModelPreset<float, float>>(model->variant_).trees;
+    TREELITE_CHECK_EQ(trees.size(), parsed.weight_drop.size());
+    for (std::size_t i = 0; i < trees.size(); ++i) {
+      for (int nid = 0; nid < trees[i].num_nodes; ++nid) {
+        if (trees[i].IsLeaf(nid)) {
+          trees[i].SetLeaf(
+              nid, static_cast<float>(parsed.weight_drop[i] * trees[i].LeafValue(nid)));
+        }
+      }
+    }
+  }
+  return model;
+}
+
 }  // anonymous namespace
@@ -5,11 +5,13 @@
  * \author Hyunsu Cho
  */
 
-#include <treelite/detail/file_utils.h>
+#include <treelite/detail/mmap_file.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/enum/operator.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/typeinfo.h>
 #include <treelite/logging.h>
+#include <treelite/trace.h>
 #include <treelite/model_builder.h>
 #include <treelite/model_loader.h>
 #include <treelite/tree.h>
@@ -19,10 +21,8 @@
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
-#include <fstream>
 #include <memory>
 #include <queue>
-#include <sstream>
 #include <variant>
 
 #include "./detail/xgboost.h"
@@ -32,20 +32,23 @@ namespace fs = std::filesystem;
 
 namespace {
 
-inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi);
+inline std::unique_ptr<treelite::Model> ParseBuffer(void const* buf, std::size_t len);
 
 }  // anonymous namespace
 
 namespace treelite::model_loader {
 
 std::unique_ptr<treelite::Model> LoadXGBoostModelLegacyBinary(std::string const& filename) {
-  std::ifstream fi = treelite::detail::OpenFileForReadAsStream(filename);
-  return ParseStream(fi);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::xgboost_legacy");
+  treelite::detail::MappedFile mapped_file{filename};
+  return ParseBuffer(mapped_file.Data(), mapped_file.Size());
 }
 
 std::unique_ptr<treelite::Model> LoadXGBoostModelLegacyBinary(void const* buf, std::size_t len) {
-  std::istringstream fi(std::string(static_cast<char const*>(buf), len));
-  return ParseStream(fi);
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("loader::xgboost_legacy");
+  return ParseBuffer(buf, len);
 }
 
 }  // namespace treelite::model_loader
@@ -56,89 +59,29 @@ namespace {
 using bst_float = float;
 using treelite::model_loader::detail::StringStartsWith;
 
-/* peekable input stream implemented with a ring buffer */
-class PeekableInputStream {
+/* cursor over an in-memory buffer holding the entire model file; reads are bulk copies */
+class BufferReader {
  public:
-  std::size_t const MAX_PEEK_WINDOW = 1024;  // peek up to 1024 bytes
-
-  explicit PeekableInputStream(std::istream& fi)
-      : istm_(fi), buf_(MAX_PEEK_WINDOW + 1), begin_ptr_(0), end_ptr_(0) {}
+  BufferReader(void const* data, std::size_t size)
+      : data_(static_cast<char const*>(data)), size_(size), pos_(0) {}
 
   inline std::size_t Read(void* ptr, std::size_t size) {
-    std::size_t const bytes_buffered = BytesBuffered();
-    char* cptr = static_cast<char*>(ptr);
-    if (size <= bytes_buffered) {
-      // all content already buffered; consume buffer
-      if (begin_ptr_ + size < MAX_PEEK_WINDOW + 1) {
-        std::memcpy(cptr, &buf_[begin_ptr_], size);
-        begin_ptr_ += size;
-      } else {
-        std::memcpy(cptr, &buf_[begin_ptr_], MAX_PEEK_WINDOW + 1 - begin_ptr_);
-        std::memcpy(cptr + MAX_PEEK_WINDOW + 1 - begin_ptr_, &buf_[0],
-            size + begin_ptr_ - MAX_PEEK_WINDOW - 1);
-        begin_ptr_ = size + begin_ptr_ - MAX_PEEK_WINDOW - 1;
-      }
-      return size;
-    } else {  // consume buffer entirely and read more bytes
-      std::size_t const bytes_to_read = size - bytes_buffered;
-      if (begin_ptr_ <= end_ptr_) {
-        std::memcpy(cptr, &buf_[begin_ptr_], bytes_buffered);
-      } else {
-        std::memcpy(cptr, &buf_[begin_ptr_], MAX_PEEK_WINDOW + 1 - begin_ptr_);
-        std::memcpy(cptr + MAX_PEEK_WINDOW + 1 - begin_ptr_, &buf_[0],
-            bytes_buffered + begin_ptr_ - MAX_PEEK_WINDOW - 1);
-      }
-      begin_ptr_ = end_ptr_;
-      istm_.read(cptr + bytes_buffered, bytes_to_read);
-      return bytes_buffered + istm_.gcount();
-    }
+    std::size_t const nread = std::min(size, size_ - pos_);
+    std::memcpy(ptr, data_ + pos_, nread);
+    pos_ += nread;
+    return nread;
   }
 
   inline std::size_t PeekRead(void* ptr, std::size_t size) {
-    TREELITE_CHECK_LE(size, MAX_PEEK_WINDOW)
-        << "PeekableInputStream allows peeking up to " << MAX_PEEK_WINDOW << " bytes";
-    char* cptr = static_cast<char*>(ptr);
-    std::size_t const bytes_buffered = BytesBuffered();
-    /* fill buffer with additional bytes, up to size */
-    if (size > bytes_buffered) {
-      std::size_t const bytes_to_read = size - bytes_buffered;
-      if (end_ptr_ + bytes_to_read < MAX_PEEK_WINDOW + 1) {
-        istm_.read(&buf_[end_ptr_], bytes_to_read);
-        TREELITE_CHECK_EQ(istm_.gcount(), bytes_to_read) << "Failed to peek " << size << " bytes";
-        end_ptr_ += bytes_to_read;
-      } else {
-        istm_.read(&buf_[end_ptr_], MAX_PEEK_WINDOW + 1 - end_ptr_);
-        std::size_t first_read = istm_.gcount();
-        istm_.read(&buf_[0], bytes_to_read + end_ptr_ - MAX_PEEK_WINDOW - 1);
-        std::size_t second_read = istm_.gcount();
-        TREELITE_CHECK_EQ(first_read + second_read, bytes_to_read)
-            << "Ill-formed XGBoost model: Failed to peek " << size << " bytes";
-        end_ptr_ = bytes_to_read + end_ptr_ - MAX_PEEK_WINDOW - 1;
-      }
-    }
-    /* copy buffer into ptr without emptying buffer */
-    if (begin_ptr_ <= end_ptr_) {  // usual case
-      std::memcpy(cptr, &buf_[begin_ptr_], end_ptr_ - begin_ptr_);
-    } else {  // context wrapped around the end
-      std::memcpy(cptr, &buf_[begin_ptr_], MAX_PEEK_WINDOW + 1 - begin_ptr_);
-      std::memcpy(cptr + MAX_PEEK_WINDOW + 1 - begin_ptr_, &buf_[0], end_ptr_);
-    }
-
-    return size;
+    std::size_t const nread = std::min(size, size_ - pos_);
+    std::memcpy(ptr, data_ + pos_, nread);
+    return nread;
   }
 
  private:
-  std::istream& istm_;
-  std::vector<char> buf_;
-  std::size_t begin_ptr_, end_ptr_;
-
-  inline std::size_t BytesBuffered() {
-    if (begin_ptr_ <= end_ptr_) {  // usual case
-      return end_ptr_ - begin_ptr_;
-    } else {  // context wrapped around the end
-      return MAX_PEEK_WINDOW + 1 + end_ptr_ - begin_ptr_;
-    }
-  }
+  char const* data_;
+  std::size_t size_;
+  std::size_t pos_;
 };
 
 template <typename T>
@@ -285,7 +228,7 @@ class XGBTree {
     nodes[0].set_leaf(0.0f);
     nodes[0].set_parent(-1);
   }
-  inline void Load(PeekableInputStream* fi, LearnerModelParam const& mparam) {
+  inline void Load(BufferReader* fi, LearnerModelParam const& mparam) {
     TREELITE_CHECK_EQ(fi->Read(&param, sizeof(TreeParam)), sizeof(TreeParam))
         << "Ill-formed XGBoost model file: can't read TreeParam";
     TREELITE_CHECK_GT(param.num_nodes, 0) << "Ill-formed XGBoost model file: a tree can't be empty";
@@ -315,15 +258,15 @@ class XGBTree {
   }
 };
 
-inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
+inline std::unique_ptr<treelite::Model> ParseBuffer(void const* buf, std::size_t len) {
   std::vector<XGBTree> xgb_trees_;
   LearnerModelParam mparam_;  // model parameter
   GBTreeModelParam gbm_param_;  // GBTree training parameter
   std::string name_gbm_;
   std::string name_obj_;
 
-  /* 1. Parse input stream */
-  std::unique_ptr<PeekableInputStream> fp(new PeekableInputStream(fi));
+  /* 1. Parse input buffer */
+  std::unique_ptr<BufferReader> fp(new BufferReader(buf, len));
   // backward compatible header check.
   std::string header;
   header.resize(4);
@@ -387,12 +330,12 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
   if (name_gbm_ == "dart") {
     weight_drop.resize(gbm_param_.num_trees);
     std::uint64_t sz;
-    fi.read(reinterpret_cast<char*>(&sz), sizeof(std::uint64_t));
+    TREELITE_CHECK_EQ(fp->Read(&sz, sizeof(std::uint64_t)), sizeof(std::uint64_t))
+        << "Ill-formed XGBoost model file: cannot read size of weight drop array";
     TREELITE_CHECK_EQ(sz, gbm_param_.num_trees);
     if (gbm_param_.num_trees != 0) {
-      for (std::uint64_t i = 0; i < sz; ++i) {
-        fi.read(reinterpret_cast<char*>(&weight_drop[i]), sizeof(bst_float));
-      }
+      TREELITE_CHECK_EQ(fp->Read(weight_drop.data(), sizeof(bst_float) * sz), sizeof(bst_float) * sz)
+          << "Ill-formed XGBoost model file: cannot read weight drop array";
     }
   }
 
@@ -444,7 +387,6 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
       treelite::model_loader::detail::xgboost::GetPostProcessor(name_obj_)};
   treelite::model_builder::Metadata metadata{num_feature, task_type, average_tree_output,
       num_target, std::vector<std::int32_t>(num_target, num_class), leaf_vector_shape};
-  treelite::model_builder::TreeAnnotation tree_annotation{num_tree, target_id, class_id};
 
   // Set base scores. For now, XGBoost only supports a scalar base score for all targets / classes.
   auto base_score = static_cast<double>(mparam_.base_score);
@@ -458,39 +400,60 @@ inline std::unique_ptr<treelite::Model> ParseStream(std::istream& fi) {
   std::size_t const len_base_scores = num_target * num_class;
   std::vector<double> base_scores(len_base_scores, base_score);
 
-  auto builder = treelite::model_builder::GetModelBuilder(treelite::TypeInfo::kFloat32,
-      treelite::TypeInfo::kFloat32, metadata, tree_annotation, postprocessor, base_scores);
-
-  /* 3. Build trees */
-  for (int tree_id = 0; tree_id < xgb_trees_.size(); ++tree_id) {
-    auto const& xgb_tree = xgb_trees_[tree_id];
-    builder->StartTree();
-    for (int node_id = 0; node_id < xgb_tree.nodes.size(); ++node_id) {
-      auto const& node = xgb_tree.nodes[node_id];
-      if (!node.is_deleted()) {
-        builder->StartNode(node_id);
-        NodeStat const stat = xgb_tree.stats[node_id];
-        if (node.is_leaf()) {
-          bst_float leaf_value = node.leaf_value();
-          // Fold weight drop into leaf value for dart models.
-          if (!weight_drop.empty()) {
-            leaf_value *= weight_drop[tree_id];
+  namespace threading_utils = treelite::detail::threading_utils;
+
+  /* 3. Build trees. Decode the trees in parallel: each worker thread converts a contiguous
+   *    range of trees with its own model builder and the per-chunk models are combined by
+   *    moving the trees into a single model. */
+  threading_utils::ThreadConfig thread_config(0);
+  std::size_t const num_chunk = std::min(static_cast<std::size_t>(thread_config.nthread),
+      std::max<std::size_t>(xgb_trees_.size(), 1));
+  std::vector<std::unique_ptr<treelite::Model>> chunk_models(num_chunk);
+  threading_utils::ParallelFor(std::size_t(0), num_chunk, thread_config,
+      threading_utils::ParallelSchedule::Static(1), [&](std::size_t chunk_id, int) {
+        std::size_t const tree_begin = chunk_id * xgb_trees_.size() / num_chunk;
+        std::size_t const tree_end = (chunk_id + 1) * xgb_trees_.size() / num_chunk;
+        auto const chunk_size = static_cast<std::int32_t>(tree_end - tree_begin);
+        treelite::model_builder::TreeAnnotation chunk_annotation{chunk_size,
+            std::vector<std::int32_t>(
+                target_id.begin() + tree_begin, target_id.begin() + tree_end),
+            std::vector<std::int32_t>(class_id.begin() + tree_begin, class_id.begin() + tree_end)};
+        auto builder = treelite::model_builder::GetModelBuilder(treelite::TypeInfo::kFloat32,
+            treelite::TypeInfo::kFloat32, metadata, chunk_annotation, postprocessor, base_scores);
+        for (std::size_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+          auto const& xgb_tree = xgb_trees_[tree_id];
+          builder->StartTree(xgb_tree.nodes.size());
+          for (int node_id = 0; node_id < xgb_tree.nodes.size(); ++node_id) {
+            auto const& node = xgb_tree.nodes[node_id];
+            if (!node.is_deleted()) {
+              builder->StartNode(node_id);
+              NodeStat const stat = xgb_tree.stats[node_id];
+              if (node.is_leaf()) {
+                bst_float leaf_value = node.leaf_value();
+                // Fold weight drop into leaf value for dart models.
+                if (!weight_drop.empty()) {
+                  leaf_value *= weight_drop[tree_id];
+                }
+                builder->LeafScalar(leaf_value);
+              } else {
+                bst_float const split_cond = node.split_cond();
+                builder->NumericalTest(static_cast<std::int32_t>(node.split_index()),
+                    static_cast<float>(split_cond), node.default_left(), treelite::Operator::kLT,
+                    node.cleft(), node.cright());
+                builder->Gain(stat.loss_chg);
+              }
+              builder->SumHess(stat.sum_hess);
+              builder->EndNode();
+            }
           }
-          builder->LeafScalar(leaf_value);
-        } else {
-          bst_float const split_cond = node.split_cond();
-          builder->NumericalTest(static_cast<std::int32_t>(node.split_index()),
-              static_cast<float>(split_cond), node.default_left(), treelite::Operator::kLT,
-              node.cleft(), node.cright());
-          builder->Gain(stat.loss_chg);
+          builder->EndTree();
         }
-        builder->SumHess(stat.sum_hess);
-        builder->EndNode();
-      }
-    }
-    builder->EndTree();
+        chunk_models[chunk_id] = builder->CommitModel();
+      });
+  if (num_chunk == 1) {
+    return std::move(chunk_models[0]);
   }
-  return builder->CommitModel();
+  return treelite::ConcatenateModelObjects(std::move(chunk_models));
 }
 
 }  // anonymous namespace
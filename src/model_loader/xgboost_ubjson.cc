@@ -0,0 +1,409 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file xgboost_ubjson.cc
+ * \brief Model loader for XGBoost model (UBJSON)
+ * \author Hyunsu Cho
+ */
+#include "detail/xgboost_json.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <treelite/detail/file_utils.h>
+#include <treelite/logging.h>
+#include <treelite/model_loader.h>
+#include <treelite/tree.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <variant>
+
+namespace {
+
+namespace tl_detail = treelite::model_loader::detail;
+
+/*!
+ * \brief Recursive-descent parser for UBJSON (Draft 12), emitting the same SAX events as
+ *        rapidjson::Reader so that the existing XGBoost handler hierarchy can consume
+ *        UBJSON documents directly, without first converting them to text JSON. Numbers
+ *        are binary-encoded in UBJSON (big-endian, per spec), so parsing avoids the costly
+ *        decimal conversions that dominate text JSON parsing. Supports the optimized
+ *        container format (type marker '$' and count marker '#') that XGBoost uses for
+ *        numeric arrays.
+ */
+class UBJSONReader {
+ public:
+  UBJSONReader(char const* data, std::size_t length)
+      : data_{reinterpret_cast<std::uint8_t const*>(data)}, length_{length} {}
+
+  /*!
+   * \brief Parse a single UBJSON value, feeding SAX events to the handler. Returns false
+   *        on malformed input or when the handler rejects an event; query Offset() and
+   *        ErrorMessage() for diagnostics.
+   */
+  bool Parse(tl_detail::DelegatedHandler& handler) {
+    char marker;
+    if (!ReadMarker(&marker)) {
+      return false;
+    }
+    if (!ParseValue(handler, marker)) {
+      return false;
+    }
+    return true;
+  }
+
+  std::size_t Offset() const {
+    return pos_;
+  }
+  std::string const& ErrorMessage() const {
+    return error_message_;
+  }
+
+ private:
+  bool Fail(std::string const& message) {
+    if (error_message_.empty()) {  // Keep the innermost (most specific) error
+      error_message_ = message;
+    }
+    return false;
+  }
+
+  bool ReadBytes(void* dest, std::size_t nbyte) {
+    if (pos_ + nbyte > length_) {
+      return Fail("Unexpected end of input");
+    }
+    std::memcpy(dest, data_ + pos_, nbyte);
+    pos_ += nbyte;
+    return true;
+  }
+
+  /*! \brief Read the next type marker, skipping no-op ('N') markers */
+  bool ReadMarker(char* marker) {
+    do {
+      if (pos_ >= length_) {
+        return Fail("Unexpected end of input");
+      }
+      *marker = static_cast<char>(data_[pos_++]);
+    } while (*marker == 'N');
+    return true;
+  }
+
+  /*! \brief Read a big-endian scalar of type T */
+  template <typename T>
+  bool ReadScalar(T* dest) {
+    std::uint8_t buf[sizeof(T)];
+    if (!ReadBytes(buf, sizeof(T))) {
+      return false;
+    }
+    std::reverse(std::begin(buf), std::end(buf));  // UBJSON numbers are big-endian
+    std::memcpy(dest, buf, sizeof(T));
+    return true;
+  }
+
+  /*! \brief Read a numeric value with the given type marker, widened to int64 */
+  bool ReadInteger(char marker, std::int64_t* dest) {
+    switch (marker) {
+    case 'i': {
+      std::int8_t val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      *dest = val;
+      return true;
+    }
+    case 'U': {
+      std::uint8_t val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      *dest = val;
+      return true;
+    }
+    case 'I': {
+      std::int16_t val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      *dest = val;
+      return true;
+    }
+    case 'l': {
+      std::int32_t val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      *dest = val;
+      return true;
+    }
+    case 'L': {
+      std::int64_t val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      *dest = val;
+      return true;
+    }
+    default:
+      return Fail(std::string{"Expected an integer type marker, got '"} + marker + "'");
+    }
+  }
+
+  /*! \brief Read a length-prefixed string payload (the 'S' marker must have been consumed) */
+  bool ReadString(std::string* dest) {
+    char marker;
+    std::int64_t str_length;
+    if (!ReadMarker(&marker) || !ReadInteger(marker, &str_length)) {
+      return false;
+    }
+    if (str_length < 0) {
+      return Fail("Negative string length");
+    }
+    dest->resize(static_cast<std::size_t>(str_length));
+    return ReadBytes(dest->data(), dest->size());
+  }
+
+  /*!
+   * \brief Read the optional '$'/'#' preamble of a container. On return, *elem_type is the
+   *        element type marker ('\0' when elements carry their own markers) and *count is
+   *        the element count (-1 when the container is terminated by an end marker).
+   */
+  bool ReadContainerPreamble(char* first_marker, char* elem_type, std::int64_t* count) {
+    *elem_type = '\0';
+    *count = -1;
+    if (!ReadMarker(first_marker)) {
+      return false;
+    }
+    if (*first_marker == '$') {
+      if (!ReadMarker(elem_type)) {
+        return false;
+      }
+      if (!ReadMarker(first_marker)) {
+        return false;
+      }
+      if (*first_marker != '#') {
+        return Fail("Type marker '$' must be followed by count marker '#'");
+      }
+    }
+    if (*first_marker == '#') {
+      char marker;
+      if (!ReadMarker(&marker) || !ReadInteger(marker, count)) {
+        return false;
+      }
+      if (*count < 0) {
+        return Fail("Negative container count");
+      }
+    }
+    return true;
+  }
+
+  bool ParseValue(tl_detail::DelegatedHandler& handler, char marker) {
+    switch (marker) {
+    case 'Z':
+      return handler.Null() || Fail("Invalid model structure");
+    case 'T':
+      return handler.Bool(true) || Fail("Invalid model structure");
+    case 'F':
+      return handler.Bool(false) || Fail("Invalid model structure");
+    case 'i':
+    case 'U':
+    case 'I':
+    case 'l': {
+      // Match the convention of rapidjson::Reader, which emits the Uint event for
+      // non-negative integers; some handlers only accept one of Int / Uint.
+      std::int64_t val;
+      if (!ReadInteger(marker, &val)) {
+        return false;
+      }
+      bool const accepted = (val >= 0) ? handler.Uint(static_cast<unsigned>(val))
+                                       : handler.Int(static_cast<int>(val));
+      return accepted || Fail("Invalid model structure");
+    }
+    case 'L': {
+      std::int64_t val;
+      if (!ReadInteger(marker, &val)) {
+        return false;
+      }
+      bool const accepted = (val >= 0) ? handler.Uint64(static_cast<std::uint64_t>(val))
+                                       : handler.Int64(val);
+      return accepted || Fail("Invalid model structure");
+    }
+    case 'd': {
+      float val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      return handler.Double(static_cast<double>(val)) || Fail("Invalid model structure");
+    }
+    case 'D': {
+      double val;
+      if (!ReadScalar(&val)) {
+        return false;
+      }
+      return handler.Double(val) || Fail("Invalid model structure");
+    }
+    case 'C': {
+      char val;
+      if (!ReadBytes(&val, 1)) {
+        return false;
+      }
+      return handler.String(&val, 1, true) || Fail("Invalid model structure");
+    }
+    case 'S': {
+      std::string str;
+      if (!ReadString(&str)) {
+        return false;
+      }
+      return handler.String(str.c_str(), str.size(), true) || Fail("Invalid model structure");
+    }
+    case '[':
+      return ParseArray(handler);
+    case '{':
+      return ParseObject(handler);
+    default:
+      return Fail(std::string{"Unexpected type marker '"} + marker + "'");
+    }
+  }
+
+  bool ParseArray(tl_detail::DelegatedHandler& handler) {
+    if (!handler.StartArray()) {
+      return Fail("Invalid model structure");
+    }
+    char marker, elem_type;
+    std::int64_t count;
+    if (!ReadContainerPreamble(&marker, &elem_type, &count)) {
+      return false;
+    }
+    std::size_t num_elem = 0;
+    if (count >= 0) {
+      for (std::int64_t i = 0; i < count; ++i, ++num_elem) {
+        if (elem_type == '\0' && !ReadMarker(&marker)) {
+          return false;
+        }
+        if (!ParseValue(handler, elem_type != '\0' ? elem_type : marker)) {
+          return false;
+        }
+      }
+    } else {
+      while (marker != ']') {
+        if (!ParseValue(handler, marker)) {
+          return false;
+        }
+        ++num_elem;
+        if (!ReadMarker(&marker)) {
+          return false;
+        }
+      }
+    }
+    return handler.EndArray(num_elem) || Fail("Invalid model structure");
+  }
+
+  bool ParseObject(tl_detail::DelegatedHandler& handler) {
+    if (!handler.StartObject()) {
+      return Fail("Invalid model structure");
+    }
+    char marker, elem_type;
+    std::int64_t count;
+    if (!ReadContainerPreamble(&marker, &elem_type, &count)) {
+      return false;
+    }
+    std::string key;
+    std::size_t num_member = 0;
+    if (count >= 0) {
+      for (std::int64_t i = 0; i < count; ++i, ++num_member) {
+        if (!ReadString(&key)) {
+          return false;
+        }
+        if (!handler.Key(key.c_str(), key.size(), true)) {
+          return Fail("Invalid model structure");
+        }
+        if (elem_type == '\0' && !ReadMarker(&marker)) {
+          return false;
+        }
+        if (!ParseValue(handler, elem_type != '\0' ? elem_type : marker)) {
+          return false;
+        }
+      }
+    } else {
+      while (marker != '}') {
+        pos_ -= 1;  // The marker is the first byte of the key's length prefix
+        if (!ReadString(&key)) {
+          return false;
+        }
+        if (!handler.Key(key.c_str(), key.size(), true)) {
+          return Fail("Invalid model structure");
+        }
+        if (!ReadMarker(&marker)) {
+          return false;
+        }
+        if (!ParseValue(handler, marker)) {
+          return false;
+        }
+        ++num_member;
+        if (!ReadMarker(&marker)) {
+          return false;
+        }
+      }
+    }
+    return handler.EndObject(num_member) || Fail("Invalid model structure");
+  }
+
+  std::uint8_t const* data_;
+  std::size_t length_;
+  std::size_t pos_{0};
+  std::string error_message_{};
+};
+
+}  // anonymous namespace
+
+namespace treelite::model_loader {
+
+std::unique_ptr<treelite::Model> LoadXGBoostModelUBJSON(
+    std::string const& filename, char const* config_json) {
+  auto ifs = treelite::detail::OpenFileForReadAsStream(filename);
+  auto const file_size = std::filesystem::file_size(std::filesystem::u8path(filename));
+  std::string ubjson_str(static_cast<std::size_t>(file_size), '\0');
+  ifs.read(ubjson_str.data(), static_cast<std::streamsize>(ubjson_str.size()));
+  TREELITE_CHECK(ifs) << "Failed to read " << filename;
+  return LoadXGBoostModelFromUBJSONString(ubjson_str.c_str(), ubjson_str.size(), config_json);
+}
+
+std::unique_ptr<treelite::Model> LoadXGBoostModelFromUBJSONString(
+    char const* ubjson_str, std::size_t length, char const* config_json) {
+  rapidjson::Document parsed_config;
+  parsed_config.Parse(config_json);
+  TREELITE_CHECK(!parsed_config.HasParseError())
+      << "Error when parsing JSON config: offset " << parsed_config.GetErrorOffset() << ", "
+      << rapidjson::GetParseError_En(parsed_config.GetParseError());
+
+  std::shared_ptr<tl_detail::DelegatedHandler> handler
+      = tl_detail::DelegatedHandler::create(parsed_config);
+  UBJSONReader reader{ubjson_str, length};
+  if (!reader.Parse(*handler)) {
+    TREELITE_LOG(FATAL) << "Provided UBJSON could not be parsed as XGBoost model. "
+                        << "Parsing error at offset " << reader.Offset() << ": "
+                        << reader.ErrorMessage();
+  }
+  tl_detail::ParsedXGBoostModel parsed = handler->get_result();
+  auto model = parsed.builder->CommitModel();
+
+  // Apply Dart weights
+  if (!parsed.weight_drop.empty()) {
+    auto& trees = std::get<treelite::ModelPreset<float, float>>(model->variant_).trees;
+    TREELITE_CHECK_EQ(trees.size(), parsed.weight_drop.size());
+    for (std::size_t i = 0; i < trees.size(); ++i) {
+      for (int nid = 0; nid < trees[i].num_nodes; ++nid) {
+        if (trees[i].IsLeaf(nid)) {
+          trees[i].SetLeaf(
+              nid, static_cast<float>(parsed.weight_drop[i] * trees[i].LeafValue(nid)));
+        }
+      }
+    }
+  }
+  return model;
+}
+
+}  // namespace treelite::model_loader
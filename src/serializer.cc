@@ -5,18 +5,28 @@
  * \author Hyunsu Cho
  */
 
+#include <treelite/detail/arena.h>
+#include <treelite/detail/mmap_file.h>
 #include <treelite/detail/serializer_mixins.h>
+#include <treelite/detail/shm_region.h>
+#include <treelite/detail/threading_utils.h>
 #include <treelite/enum/operator.h>
 #include <treelite/enum/tree_node_type.h>
 #include <treelite/logging.h>
+#include <treelite/trace.h>
 #include <treelite/tree.h>
 #include <treelite/version.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -83,10 +93,39 @@ struct NodeV3 {
   }
 };
 
+ContiguousArray<std::uint64_t> ComputeTreeOffsets(Model& model);
+
 template <typename MixIn>
 class Serializer {
  public:
-  explicit Serializer(std::shared_ptr<MixIn> mixin) : mixin_(mixin) {}
+  /*!
+   * \brief Construct a serializer. When include_tree_offsets is set, a per-tree byte offset
+   *        table is emitted as an optional per-model field, so that deserializers with
+   *        random access to the payload can decode trees in parallel. Older readers skip
+   *        the field. When codec is not kUncompressed, a "codec" optional field is emitted,
+   *        announcing that the tree section uses compressed array frames; the tree offsets
+   *        must then be supplied via UsePrecomputedTreeOffsets, as they refer to the
+   *        compressed records.
+   */
+  explicit Serializer(
+      std::shared_ptr<MixIn> mixin, bool include_tree_offsets = false, Codec codec = Codec::kUncompressed)
+      : mixin_(mixin), include_tree_offsets_(include_tree_offsets), codec_(codec) {}
+
+  /*! \brief Supply a precomputed tree offset table, instead of deriving one from the model */
+  void UsePrecomputedTreeOffsets(ContiguousArray<std::uint64_t> tree_offsets) {
+    precomputed_tree_offsets_ = std::move(tree_offsets);
+    has_precomputed_tree_offsets_ = true;
+  }
+
+  /*!
+   * \brief Emit a "padding" optional field holding num_padding_bytes zero bytes, reserving
+   *        header space so the header can later be rewritten in place after trees are
+   *        appended to the checkpoint. Readers skip the field like any unrecognized one.
+   */
+  void ReserveHeaderPadding(std::uint64_t num_padding_bytes) {
+    padding_len_ = num_padding_bytes;
+    has_padding_ = true;
+  }
 
   void SerializeHeader(Model& model) {
     // Header 1
@@ -120,9 +159,49 @@ class Serializer {
     mixin_->SerializeArray(&model.base_scores);
     mixin_->SerializeString(&model.attributes);
 
-    /* Extension Slot 1: Per-model optional fields -- to be added later */
-    model.num_opt_field_per_model_ = 0;
+    /* Extension Slot 1: Per-model optional fields */
+    model.num_opt_field_per_model_ = (include_tree_offsets_ ? 1 : 0)
+                                     + (codec_ != Codec::kUncompressed ? 1 : 0)
+                                     + (has_padding_ ? 1 : 0);
     mixin_->SerializeScalar(&model.num_opt_field_per_model_);
+    if (codec_ != Codec::kUncompressed) {
+      // "codec": codec used by the array frames in the tree section. Note that the header
+      // itself, including this field, is never compressed.
+      std::string field_name = "codec";
+      mixin_->SerializeString(&field_name);
+      std::uint64_t elem_size = sizeof(std::uint8_t);
+      mixin_->SerializeScalar(&elem_size);
+      ContiguousArray<std::uint8_t> codec_field;
+      codec_field.PushBack(static_cast<std::uint8_t>(codec_));
+      mixin_->SerializeArray(&codec_field);
+    }
+    if (include_tree_offsets_) {
+      // "tree_offsets": byte offsets delimiting each tree's record in the tree section,
+      // relative to the end of the header; (num_tree + 1) elements
+      std::string field_name = "tree_offsets";
+      mixin_->SerializeString(&field_name);
+      std::uint64_t elem_size = sizeof(std::uint64_t);
+      mixin_->SerializeScalar(&elem_size);
+      if (has_precomputed_tree_offsets_) {
+        mixin_->SerializeArray(&precomputed_tree_offsets_);
+      } else {
+        TREELITE_CHECK(codec_ == Codec::kUncompressed)
+            << "Compressed serialization requires a precomputed tree offset table";
+        ContiguousArray<std::uint64_t> tree_offsets = ComputeTreeOffsets(model);
+        mixin_->SerializeArray(&tree_offsets);
+      }
+    }
+    if (has_padding_) {
+      // "padding": reserved header space for in-place header rewrites after an append;
+      // carries no information and is skipped by readers
+      std::string field_name = "padding";
+      mixin_->SerializeString(&field_name);
+      std::uint64_t elem_size = sizeof(std::uint8_t);
+      mixin_->SerializeScalar(&elem_size);
+      ContiguousArray<std::uint8_t> padding_field;
+      padding_field.Resize(padding_len_, 0);
+      mixin_->SerializeArray(&padding_field);
+    }
   }
 
   void SerializeTrees(Model& model) {
@@ -176,12 +255,98 @@ class Serializer {
 
  private:
   std::shared_ptr<MixIn> mixin_;
+  bool include_tree_offsets_{false};
+  Codec codec_{Codec::kUncompressed};
+  ContiguousArray<std::uint64_t> precomputed_tree_offsets_;
+  bool has_precomputed_tree_offsets_{false};
+  std::uint64_t padding_len_{0};
+  bool has_padding_{false};
+};
+
+// Compute the byte offset of each tree's record in the tree section, by running each tree
+// through a counting serializer. (num_tree + 1) elements; the last one is the total size.
+inline ContiguousArray<std::uint64_t> ComputeTreeOffsets(Model& model) {
+  ContiguousArray<std::uint64_t> tree_offsets;
+  tree_offsets.PushBack(0);
+  std::visit(
+      [&](auto&& concrete_model) {
+        for (auto& tree : concrete_model.trees) {
+          auto counter = std::make_shared<CountingSerializerMixIn>();
+          Serializer<CountingSerializerMixIn> tree_serializer{counter};
+          tree_serializer.SerializeTree(tree);
+          tree_offsets.PushBack(tree_offsets.Back() + counter->GetByteCount());
+        }
+      },
+      model.variant_);
+  return tree_offsets;
+}
+
+/*!
+ * \brief Bare stack cursor used by the same-version fast decoding path. Mirrors the
+ *        semantics of BufferDeserializerMixIn (including the alignment-checked zero-copy
+ *        referencing and the arena fallback), without the shared-ownership wrapping that
+ *        the generic mix-in machinery requires.
+ */
+template <bool kCopyArrays>
+struct FastBufferCursor {
+  char* cur;
+  char* end;
+  Arena* arena;
+
+  char* Consume(std::uint64_t nbytes) {
+    TREELITE_CHECK_LE(nbytes, static_cast<std::uint64_t>(end - cur))
+        << "Unexpected end of buffer while deserializing a model";
+    char* ptr = cur;
+    cur += nbytes;
+    return ptr;
+  }
+
+  template <typename T>
+  void Scalar(T* field) {
+    std::memcpy(field, Consume(sizeof(T)), sizeof(T));
+  }
+
+  template <typename T>
+  void Array(ContiguousArray<T>* field) {
+    std::uint64_t nelem;
+    Scalar(&nelem);
+    field->Clear();
+    if (nelem == 0) {
+      return;  // handle empty arrays
+    }
+    char* buf = Consume(sizeof(T) * nelem);
+    if (!kCopyArrays && reinterpret_cast<std::uintptr_t>(buf) % alignof(T) == 0) {
+      field->UseForeignBuffer(buf, nelem);
+    } else if (arena) {
+      void* mem = arena->Allocate(sizeof(T) * nelem, alignof(T));
+      std::memcpy(mem, buf, sizeof(T) * nelem);
+      field->UseForeignBuffer(mem, nelem);
+    } else {
+      field->Resize(nelem);
+      std::memcpy(field->Data(), buf, sizeof(T) * nelem);
+    }
+  }
+
+  template <typename T>
+  void Skip(ContiguousArray<T>* field) {
+    field->Clear();
+    std::uint64_t nelem;
+    Scalar(&nelem);
+    Consume(sizeof(T) * nelem);
+  }
 };
 
 template <typename MixIn>
 class Deserializer {
  public:
-  explicit Deserializer(std::shared_ptr<MixIn> mixin) : mixin_(mixin) {}
+  /*!
+   * \brief Construct a deserializer. When skip_node_stats is set, the node-statistics arrays
+   *        (data counts, sums of Hessians, gains) are skipped instead of materialized;
+   *        inference does not read them, and they can make up a sizable share of the
+   *        resident model size.
+   */
+  explicit Deserializer(std::shared_ptr<MixIn> mixin, bool skip_node_stats = false)
+      : mixin_(mixin), skip_node_stats_(skip_node_stats) {}
 
   std::unique_ptr<Model> DeserializeHeaderAndCreateModel() {
     // Header 1
@@ -234,16 +399,49 @@ class Deserializer {
     mixin_->DeserializeArray(&model->base_scores);
     mixin_->DeserializeString(&model->attributes);
 
-    /* Extension Slot 1: Per-model optional fields -- to be added later */
+    /* Extension Slot 1: Per-model optional fields */
     mixin_->DeserializeScalar(&model->num_opt_field_per_model_);
-    // Ignore extra fields; the input is likely from a later version of Treelite
     for (std::int32_t i = 0; i < model->num_opt_field_per_model_; ++i) {
-      mixin_->SkipOptionalField();
+      std::string field_name;
+      mixin_->DeserializeString(&field_name);
+      if (field_name == "tree_offsets") {
+        // Byte offsets delimiting each tree's record in the tree section; enables
+        // parallel per-tree decoding when the payload is randomly accessible
+        std::uint64_t elem_size;
+        mixin_->DeserializeScalar(&elem_size);
+        TREELITE_CHECK_EQ(elem_size, sizeof(std::uint64_t)) << "Invalid tree_offsets field";
+        mixin_->DeserializeArray(&tree_offsets_);
+      } else if (field_name == "codec") {
+        // Codec used by the array frames in the tree section
+        std::uint64_t elem_size;
+        mixin_->DeserializeScalar(&elem_size);
+        TREELITE_CHECK_EQ(elem_size, sizeof(std::uint8_t)) << "Invalid codec field";
+        ContiguousArray<std::uint8_t> codec_field;
+        mixin_->DeserializeArray(&codec_field);
+        TREELITE_CHECK_EQ(codec_field.Size(), 1) << "Invalid codec field";
+        codec_ = static_cast<Codec>(codec_field[0]);
+      } else {
+        // Ignore unrecognized fields; the input is likely from a later version of Treelite
+        mixin_->SkipOptionalFieldContent();
+      }
     }
 
     return model;
   }
 
+  /*!
+   * \brief Per-tree offset table found in the model header, if any. Empty when the input
+   *        predates the field.
+   */
+  ContiguousArray<std::uint64_t> const& TreeOffsets() const {
+    return tree_offsets_;
+  }
+
+  /*! \brief Codec used by the array frames in the tree section */
+  Codec GetCodec() const {
+    return codec_;
+  }
+
   void DeserializeTrees(Model& model) {
     if (model.major_ver_ == 3) {
       std::visit(
@@ -289,12 +487,21 @@ class Deserializer {
     mixin_->DeserializeArray(&tree.category_list_end_);
 
     // Node statistics
-    mixin_->DeserializeArray(&tree.data_count_);
-    mixin_->DeserializeArray(&tree.data_count_present_);
-    mixin_->DeserializeArray(&tree.sum_hess_);
-    mixin_->DeserializeArray(&tree.sum_hess_present_);
-    mixin_->DeserializeArray(&tree.gain_);
-    mixin_->DeserializeArray(&tree.gain_present_);
+    if (skip_node_stats_) {
+      mixin_->SkipArray(&tree.data_count_);
+      mixin_->SkipArray(&tree.data_count_present_);
+      mixin_->SkipArray(&tree.sum_hess_);
+      mixin_->SkipArray(&tree.sum_hess_present_);
+      mixin_->SkipArray(&tree.gain_);
+      mixin_->SkipArray(&tree.gain_present_);
+    } else {
+      mixin_->DeserializeArray(&tree.data_count_);
+      mixin_->DeserializeArray(&tree.data_count_present_);
+      mixin_->DeserializeArray(&tree.sum_hess_);
+      mixin_->DeserializeArray(&tree.sum_hess_present_);
+      mixin_->DeserializeArray(&tree.gain_);
+      mixin_->DeserializeArray(&tree.gain_present_);
+    }
 
     /* Extension slot 2: Per-tree optional fields -- to be added later */
     mixin_->DeserializeScalar(&tree.num_opt_field_per_tree_);
@@ -311,8 +518,66 @@ class Deserializer {
     }
   }
 
+  /*!
+   * \brief Straight-line decoder for a tree record written by this exact Treelite version.
+   *        Functionally identical to DeserializeTree over a buffer mix-in, but the record
+   *        layout is known bit for bit: fields decode against a bare stack cursor, with no
+   *        per-tree mix-in allocation and no optional-field skip loops (a same-version
+   *        writer always leaves the extension slots empty). Callers must have checked the
+   *        version triple in the header.
+   */
+  template <bool kCopyArrays, typename ThresholdType, typename LeafOutputType>
+  static void DeserializeTreeSameVersion(char* base, std::uint64_t size,
+      Tree<ThresholdType, LeafOutputType>& tree, bool skip_node_stats, Arena* arena) {
+    FastBufferCursor<kCopyArrays> cur{base, base + size, arena};
+    cur.Scalar(&tree.num_nodes);
+    cur.Scalar(&tree.has_categorical_split_);
+    cur.Array(&tree.node_type_);
+    cur.Array(&tree.cleft_);
+    cur.Array(&tree.cright_);
+    cur.Array(&tree.split_index_);
+    cur.Array(&tree.default_left_);
+    cur.Array(&tree.leaf_value_);
+    cur.Array(&tree.threshold_);
+    cur.Array(&tree.cmp_);
+    cur.Array(&tree.category_list_right_child_);
+    cur.Array(&tree.leaf_vector_);
+    cur.Array(&tree.leaf_vector_begin_);
+    cur.Array(&tree.leaf_vector_end_);
+    cur.Array(&tree.category_list_);
+    cur.Array(&tree.category_list_begin_);
+    cur.Array(&tree.category_list_end_);
+
+    // Node statistics
+    if (skip_node_stats) {
+      cur.Skip(&tree.data_count_);
+      cur.Skip(&tree.data_count_present_);
+      cur.Skip(&tree.sum_hess_);
+      cur.Skip(&tree.sum_hess_present_);
+      cur.Skip(&tree.gain_);
+      cur.Skip(&tree.gain_present_);
+    } else {
+      cur.Array(&tree.data_count_);
+      cur.Array(&tree.data_count_present_);
+      cur.Array(&tree.sum_hess_);
+      cur.Array(&tree.sum_hess_present_);
+      cur.Array(&tree.gain_);
+      cur.Array(&tree.gain_present_);
+    }
+
+    cur.Scalar(&tree.num_opt_field_per_tree_);
+    TREELITE_CHECK_EQ(tree.num_opt_field_per_tree_, 0)
+        << "A checkpoint from this Treelite version must leave extension slot 2 empty";
+    cur.Scalar(&tree.num_opt_field_per_node_);
+    TREELITE_CHECK_EQ(tree.num_opt_field_per_node_, 0)
+        << "A checkpoint from this Treelite version must leave extension slot 3 empty";
+  }
+
  private:
   std::shared_ptr<MixIn> mixin_;
+  bool skip_node_stats_{false};
+  ContiguousArray<std::uint64_t> tree_offsets_;
+  Codec codec_{Codec::kUncompressed};
 
   std::unique_ptr<Model> DeserializeHeaderAndCreateModelV3(
       std::int32_t major_ver, std::int32_t minor_ver, std::int32_t patch_ver) {
@@ -450,9 +715,99 @@ class Deserializer {
     mixin_->DeserializeScalar(&tree.num_opt_field_per_node_);
     TREELITE_CHECK_EQ(tree.num_opt_field_per_node_, 0)
         << "Extension slot 3 must be unused in Treelite 3.x";
+
+    if (skip_node_stats_) {
+      // The V3 node records embed the statistics, so they cannot be skipped while reading;
+      // drop them after the fact, releasing the backing buffers
+      tree.data_count_ = ContiguousArray<std::uint64_t>{};
+      tree.data_count_present_ = ContiguousArray<bool>{};
+      tree.sum_hess_ = ContiguousArray<double>{};
+      tree.sum_hess_present_ = ContiguousArray<bool>{};
+      tree.gain_ = ContiguousArray<double>{};
+      tree.gain_present_ = ContiguousArray<bool>{};
+    }
   }
 };
 
+/*!
+ * \brief Encode all trees into a preallocated buffer in parallel, partitioning them across
+ *        threads. tree_offsets must have been computed with ComputeTreeOffsets, so every
+ *        thread writes to a disjoint extent; the buffer must hold tree_offsets.Back() bytes.
+ */
+void SerializeTreesInParallel(
+    Model& model, char* tree_section, ContiguousArray<std::uint64_t> const& tree_offsets) {
+  namespace tu = detail::threading_utils;
+  auto thread_config = tu::ThreadConfig{0};  // use all available threads
+  std::visit(
+      [&](auto&& concrete_model) {
+        tu::ParallelFor(std::size_t(0), concrete_model.trees.size(), thread_config,
+            tu::ParallelSchedule::Static(), [&](std::size_t tree_id, int) {
+              std::uint64_t const nbytes = tree_offsets[tree_id + 1] - tree_offsets[tree_id];
+              auto mixin = std::make_shared<BufferSerializerMixIn>(
+                  tree_section + tree_offsets[tree_id], nbytes);
+              Serializer<BufferSerializerMixIn> serializer{mixin};
+              serializer.SerializeTree(concrete_model.trees[tree_id]);
+              TREELITE_CHECK_EQ(mixin->Tell(), nbytes)
+                  << "Tree " << tree_id << " did not fill its computed extent";
+            });
+      },
+      model.variant_);
+}
+
+/*!
+ * \brief Decode trees [tree_begin, tree_end) in parallel, partitioning them across threads.
+ *        tree_section points at the first tree's record; tree_offsets delimits each tree's
+ *        record within it, so every thread can decode its tree range independently. Requires
+ *        random access to the payload, hence only buffer-backed deserialization qualifies.
+ *        Trees below tree_begin are left as they are, so a model can be extended in place.
+ */
+template <typename BufferMixIn>
+void DeserializeTreeRangeInParallel(Model& model, char* tree_section,
+    ContiguousArray<std::uint64_t> const& tree_offsets, std::uint64_t tree_begin,
+    std::uint64_t tree_end, bool skip_node_stats = false, detail::Arena* arena = nullptr) {
+  namespace tu = detail::threading_utils;
+  auto thread_config = tu::ThreadConfig{0};  // use all available threads
+  // Uncompressed records written by this exact Treelite version decode through the
+  // straight-line routine, which bypasses the per-field compatibility logic. Nearly all
+  // loads read a checkpoint written by the running version, so this is the common case.
+  Version const version = model.GetVersion();
+  bool const same_version = version.major_ver == TREELITE_VER_MAJOR
+                            && version.minor_ver == TREELITE_VER_MINOR
+                            && version.patch_ver == TREELITE_VER_PATCH;
+  std::visit(
+      [&](auto&& concrete_model) {
+        concrete_model.trees.resize(tree_end);
+        tu::ParallelFor(tree_begin, tree_end, thread_config, tu::ParallelSchedule::Static(),
+            [&](std::uint64_t tree_id, int) {
+              if constexpr (std::is_same_v<BufferMixIn, MemoryBufferDeserializerMixIn>
+                            || std::is_same_v<BufferMixIn, MappedFileDeserializerMixIn>) {
+                if (same_version) {
+                  constexpr bool kCopyArrays
+                      = std::is_same_v<BufferMixIn, MemoryBufferDeserializerMixIn>;
+                  Deserializer<BufferMixIn>::template DeserializeTreeSameVersion<kCopyArrays>(
+                      tree_section + tree_offsets[tree_id],
+                      tree_offsets[tree_id + 1] - tree_offsets[tree_id],
+                      concrete_model.trees[tree_id], skip_node_stats, arena);
+                  return;
+                }
+              }
+              auto mixin = std::make_shared<BufferMixIn>(tree_section + tree_offsets[tree_id],
+                  tree_offsets[tree_id + 1] - tree_offsets[tree_id], arena);
+              Deserializer<BufferMixIn> deserializer{mixin, skip_node_stats};
+              deserializer.DeserializeTree(concrete_model.trees[tree_id]);
+            });
+      },
+      model.variant_);
+}
+
+template <typename BufferMixIn>
+void DeserializeTreesInParallel(Model& model, char* tree_section,
+    ContiguousArray<std::uint64_t> const& tree_offsets, bool skip_node_stats = false,
+    detail::Arena* arena = nullptr) {
+  DeserializeTreeRangeInParallel<BufferMixIn>(
+      model, tree_section, tree_offsets, 0, tree_offsets.Size() - 1, skip_node_stats, arena);
+}
+
 }  // namespace detail::serializer
 
 std::vector<PyBufferFrame> Model::SerializeToPyBuffer() {
@@ -472,19 +827,375 @@ std::unique_ptr<Model> Model::DeserializeFromPyBuffer(std::vector<PyBufferFrame>
   return model;
 }
 
-void Model::SerializeToStream(std::ostream& os) {
+void Model::SerializeToStream(std::ostream& os, Codec codec, std::uint64_t reserve_num_tree) {
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("serializer::serialize_stream");
+  // Every header component that scales with the tree count costs 16 bytes per tree:
+  // one std::int32_t each in target_id and class_id, one std::uint64_t in tree_offsets.
+  // Reserving that much padding lets AppendTreesToCheckpoint rewrite the header in place
+  // until the model grows past reserve_num_tree trees.
+  std::uint64_t const num_tree = GetNumTree();
+  std::uint64_t const padding_len
+      = reserve_num_tree > num_tree ? 16 * (reserve_num_tree - num_tree) : 0;
+  if (codec == Codec::kUncompressed) {
+    // Size each tree's encoded extent up front, encode the trees into a single buffer in
+    // parallel, then flush with one large sequential write; the wall clock is bounded by
+    // memory and disk bandwidth instead of one core issuing small writes
+    ContiguousArray<std::uint64_t> tree_offsets = detail::serializer::ComputeTreeOffsets(*this);
+    std::vector<char> tree_buffer(tree_offsets.Back());
+    detail::serializer::SerializeTreesInParallel(*this, tree_buffer.data(), tree_offsets);
+
+    auto mixin = std::make_shared<detail::serializer::StreamSerializerMixIn>(os);
+    // Include the per-tree offset table, so deserializers can decode trees in parallel
+    detail::serializer::Serializer<detail::serializer::StreamSerializerMixIn> serializer{
+        mixin, /*include_tree_offsets=*/true};
+    serializer.UsePrecomputedTreeOffsets(std::move(tree_offsets));
+    if (reserve_num_tree > 0) {
+      serializer.ReserveHeaderPadding(padding_len);
+    }
+    serializer.SerializeHeader(*this);
+    os.write(tree_buffer.data(), static_cast<std::streamsize>(tree_buffer.size()));
+    return;
+  }
+  TREELITE_CHECK(codec == Codec::kLZ4) << "Unrecognized codec";
+
+  // Compressed records have no precomputable size; encode each tree into its own buffer,
+  // in parallel, then derive the offset table from the buffer sizes. The offsets refer to
+  // the compressed records, so lazy and parallel loaders keep working on compressed
+  // checkpoints.
+  std::vector<std::vector<char>> tree_buffers;
+  std::visit(
+      [&](auto&& concrete_model) {
+        namespace tu = detail::threading_utils;
+        tree_buffers.resize(concrete_model.trees.size());
+        auto thread_config = tu::ThreadConfig{0};  // use all available threads
+        tu::ParallelFor(std::size_t(0), concrete_model.trees.size(), thread_config,
+            tu::ParallelSchedule::Static(), [&](std::size_t tree_id, int) {
+              auto tree_mixin = std::make_shared<detail::serializer::CompressedVectorSerializerMixIn>(
+                  tree_buffers[tree_id], codec);
+              detail::serializer::Serializer<detail::serializer::CompressedVectorSerializerMixIn>
+                  tree_serializer{tree_mixin};
+              tree_serializer.SerializeTree(concrete_model.trees[tree_id]);
+            });
+      },
+      variant_);
+  ContiguousArray<std::uint64_t> tree_offsets;
+  tree_offsets.PushBack(0);
+  for (auto const& tree_buffer : tree_buffers) {
+    tree_offsets.PushBack(tree_offsets.Back() + tree_buffer.size());
+  }
+
+  // The header, including the codec marker and the offset table, is never compressed
   auto mixin = std::make_shared<detail::serializer::StreamSerializerMixIn>(os);
-  detail::serializer::Serializer<detail::serializer::StreamSerializerMixIn> serializer{mixin};
+  detail::serializer::Serializer<detail::serializer::StreamSerializerMixIn> serializer{
+      mixin, /*include_tree_offsets=*/true, codec};
+  serializer.UsePrecomputedTreeOffsets(std::move(tree_offsets));
+  if (reserve_num_tree > 0) {
+    serializer.ReserveHeaderPadding(padding_len);
+  }
   serializer.SerializeHeader(*this);
-  serializer.SerializeTrees(*this);
+  for (auto const& tree_buffer : tree_buffers) {
+    os.write(tree_buffer.data(), static_cast<std::streamsize>(tree_buffer.size()));
+  }
+}
+
+void Model::AppendTreesToCheckpoint(std::string const& filename) {
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("serializer::append_checkpoint");
+  namespace ds = detail::serializer;
+  std::fstream fs(filename, std::ios::in | std::ios::out | std::ios::binary);
+  TREELITE_CHECK(fs) << "Could not open file " << filename;
+  fs.exceptions(std::ios::failbit | std::ios::badbit);  // Throw exception on failure
+
+  // Read the existing header, to learn where the tree section begins and how it is laid out
+  auto read_mixin = std::make_shared<ds::StreamDeserializerMixIn>(fs);
+  ds::Deserializer<ds::StreamDeserializerMixIn> header_reader{read_mixin};
+  std::unique_ptr<Model> existing = header_reader.DeserializeHeaderAndCreateModel();
+  Version const version = existing->GetVersion();
+  TREELITE_CHECK(version.major_ver == TREELITE_VER_MAJOR && version.minor_ver == TREELITE_VER_MINOR
+                 && version.patch_ver == TREELITE_VER_PATCH)
+      << "Can only append to a checkpoint written by the running Treelite version. "
+      << "The checkpoint was written by version " << version.major_ver << "."
+      << version.minor_ver << "." << version.patch_ver;
+  TREELITE_CHECK(existing->GetThresholdType() == GetThresholdType()
+                 && existing->GetLeafOutputType() == GetLeafOutputType())
+      << "Cannot append: the checkpoint holds a model with different value types";
+  auto const& old_tree_offsets = header_reader.TreeOffsets();
+  TREELITE_CHECK(
+      !old_tree_offsets.Empty() && old_tree_offsets.Size() == existing->num_tree_ + 1)
+      << "Cannot append to a checkpoint without a tree offset table";
+  std::uint64_t const tree_begin = existing->num_tree_;
+  std::uint64_t const num_tree = GetNumTree();
+  TREELITE_CHECK_LE(tree_begin, num_tree)
+      << "The checkpoint holds more trees than this model; it cannot be a prefix of it";
+  if (tree_begin == num_tree) {
+    return;  // the checkpoint is already up to date
+  }
+  auto const tree_section_begin = static_cast<std::uint64_t>(fs.tellg());
+  Codec const codec = header_reader.GetCodec();
+
+  // Encode only the new trees, in parallel
+  std::vector<std::vector<char>> tree_buffers(num_tree - tree_begin);
+  std::visit(
+      [&](auto&& concrete_model) {
+        namespace tu = detail::threading_utils;
+        auto thread_config = tu::ThreadConfig{0};  // use all available threads
+        tu::ParallelFor(tree_begin, num_tree, thread_config, tu::ParallelSchedule::Static(),
+            [&](std::uint64_t tree_id, int) {
+              auto& tree_buffer = tree_buffers[tree_id - tree_begin];
+              if (codec == Codec::kUncompressed) {
+                auto counter = std::make_shared<ds::CountingSerializerMixIn>();
+                ds::Serializer<ds::CountingSerializerMixIn> tree_counter{counter};
+                tree_counter.SerializeTree(concrete_model.trees[tree_id]);
+                tree_buffer.resize(counter->GetByteCount());
+                auto tree_mixin = std::make_shared<ds::BufferSerializerMixIn>(
+                    tree_buffer.data(), tree_buffer.size());
+                ds::Serializer<ds::BufferSerializerMixIn> tree_serializer{tree_mixin};
+                tree_serializer.SerializeTree(concrete_model.trees[tree_id]);
+              } else {
+                auto tree_mixin
+                    = std::make_shared<ds::CompressedVectorSerializerMixIn>(tree_buffer, codec);
+                ds::Serializer<ds::CompressedVectorSerializerMixIn> tree_serializer{tree_mixin};
+                tree_serializer.SerializeTree(concrete_model.trees[tree_id]);
+              }
+            });
+      },
+      variant_);
+  ContiguousArray<std::uint64_t> tree_offsets = old_tree_offsets.Clone();
+  std::uint64_t const old_tree_section_size = tree_offsets.Back();
+  for (auto const& tree_buffer : tree_buffers) {
+    tree_offsets.PushBack(tree_offsets.Back() + tree_buffer.size());
+  }
+
+  // The grown header must land exactly on the original header span; the difference is
+  // absorbed by shrinking the padding field reserved at serialization time
+  auto const count_header = [&](bool with_padding) {
+    auto counter = std::make_shared<ds::CountingSerializerMixIn>();
+    ds::Serializer<ds::CountingSerializerMixIn> header_counter{
+        counter, /*include_tree_offsets=*/true, codec};
+    header_counter.UsePrecomputedTreeOffsets(tree_offsets.Clone());
+    if (with_padding) {
+      header_counter.ReserveHeaderPadding(0);
+    }
+    header_counter.SerializeHeader(*this);
+    return counter->GetByteCount();
+  };
+  std::uint64_t padding_len = 0;
+  bool with_padding = false;
+  if (count_header(/*with_padding=*/false) != tree_section_begin) {
+    std::uint64_t const size_with_empty_padding = count_header(/*with_padding=*/true);
+    TREELITE_CHECK_GE(tree_section_begin, size_with_empty_padding)
+        << "The checkpoint has no reserved header capacity left for " << (num_tree - tree_begin)
+        << " more trees. Re-serialize it with a larger reserve_num_tree.";
+    padding_len = tree_section_begin - size_with_empty_padding;
+    with_padding = true;
+  }
+
+  // Append the new tree records, then rewrite the header in place
+  fs.seekp(static_cast<std::streamoff>(tree_section_begin + old_tree_section_size));
+  for (auto const& tree_buffer : tree_buffers) {
+    fs.write(tree_buffer.data(), static_cast<std::streamsize>(tree_buffer.size()));
+  }
+  fs.seekp(0);
+  auto write_mixin = std::make_shared<ds::StreamSerializerMixIn>(fs);
+  ds::Serializer<ds::StreamSerializerMixIn> header_writer{
+      write_mixin, /*include_tree_offsets=*/true, codec};
+  header_writer.UsePrecomputedTreeOffsets(std::move(tree_offsets));
+  if (with_padding) {
+    header_writer.ReserveHeaderPadding(padding_len);
+  }
+  header_writer.SerializeHeader(*this);
+  TREELITE_CHECK_EQ(static_cast<std::uint64_t>(fs.tellp()), tree_section_begin)
+      << "The rewritten header did not fill the original header span exactly";
 }
 
-std::unique_ptr<Model> Model::DeserializeFromStream(std::istream& is) {
+std::unique_ptr<Model> Model::DeserializeFromStream(std::istream& is, bool skip_node_stats) {
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("serializer::deserialize_stream");
   auto mixin = std::make_shared<detail::serializer::StreamDeserializerMixIn>(is);
-  detail::serializer::Deserializer<detail::serializer::StreamDeserializerMixIn> deserializer{mixin};
+  detail::serializer::Deserializer<detail::serializer::StreamDeserializerMixIn> deserializer{
+      mixin, skip_node_stats};
   std::unique_ptr<Model> model = deserializer.DeserializeHeaderAndCreateModel();
-  deserializer.DeserializeTrees(*model);
+  auto const& tree_offsets = deserializer.TreeOffsets();
+  if (!tree_offsets.Empty() && tree_offsets.Size() == model->num_tree_ + 1) {
+    // Bulk-read the tree section, then partition the trees across threads for decoding
+    // (and decompressing, if the checkpoint is compressed). The tree arrays are serviced
+    // from a model-owned arena, so trees end up packed into few large slabs instead of
+    // tens of thousands of individual mallocs.
+    std::uint64_t const nbytes = tree_offsets[model->num_tree_];
+    std::vector<char> buffer(nbytes);
+    is.read(buffer.data(), static_cast<std::streamsize>(nbytes));
+    auto arena = std::make_shared<detail::Arena>();
+    if (deserializer.GetCodec() == Codec::kUncompressed) {
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::MemoryBufferDeserializerMixIn>(
+          *model, buffer.data(), tree_offsets, skip_node_stats, arena.get());
+    } else {
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::CompressedBufferDeserializerMixIn>(
+          *model, buffer.data(), tree_offsets, skip_node_stats, arena.get());
+    }
+    // Keep the arena alive for as long as the model; the tree arrays point into it
+    model->arena_ = std::move(arena);
+  } else {
+    TREELITE_CHECK(deserializer.GetCodec() == Codec::kUncompressed)
+        << "Compressed checkpoint is missing its tree offset table";
+    deserializer.DeserializeTrees(*model);
+  }
   return model;
 }
 
+std::unique_ptr<Model> Model::DeserializeFromMappedFile(std::string const& filename) {
+  trace::BeginCall();
+  TREELITE_TRACE_SCOPE("serializer::deserialize_mapped_file");
+  auto mapped_file = std::make_shared<detail::MappedFile>(filename);
+  auto mixin = std::make_shared<detail::serializer::MappedFileDeserializerMixIn>(
+      mapped_file->Data(), mapped_file->Size());
+  detail::serializer::Deserializer<detail::serializer::MappedFileDeserializerMixIn> deserializer{
+      mixin};
+  std::unique_ptr<Model> model = deserializer.DeserializeHeaderAndCreateModel();
+  auto const& tree_offsets = deserializer.TreeOffsets();
+  if (!tree_offsets.Empty() && tree_offsets.Size() == model->num_tree_ + 1) {
+    // The mapping is randomly accessible; decode the trees in parallel, in place
+    char* tree_section = static_cast<char*>(mapped_file->Data()) + mixin->Tell();
+    if (deserializer.GetCodec() == Codec::kUncompressed) {
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::MappedFileDeserializerMixIn>(*model, tree_section, tree_offsets);
+    } else {
+      // Compressed array frames cannot be referenced in place; decompress into an arena
+      auto arena = std::make_shared<detail::Arena>();
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::CompressedBufferDeserializerMixIn>(
+          *model, tree_section, tree_offsets, /*skip_node_stats=*/false, arena.get());
+      model->arena_ = std::move(arena);
+    }
+  } else {
+    TREELITE_CHECK(deserializer.GetCodec() == Codec::kUncompressed)
+        << "Compressed checkpoint is missing its tree offset table";
+    deserializer.DeserializeTrees(*model);
+  }
+  // Keep the mapping alive for as long as the model; the node arrays point into it
+  model->mapped_file_ = std::move(mapped_file);
+  return model;
+}
+
+void Model::SerializeToSharedMemory(std::string const& name) {
+  // The region cannot be created before its exact size is known; serialize into a
+  // temporary buffer first, then copy the bytes into the region
+  std::ostringstream oss;
+  oss.exceptions(std::ios::failbit | std::ios::badbit);  // Throw exception on failure
+  SerializeToStream(oss);
+  std::string const bytes = oss.str();
+  auto region = std::make_shared<detail::SharedMemoryRegion>(name, bytes.size());
+  std::memcpy(region->Data(), bytes.data(), bytes.size());
+  // Keep the region open for as long as the publishing model; on Windows a named section
+  // vanishes once its last holder releases it
+  shm_region_ = std::move(region);
+}
+
+std::unique_ptr<Model> Model::AttachFromSharedMemory(std::string const& name) {
+  auto region = std::make_shared<detail::SharedMemoryRegion>(name);
+  auto mixin = std::make_shared<detail::serializer::MappedFileDeserializerMixIn>(
+      region->Data(), region->Size());
+  detail::serializer::Deserializer<detail::serializer::MappedFileDeserializerMixIn> deserializer{
+      mixin};
+  std::unique_ptr<Model> model = deserializer.DeserializeHeaderAndCreateModel();
+  auto const& tree_offsets = deserializer.TreeOffsets();
+  if (!tree_offsets.Empty() && tree_offsets.Size() == model->num_tree_ + 1) {
+    // The region is randomly accessible; decode the trees in parallel, in place
+    char* tree_section = static_cast<char*>(region->Data()) + mixin->Tell();
+    if (deserializer.GetCodec() == Codec::kUncompressed) {
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::MappedFileDeserializerMixIn>(*model, tree_section, tree_offsets);
+    } else {
+      // Compressed array frames cannot be referenced in place; decompress into an arena
+      auto arena = std::make_shared<detail::Arena>();
+      detail::serializer::DeserializeTreesInParallel<
+          detail::serializer::CompressedBufferDeserializerMixIn>(
+          *model, tree_section, tree_offsets, /*skip_node_stats=*/false, arena.get());
+      model->arena_ = std::move(arena);
+    }
+  } else {
+    TREELITE_CHECK(deserializer.GetCodec() == Codec::kUncompressed)
+        << "Compressed checkpoint is missing its tree offset table";
+    deserializer.DeserializeTrees(*model);
+  }
+  // Keep the region alive for as long as the model; the node arrays point into it
+  model->shm_region_ = std::move(region);
+  return model;
+}
+
+void Model::RemoveSharedMemory(std::string const& name) {
+  detail::SharedMemoryRegion::Remove(name);
+}
+
+ModelReader::ModelReader(std::string const& filename)
+    : mapped_file_{std::make_shared<detail::MappedFile>(filename)} {
+  auto mixin = std::make_shared<detail::serializer::MappedFileDeserializerMixIn>(
+      mapped_file_->Data(), mapped_file_->Size());
+  detail::serializer::Deserializer<detail::serializer::MappedFileDeserializerMixIn> deserializer{
+      mixin};
+  std::unique_ptr<Model> model = deserializer.DeserializeHeaderAndCreateModel();
+  auto const& tree_offsets = deserializer.TreeOffsets();
+  TREELITE_CHECK(!tree_offsets.Empty() && tree_offsets.Size() == model->num_tree_ + 1)
+      << "ModelReader requires a checkpoint with a tree offset table. "
+      << "Re-serialize the model with Treelite version " << TREELITE_VER_MAJOR << "."
+      << TREELITE_VER_MINOR << "." << TREELITE_VER_PATCH << " or later.";
+  num_tree_ = model->num_tree_;
+  tree_offsets_ = tree_offsets.Clone();  // the deserializer's copy dies with this scope
+  tree_section_begin_ = mixin->Tell();
+  codec_ = deserializer.GetCodec();
+}
+
+std::unique_ptr<Model> ModelReader::LoadModel(std::uint64_t tree_limit) {
+  TREELITE_CHECK_LE(tree_limit, num_tree_)
+      << "tree_limit cannot exceed the number of trees in the file";
+  auto mixin = std::make_shared<detail::serializer::MappedFileDeserializerMixIn>(
+      mapped_file_->Data(), mapped_file_->Size());
+  detail::serializer::Deserializer<detail::serializer::MappedFileDeserializerMixIn> deserializer{
+      mixin};
+  std::unique_ptr<Model> model = deserializer.DeserializeHeaderAndCreateModel();
+  char* tree_section = static_cast<char*>(mapped_file_->Data()) + tree_section_begin_;
+  if (codec_ == Codec::kUncompressed) {
+    detail::serializer::DeserializeTreeRangeInParallel<
+        detail::serializer::MappedFileDeserializerMixIn>(
+        *model, tree_section, tree_offsets_, 0, tree_limit);
+  } else {
+    // Compressed array frames cannot be referenced in place; decompress into an arena
+    auto arena = std::make_shared<detail::Arena>();
+    detail::serializer::DeserializeTreeRangeInParallel<
+        detail::serializer::CompressedBufferDeserializerMixIn>(
+        *model, tree_section, tree_offsets_, 0, tree_limit, /*skip_node_stats=*/false,
+        arena.get());
+    model->arena_ = std::move(arena);
+  }
+  model->mapped_file_ = mapped_file_;
+  return model;
+}
+
+void ModelReader::ExtendModel(Model& model, std::uint64_t tree_limit) {
+  TREELITE_CHECK(model.mapped_file_ == mapped_file_)
+      << "The model was not loaded by this ModelReader";
+  TREELITE_CHECK_LE(tree_limit, num_tree_)
+      << "tree_limit cannot exceed the number of trees in the file";
+  std::uint64_t const num_tree_loaded = model.GetNumTree();
+  if (tree_limit <= num_tree_loaded) {
+    return;  // already materialized
+  }
+  char* tree_section = static_cast<char*>(mapped_file_->Data()) + tree_section_begin_;
+  if (codec_ == Codec::kUncompressed) {
+    detail::serializer::DeserializeTreeRangeInParallel<
+        detail::serializer::MappedFileDeserializerMixIn>(
+        model, tree_section, tree_offsets_, num_tree_loaded, tree_limit);
+  } else {
+    if (!model.arena_) {
+      model.arena_ = std::make_shared<detail::Arena>();
+    }
+    detail::serializer::DeserializeTreeRangeInParallel<
+        detail::serializer::CompressedBufferDeserializerMixIn>(
+        model, tree_section, tree_offsets_, num_tree_loaded, tree_limit,
+        /*skip_node_stats=*/false, model.arena_.get());
+  }
+}
+
 }  // namespace treelite
@@ -0,0 +1,69 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file trace.cc
+ * \author Hyunsu Cho
+ * \brief Phase-level tracing facility
+ */
+#include <treelite/thread_local.h>
+#include <treelite/trace.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace treelite::trace {
+
+namespace {
+
+std::atomic<bool> tracing_enabled{false};
+
+/* Each thread accumulates into its own report, so concurrent predictions from different
+ * threads do not interleave; the report is looked up by the phase label pointer-or-content.
+ * The handful of phases makes a linear scan cheaper than a hash map. */
+struct TraceReport {
+  std::vector<PhaseStat> stats;
+};
+using TraceReportStore = ThreadLocalStore<TraceReport>;
+
+}  // anonymous namespace
+
+void EnableTracing(bool enable) {
+  tracing_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool TracingEnabled() {
+  return tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void NewReport() {
+  TraceReportStore::Get()->stats.clear();
+}
+
+std::vector<PhaseStat> GetReport() {
+  return TraceReportStore::Get()->stats;
+}
+
+ScopedTimer::ScopedTimer(char const* phase) : phase_{phase}, active_{TracingEnabled()} {
+  if (active_) {
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+ScopedTimer::~ScopedTimer() {
+  if (!active_) {
+    return;
+  }
+  double const elapsed_sec
+      = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+  auto& stats = TraceReportStore::Get()->stats;
+  for (auto& stat : stats) {
+    if (stat.phase == phase_) {
+      ++stat.num_invocation;
+      stat.total_sec += elapsed_sec;
+      return;
+    }
+  }
+  stats.push_back(PhaseStat{phase_, 1, elapsed_sec});
+}
+
+}  // namespace treelite::trace
@@ -0,0 +1,111 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file warmup.cc
+ * \brief Pre-fault the memory backing a model, so that the first predictions after a load
+ *        run at steady-state speed
+ * \author Hyunsu Cho
+ */
+
+#include <treelite/contiguous_array.h>
+#include <treelite/detail/mmap_file.h>
+#include <treelite/detail/shm_region.h>
+#include <treelite/tree.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+
+namespace {
+
+// Conservative lower bound; touching at this granularity also covers larger pages
+constexpr std::size_t kPageSize = 4096;
+
+/*! \brief Read one byte per page, accumulating into sink so the loads cannot be elided */
+void TouchPages(void const* data, std::size_t nbytes, unsigned char& sink) {
+  auto const* bytes = static_cast<unsigned char const*>(data);
+  for (std::size_t i = 0; i < nbytes; i += kPageSize) {
+    sink ^= bytes[i];
+  }
+  if (nbytes > 0) {
+    sink ^= bytes[nbytes - 1];
+  }
+}
+
+template <typename T>
+void TouchArray(treelite::ContiguousArray<T> const& array, unsigned char& sink) {
+  TouchPages(array.Data(), array.Size() * sizeof(T), sink);
+}
+
+/*!
+ * \brief Advise the kernel to read the whole region ahead, so that page faulting overlaps
+ *        with I/O instead of stalling one page at a time. Best-effort; a no-op where
+ *        unsupported.
+ */
+void AdviseWillNeed(void* data, std::size_t nbytes) {
+#if !defined(_WIN32)
+  if (nbytes > 0) {
+    // madvise requires a page-aligned address; align down and widen accordingly
+    auto const addr = reinterpret_cast<std::uintptr_t>(data);
+    auto const aligned = addr & ~static_cast<std::uintptr_t>(kPageSize - 1);
+    madvise(reinterpret_cast<void*>(aligned), nbytes + (addr - aligned), MADV_WILLNEED);
+  }
+#else
+  (void) data;
+  (void) nbytes;
+#endif
+}
+
+}  // anonymous namespace
+
+namespace treelite {
+
+template <typename ThresholdType, typename LeafOutputType>
+void WarmupTree(Tree<ThresholdType, LeafOutputType> const& tree, unsigned char& sink) {
+  TouchArray(tree.node_type_, sink);
+  TouchArray(tree.cleft_, sink);
+  TouchArray(tree.cright_, sink);
+  TouchArray(tree.split_index_, sink);
+  TouchArray(tree.default_left_, sink);
+  TouchArray(tree.leaf_value_, sink);
+  TouchArray(tree.threshold_, sink);
+  TouchArray(tree.cmp_, sink);
+  TouchArray(tree.category_list_right_child_, sink);
+  TouchArray(tree.leaf_vector_, sink);
+  TouchArray(tree.leaf_vector_begin_, sink);
+  TouchArray(tree.leaf_vector_end_, sink);
+  TouchArray(tree.category_list_, sink);
+  TouchArray(tree.category_list_begin_, sink);
+  TouchArray(tree.category_list_end_, sink);
+  // The node-statistics arrays are deliberately left cold: inference never reads them,
+  // and faulting them in would evict pages that matter
+}
+
+void Model::Warmup() const {
+  // Hint the kernel first, so read-ahead runs while the pages are touched in order.
+  // The tree arrays point into these regions (or into the arena, whose slabs the per-array
+  // touching below covers), so one pass over the arrays faults in every backing kind.
+  if (mapped_file_) {
+    AdviseWillNeed(mapped_file_->Data(), mapped_file_->Size());
+  }
+  if (shm_region_) {
+    AdviseWillNeed(shm_region_->Data(), shm_region_->Size());
+  }
+  unsigned char sink = 0;
+  TouchArray(num_class, sink);
+  TouchArray(leaf_vector_shape, sink);
+  TouchArray(target_id, sink);
+  TouchArray(class_id, sink);
+  TouchArray(base_scores, sink);
+  std::visit(
+      [&](auto&& concrete_model) {
+        for (auto const& tree : concrete_model.trees) {
+          WarmupTree(tree, sink);
+        }
+      },
+      variant_);
+  // Publish the accumulated byte, so the compiler cannot discard the page reads
+  volatile unsigned char sink_out = sink;
+  (void) sink_out;
+}
+
+}  // namespace treelite
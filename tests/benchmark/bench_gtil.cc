@@ -0,0 +1,145 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file bench_gtil.cc
+ * \author Hyunsu Cho
+ * \brief Microbenchmarks for GTIL prediction
+ */
+#include <benchmark/benchmark.h>
+#include <treelite/detail/threading_utils.h>
+#include <treelite/gtil.h>
+#include <treelite/tree.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "./generate_model.h"
+
+namespace treelite {
+
+namespace {
+
+std::size_t OutputSize(std::vector<std::uint64_t> const& output_shape) {
+  return std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+}
+
+void RunPredict(benchmark::State& state, bench::ModelSpec const& spec,
+    gtil::Configuration const& config, std::uint64_t num_row) {
+  auto model = bench::GenerateModel(spec);
+  auto input = bench::GenerateInput(num_row, spec.num_feature);
+  std::vector<double> output(OutputSize(gtil::GetOutputShape(*model, num_row, config)));
+  for (auto _ : state) {
+    gtil::Predict(*model, input.data(), num_row, output.data(), config);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.counters["rows_per_sec"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * num_row), benchmark::Counter::kIsRate);
+}
+
+/* Ensemble size and batch size sweep */
+void BM_PredictDense(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = static_cast<std::int32_t>(state.range(0));
+  spec.depth = static_cast<int>(state.range(1));
+  gtil::Configuration config;
+  config.nthread = 1;
+  RunPredict(state, spec, config, static_cast<std::uint64_t>(state.range(2)));
+}
+BENCHMARK(BM_PredictDense)
+    ->ArgNames({"trees", "depth", "rows"})
+    ->ArgsProduct({{16, 256, 1024}, {3, 6, 10}, {1, 64, 4096}});
+
+/* All four prediction kinds on a fixed model */
+void BM_PredictKind(benchmark::State& state) {
+  bench::ModelSpec spec;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = static_cast<gtil::PredictKind>(state.range(0));
+  RunPredict(state, spec, config, 1024);
+}
+BENCHMARK(BM_PredictKind)->ArgName("kind")->DenseRange(0, 3);
+
+/* Categorical splits dilute the branchy numerical fast paths */
+void BM_PredictCategorical(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.categorical_fraction = static_cast<double>(state.range(0)) / 100.0;
+  gtil::Configuration config;
+  config.nthread = 1;
+  RunPredict(state, spec, config, 1024);
+}
+BENCHMARK(BM_PredictCategorical)->ArgName("cat_pct")->Arg(0)->Arg(25)->Arg(50);
+
+/* Leaf vector outputs (multi-class random forest style) */
+void BM_PredictMulticlass(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_class = static_cast<std::int32_t>(state.range(0));
+  gtil::Configuration config;
+  config.nthread = 1;
+  RunPredict(state, spec, config, 1024);
+}
+BENCHMARK(BM_PredictMulticlass)->ArgName("classes")->Arg(4)->Arg(16);
+
+/* Thread scaling; the requested count is clamped to what the machine offers */
+void BM_PredictThreads(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = 256;
+  gtil::Configuration config;
+  config.nthread = std::min(
+      static_cast<int>(state.range(0)), detail::threading_utils::MaxNumThread());
+  RunPredict(state, spec, config, 16384);
+}
+BENCHMARK(BM_PredictThreads)->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/* Compiled (flattened) engine, with and without quantized thresholds */
+void BM_PredictCompiled(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = 256;
+  auto model = bench::GenerateModel(spec);
+  gtil::CompiledModel compiled{*model, state.range(0) != 0};
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::uint64_t const num_row = 4096;
+  auto input = bench::GenerateInput(num_row, spec.num_feature);
+  std::vector<double> output(OutputSize(gtil::GetOutputShape(*model, num_row, config)));
+  for (auto _ : state) {
+    gtil::Predict(compiled, input.data(), num_row, output.data(), config);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.counters["rows_per_sec"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * num_row), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_PredictCompiled)->ArgName("quantize")->Arg(0)->Arg(1);
+
+/* Per-call overhead on small batches, with and without a reusable session */
+void BM_PredictSmallBatch(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = 16;
+  spec.depth = 3;
+  auto model = bench::GenerateModel(spec);
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::uint64_t const num_row = 1;
+  auto input = bench::GenerateInput(num_row, spec.num_feature);
+  std::vector<double> output(OutputSize(gtil::GetOutputShape(*model, num_row, config)));
+  if (state.range(0) != 0) {
+    gtil::PredictSession session{*model, config};
+    for (auto _ : state) {
+      session.Predict(input.data(), num_row, output.data());
+      benchmark::DoNotOptimize(output.data());
+    }
+  } else {
+    for (auto _ : state) {
+      gtil::Predict(*model, input.data(), num_row, output.data(), config);
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+}
+BENCHMARK(BM_PredictSmallBatch)->ArgName("session")->Arg(0)->Arg(1);
+
+}  // anonymous namespace
+
+}  // namespace treelite
@@ -0,0 +1,9 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file bench_main.cc
+ * \author Hyunsu Cho
+ * \brief Launcher for microbenchmarks, using Google Benchmark framework
+ */
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file bench_model_loader.cc
+ * \author Hyunsu Cho
+ * \brief Microbenchmarks for model loaders, with peak RSS and allocation-count counters
+ */
+#include <benchmark/benchmark.h>
+#include <treelite/model_loader.h>
+#include <treelite/tree.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "./generate_model_files.h"
+
+namespace {
+
+std::atomic<std::uint64_t> g_alloc_count{0};
+
+}  // anonymous namespace
+
+/* Replace the global allocator so the loader benchmarks can report allocations per parse.
+ * The counter covers the whole binary, so callers must measure deltas around the timed loop. */
+void* operator new(std::size_t size) {
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace treelite {
+
+namespace {
+
+bench::FileModelSpec SpecFromState(benchmark::State const& state) {
+  bench::FileModelSpec spec;
+  spec.num_tree = static_cast<std::int32_t>(state.range(0));
+  spec.depth = static_cast<int>(state.range(1));
+  spec.categorical_fraction = static_cast<double>(state.range(2)) / 100.0;
+  return spec;
+}
+
+void ReportLoaderCounters(
+    benchmark::State& state, std::uint64_t alloc_begin, std::size_t input_size) {
+  state.counters["allocs_per_parse"]
+      = static_cast<double>(g_alloc_count.load(std::memory_order_relaxed) - alloc_begin)
+        / static_cast<double>(state.iterations());
+  state.counters["bytes_per_sec"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * input_size), benchmark::Counter::kIsRate);
+#if !defined(_WIN32)
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+  state.counters["max_rss_mb"] = static_cast<double>(ru.ru_maxrss) / (1024.0 * 1024.0);
+#else
+  state.counters["max_rss_mb"] = static_cast<double>(ru.ru_maxrss) / 1024.0;
+#endif
+#endif
+}
+
+void BM_LoadLightGBMText(benchmark::State& state) {
+  std::string const model_str = bench::GenerateLightGBMText(SpecFromState(state));
+  std::uint64_t const alloc_begin = g_alloc_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    auto model = model_loader::LoadLightGBMModelFromString(model_str.c_str());
+    benchmark::DoNotOptimize(model);
+  }
+  ReportLoaderCounters(state, alloc_begin, model_str.size());
+}
+BENCHMARK(BM_LoadLightGBMText)
+    ->ArgNames({"trees", "depth", "cat_pct"})
+    ->Args({64, 6, 0})
+    ->Args({1024, 6, 0})
+    ->Args({256, 10, 0})
+    ->Args({256, 6, 20});
+
+void BM_LoadXGBoostJSON(benchmark::State& state) {
+  std::string const model_str = bench::GenerateXGBoostJSON(SpecFromState(state));
+  std::uint64_t const alloc_begin = g_alloc_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    auto model = model_loader::LoadXGBoostModelFromString(model_str.c_str(), model_str.size(), "{}");
+    benchmark::DoNotOptimize(model);
+  }
+  ReportLoaderCounters(state, alloc_begin, model_str.size());
+}
+BENCHMARK(BM_LoadXGBoostJSON)
+    ->ArgNames({"trees", "depth", "cat_pct"})
+    ->Args({64, 6, 0})
+    ->Args({1024, 6, 0})
+    ->Args({256, 10, 0})
+    ->Args({256, 6, 20});
+
+void BM_LoadXGBoostLegacyBinary(benchmark::State& state) {
+  std::string const model_bin = bench::GenerateXGBoostLegacyBinary(SpecFromState(state));
+  std::uint64_t const alloc_begin = g_alloc_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    auto model = model_loader::LoadXGBoostModelLegacyBinary(model_bin.data(), model_bin.size());
+    benchmark::DoNotOptimize(model);
+  }
+  ReportLoaderCounters(state, alloc_begin, model_bin.size());
+}
+BENCHMARK(BM_LoadXGBoostLegacyBinary)
+    ->ArgNames({"trees", "depth", "cat_pct"})
+    ->Args({64, 6, 0})
+    ->Args({1024, 6, 0})
+    ->Args({256, 10, 0});
+
+void BM_LoadSKLearnRandomForest(benchmark::State& state) {
+  bench::FileModelSpec const spec = SpecFromState(state);
+  bench::SKLearnArrays arrays = bench::GenerateSKLearnArrays(spec);
+  std::size_t input_size = 0;
+  for (std::int64_t const count : arrays.node_count) {
+    // 4 int64 + 4 double columns per node
+    input_size += static_cast<std::size_t>(count) * 8 * sizeof(double);
+  }
+  std::uint64_t const alloc_begin = g_alloc_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    auto model = model_loader::sklearn::LoadRandomForestRegressor(spec.num_tree, spec.num_feature,
+        1, arrays.node_count.data(), arrays.children_left_ptr.data(),
+        arrays.children_right_ptr.data(), arrays.feature_ptr.data(), arrays.threshold_ptr.data(),
+        arrays.value_ptr.data(), arrays.n_node_samples_ptr.data(),
+        arrays.weighted_n_node_samples_ptr.data(), arrays.impurity_ptr.data());
+    benchmark::DoNotOptimize(model);
+  }
+  ReportLoaderCounters(state, alloc_begin, input_size);
+}
+BENCHMARK(BM_LoadSKLearnRandomForest)
+    ->ArgNames({"trees", "depth", "cat_pct"})
+    ->Args({64, 6, 0})
+    ->Args({1024, 6, 0})
+    ->Args({256, 10, 0});
+
+}  // anonymous namespace
+
+}  // namespace treelite
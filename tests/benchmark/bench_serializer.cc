@@ -0,0 +1,64 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file bench_serializer.cc
+ * \author Hyunsu Cho
+ * \brief Microbenchmarks for model serialization
+ */
+#include <benchmark/benchmark.h>
+#include <treelite/tree.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "./generate_model.h"
+
+namespace treelite {
+
+namespace {
+
+void BM_SerializeToStream(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = static_cast<std::int32_t>(state.range(0));
+  auto model = bench::GenerateModel(spec);
+  for (auto _ : state) {
+    std::ostringstream oss;
+    model->SerializeToStream(oss);
+    benchmark::DoNotOptimize(oss);
+  }
+}
+BENCHMARK(BM_SerializeToStream)->ArgName("trees")->Arg(16)->Arg(256)->Arg(1024);
+
+void BM_DeserializeFromStream(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = static_cast<std::int32_t>(state.range(0));
+  auto model = bench::GenerateModel(spec);
+  std::ostringstream oss;
+  model->SerializeToStream(oss);
+  std::string const buffer = oss.str();
+  for (auto _ : state) {
+    std::istringstream iss(buffer);
+    auto deserialized = Model::DeserializeFromStream(iss);
+    benchmark::DoNotOptimize(deserialized);
+  }
+  state.counters["bytes_per_sec"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * buffer.size()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_DeserializeFromStream)->ArgName("trees")->Arg(16)->Arg(256)->Arg(1024);
+
+void BM_SerializeRoundTrip(benchmark::State& state) {
+  bench::ModelSpec spec;
+  spec.num_tree = static_cast<std::int32_t>(state.range(0));
+  auto model = bench::GenerateModel(spec);
+  for (auto _ : state) {
+    std::stringstream ss;
+    model->SerializeToStream(ss);
+    auto deserialized = Model::DeserializeFromStream(ss);
+    benchmark::DoNotOptimize(deserialized);
+  }
+}
+BENCHMARK(BM_SerializeRoundTrip)->ArgName("trees")->Arg(16)->Arg(256);
+
+}  // anonymous namespace
+
+}  // namespace treelite
@@ -0,0 +1,101 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file generate_model.h
+ * \author Hyunsu Cho
+ * \brief Synthetic tree ensembles and inputs for the microbenchmark suite
+ */
+#ifndef TESTS_BENCHMARK_GENERATE_MODEL_H_
+#define TESTS_BENCHMARK_GENERATE_MODEL_H_
+
+#include <treelite/enum/operator.h>
+#include <treelite/enum/task_type.h>
+#include <treelite/enum/typeinfo.h>
+#include <treelite/model_builder.h>
+#include <treelite/tree.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace treelite::bench {
+
+/*! \brief Shape of a synthetic ensemble */
+struct ModelSpec {
+  std::int32_t num_tree{100};
+  /*! \brief Depth of each (complete) tree */
+  int depth{6};
+  std::int32_t num_feature{32};
+  /*! \brief Fraction of test nodes that carry a categorical test */
+  double categorical_fraction{0.0};
+  /*! \brief Number of classes; > 1 emits leaf vectors and softmax post-processing */
+  std::int32_t num_class{1};
+};
+
+/*!
+ * \brief Generate a deterministic random ensemble of complete trees with the given shape,
+ *        so that benchmark runs are comparable across builds.
+ */
+inline std::unique_ptr<Model> GenerateModel(ModelSpec const& spec) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+  std::uniform_int_distribution<std::int32_t> feature_dist(0, spec.num_feature - 1);
+  std::bernoulli_distribution categorical_dist(spec.categorical_fraction);
+  bool const multiclass = spec.num_class > 1;
+  model_builder::Metadata metadata{spec.num_feature,
+      multiclass ? TaskType::kMultiClf : TaskType::kRegressor, false, 1, {spec.num_class},
+      {1, multiclass ? spec.num_class : 1}};
+  model_builder::TreeAnnotation tree_annotation{spec.num_tree,
+      std::vector<std::int32_t>(spec.num_tree, 0), std::vector<std::int32_t>(spec.num_tree, -1)};
+  model_builder::PostProcessorFunc postprocessor{multiclass ? "softmax" : "identity"};
+  std::vector<double> base_scores(multiclass ? spec.num_class : 1, 0.0);
+  std::unique_ptr<model_builder::ModelBuilder> builder = model_builder::GetModelBuilder(
+      TypeInfo::kFloat64, TypeInfo::kFloat64, metadata, tree_annotation, postprocessor,
+      base_scores);
+  int const num_internal = (1 << spec.depth) - 1;
+  int const num_nodes = (1 << (spec.depth + 1)) - 1;
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    builder->StartTree();
+    for (int nid = 0; nid < num_nodes; ++nid) {
+      builder->StartNode(nid);
+      if (nid < num_internal) {
+        if (categorical_dist(rng)) {
+          builder->CategoricalTest(
+              feature_dist(rng), true, {0, 2, 5}, false, 2 * nid + 1, 2 * nid + 2);
+        } else {
+          builder->NumericalTest(feature_dist(rng), value_dist(rng), true, Operator::kLT,
+              2 * nid + 1, 2 * nid + 2);
+        }
+      } else if (multiclass) {
+        std::vector<double> leaf_vector(spec.num_class);
+        for (double& e : leaf_vector) {
+          e = value_dist(rng);
+        }
+        builder->LeafVector(leaf_vector);
+      } else {
+        builder->LeafScalar(value_dist(rng));
+      }
+      builder->EndNode();
+    }
+    builder->EndTree();
+  }
+  return builder->CommitModel();
+}
+
+/*! \brief Generate a deterministic dense input batch, with a share of missing values */
+inline std::vector<double> GenerateInput(
+    std::uint64_t num_row, std::int32_t num_feature, double missing_fraction = 0.05) {
+  std::mt19937 rng(2023);
+  std::uniform_real_distribution<double> value_dist(-1.5, 1.5);
+  std::bernoulli_distribution missing_dist(missing_fraction);
+  std::vector<double> input(num_row * num_feature);
+  for (double& e : input) {
+    e = missing_dist(rng) ? std::numeric_limits<double>::quiet_NaN() : value_dist(rng);
+  }
+  return input;
+}
+
+}  // namespace treelite::bench
+
+#endif  // TESTS_BENCHMARK_GENERATE_MODEL_H_
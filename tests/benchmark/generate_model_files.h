@@ -0,0 +1,391 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file generate_model_files.h
+ * \author Hyunsu Cho
+ * \brief Synthetic model files in external formats, for the loader benchmark suite
+ */
+#ifndef TESTS_BENCHMARK_GENERATE_MODEL_FILES_H_
+#define TESTS_BENCHMARK_GENERATE_MODEL_FILES_H_
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace treelite::bench {
+
+/*! \brief Shape of a synthetic model file. All generated trees are complete binary trees. */
+struct FileModelSpec {
+  std::int32_t num_tree{100};
+  /*! \brief Depth of each (complete) tree */
+  int depth{6};
+  std::int32_t num_feature{32};
+  /*! \brief Fraction of test nodes that carry a categorical test (where the format allows) */
+  double categorical_fraction{0.0};
+};
+
+namespace detail {
+
+template <typename T>
+inline void WriteSpaceSeparated(std::ostringstream& os, char const* name,
+    std::vector<T> const& values) {
+  os << name << "=";
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) {
+      os << " ";
+    }
+    os << values[i];
+  }
+  os << "\n";
+}
+
+template <typename T>
+inline void WriteJSONArray(std::ostringstream& os, std::vector<T> const& values) {
+  os << "[";
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) {
+      os << ",";
+    }
+    os << values[i];
+  }
+  os << "]";
+}
+
+}  // namespace detail
+
+/*! \brief Generate a LightGBM text model (regression objective) with the given shape */
+inline std::string GenerateLightGBMText(FileModelSpec const& spec) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+  std::uniform_int_distribution<int> feature_dist(0, spec.num_feature - 1);
+  std::bernoulli_distribution categorical_dist(spec.categorical_fraction);
+  int const num_leaves = 1 << spec.depth;
+  int const num_internal = num_leaves - 1;
+  std::ostringstream os;
+  os << "tree\n"
+     << "version=v3\n"
+     << "num_class=1\n"
+     << "num_tree_per_iteration=1\n"
+     << "label_index=0\n"
+     << "max_feature_idx=" << (spec.num_feature - 1) << "\n"
+     << "objective=regression\n"
+     << "\n";
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    std::vector<int> split_feature(num_internal), decision_type(num_internal);
+    std::vector<int> left_child(num_internal), right_child(num_internal);
+    std::vector<double> threshold(num_internal), leaf_value(num_leaves);
+    std::vector<float> split_gain(num_internal);
+    std::vector<std::uint64_t> cat_boundaries{0};
+    std::vector<std::uint32_t> cat_threshold;
+    int num_cat = 0;
+    for (int nid = 0; nid < num_internal; ++nid) {
+      split_feature[nid] = feature_dist(rng);
+      split_gain[nid] = 1.0f;
+      // Internal nodes occupy [0, num_internal); child c is a leaf iff c >= num_internal,
+      // and leaf k is encoded as ~k per the LightGBM convention
+      int const cleft = 2 * nid + 1;
+      int const cright = 2 * nid + 2;
+      left_child[nid] = (cleft < num_internal) ? cleft : ~(cleft - num_internal);
+      right_child[nid] = (cright < num_internal) ? cright : ~(cright - num_internal);
+      if (categorical_dist(rng)) {
+        decision_type[nid] = 1;  // categorical test
+        threshold[nid] = num_cat;  // index into cat_boundaries
+        cat_threshold.push_back(0x15);  // categories {0, 2, 4} go left
+        cat_boundaries.push_back(cat_boundaries.back() + 1);
+        ++num_cat;
+      } else {
+        decision_type[nid] = 2;  // numerical test, default left
+        threshold[nid] = value_dist(rng);
+      }
+    }
+    for (double& e : leaf_value) {
+      e = value_dist(rng);
+    }
+    os << "Tree=" << tree_id << "\n"
+       << "num_leaves=" << num_leaves << "\n"
+       << "num_cat=" << num_cat << "\n";
+    detail::WriteSpaceSeparated(os, "split_feature", split_feature);
+    detail::WriteSpaceSeparated(os, "split_gain", split_gain);
+    detail::WriteSpaceSeparated(os, "threshold", threshold);
+    detail::WriteSpaceSeparated(os, "decision_type", decision_type);
+    if (num_cat > 0) {
+      detail::WriteSpaceSeparated(os, "cat_boundaries", cat_boundaries);
+      detail::WriteSpaceSeparated(os, "cat_threshold", cat_threshold);
+    }
+    detail::WriteSpaceSeparated(os, "left_child", left_child);
+    detail::WriteSpaceSeparated(os, "right_child", right_child);
+    detail::WriteSpaceSeparated(os, "leaf_value", leaf_value);
+    os << "\n";
+  }
+  os << "end of trees\n";
+  return os.str();
+}
+
+/*! \brief Generate an XGBoost JSON model (reg:squarederror objective) with the given shape */
+inline std::string GenerateXGBoostJSON(FileModelSpec const& spec) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> value_dist(-1.0f, 1.0f);
+  std::uniform_int_distribution<int> feature_dist(0, spec.num_feature - 1);
+  std::bernoulli_distribution categorical_dist(spec.categorical_fraction);
+  int const num_internal = (1 << spec.depth) - 1;
+  int const num_nodes = (1 << (spec.depth + 1)) - 1;
+  std::ostringstream os;
+  os << "{\"learner\":{\"attributes\":{},\"gradient_booster\":{\"model\":{"
+     << "\"gbtree_model_param\":{\"num_trees\":\"" << spec.num_tree << "\"},\"tree_info\":";
+  detail::WriteJSONArray(os, std::vector<int>(spec.num_tree, 0));
+  os << ",\"trees\":[";
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    std::vector<float> base_weights(num_nodes), loss_changes(num_nodes),
+        split_conditions(num_nodes), sum_hessian(num_nodes);
+    std::vector<int> left_children(num_nodes), right_children(num_nodes), parents(num_nodes),
+        split_indices(num_nodes), split_type(num_nodes), default_left(num_nodes);
+    std::vector<int> categories, categories_nodes, categories_segments, categories_sizes;
+    for (int nid = 0; nid < num_nodes; ++nid) {
+      base_weights[nid] = value_dist(rng);
+      sum_hessian[nid] = 1.0f;
+      parents[nid] = (nid == 0) ? 2147483647 : (nid - 1) / 2;
+      if (nid < num_internal) {
+        left_children[nid] = 2 * nid + 1;
+        right_children[nid] = 2 * nid + 2;
+        split_indices[nid] = feature_dist(rng);
+        loss_changes[nid] = 1.0f;
+        default_left[nid] = 1;
+        if (categorical_dist(rng)) {
+          split_type[nid] = 1;  // categorical test
+          categories_nodes.push_back(nid);
+          categories_segments.push_back(static_cast<int>(categories.size()));
+          categories_sizes.push_back(3);
+          categories.push_back(0);
+          categories.push_back(2);
+          categories.push_back(4);
+        } else {
+          split_type[nid] = 0;  // numerical test
+          split_conditions[nid] = value_dist(rng);
+        }
+      } else {
+        left_children[nid] = -1;
+        right_children[nid] = -1;
+        split_indices[nid] = 0;
+        loss_changes[nid] = 0.0f;
+        default_left[nid] = 0;
+        split_type[nid] = 0;
+        split_conditions[nid] = value_dist(rng);  // leaf output
+      }
+    }
+    if (tree_id > 0) {
+      os << ",";
+    }
+    os << "{\"base_weights\":";
+    detail::WriteJSONArray(os, base_weights);
+    os << ",\"categories\":";
+    detail::WriteJSONArray(os, categories);
+    os << ",\"categories_nodes\":";
+    detail::WriteJSONArray(os, categories_nodes);
+    os << ",\"categories_segments\":";
+    detail::WriteJSONArray(os, categories_segments);
+    os << ",\"categories_sizes\":";
+    detail::WriteJSONArray(os, categories_sizes);
+    os << ",\"default_left\":";
+    detail::WriteJSONArray(os, default_left);
+    os << ",\"id\":" << tree_id << ",\"left_children\":";
+    detail::WriteJSONArray(os, left_children);
+    os << ",\"loss_changes\":";
+    detail::WriteJSONArray(os, loss_changes);
+    os << ",\"parents\":";
+    detail::WriteJSONArray(os, parents);
+    os << ",\"right_children\":";
+    detail::WriteJSONArray(os, right_children);
+    os << ",\"split_conditions\":";
+    detail::WriteJSONArray(os, split_conditions);
+    os << ",\"split_indices\":";
+    detail::WriteJSONArray(os, split_indices);
+    os << ",\"split_type\":";
+    detail::WriteJSONArray(os, split_type);
+    os << ",\"sum_hessian\":";
+    detail::WriteJSONArray(os, sum_hessian);
+    os << ",\"tree_param\":{\"num_deleted\":\"0\",\"num_feature\":\"" << spec.num_feature
+       << "\",\"num_nodes\":\"" << num_nodes << "\",\"size_leaf_vector\":\"1\"}}";
+  }
+  os << "]},\"name\":\"gbtree\"},\"learner_model_param\":{\"base_score\":\"0.5\","
+     << "\"num_class\":\"0\",\"num_feature\":\"" << spec.num_feature
+     << "\",\"num_target\":\"1\"},\"objective\":{\"name\":\"reg:squarederror\","
+     << "\"reg_loss_param\":{\"scale_pos_weight\":\"1\"}}},\"version\":[1,7,0]}";
+  return os.str();
+}
+
+/*! \brief Generate an XGBoost legacy binary model. The format has no categorical tests. */
+inline std::string GenerateXGBoostLegacyBinary(FileModelSpec const& spec) {
+  struct LearnerModelParam {
+    float base_score;
+    std::uint32_t num_feature;
+    std::int32_t num_class;
+    std::int32_t contain_extra_attrs;
+    std::int32_t contain_eval_metrics;
+    std::uint32_t major_version;
+    std::uint32_t minor_version;
+    std::uint32_t num_target;
+    std::int32_t pad2[26];
+  };
+  static_assert(sizeof(LearnerModelParam) == 136);
+  struct GBTreeModelParam {
+    std::int32_t num_trees;
+    std::int32_t num_roots;
+    std::int32_t num_feature;
+    std::int32_t pad1;
+    std::int64_t pad2;
+    std::int32_t num_output_group;
+    std::int32_t size_leaf_vector;
+    std::int32_t pad3[32];
+  };
+  struct TreeParam {
+    std::int32_t num_roots;
+    std::int32_t num_nodes;
+    std::int32_t num_deleted;
+    std::int32_t max_depth;
+    std::int32_t num_feature;
+    std::int32_t size_leaf_vector;
+    std::int32_t reserved[31];
+  };
+  struct Node {
+    std::int32_t parent_;
+    std::int32_t cleft_, cright_;
+    std::uint32_t sindex_;
+    float info_;
+  };
+  static_assert(sizeof(Node) == 20);
+  struct NodeStat {
+    float loss_chg;
+    float sum_hess;
+    float base_weight;
+    std::int32_t leaf_child_cnt;
+  };
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> value_dist(-1.0f, 1.0f);
+  std::uniform_int_distribution<int> feature_dist(0, spec.num_feature - 1);
+  int const num_internal = (1 << spec.depth) - 1;
+  int const num_nodes = (1 << (spec.depth + 1)) - 1;
+
+  std::string b;
+  auto put = [&b](auto const& v) { b.append(reinterpret_cast<char const*>(&v), sizeof(v)); };
+  LearnerModelParam mparam{};
+  mparam.base_score = 0.5f;
+  mparam.num_feature = static_cast<std::uint32_t>(spec.num_feature);
+  mparam.major_version = 1;
+  mparam.minor_version = 7;
+  mparam.num_target = 1;
+  put(mparam);
+  std::string const name_obj = "reg:squarederror";
+  put(static_cast<std::uint64_t>(name_obj.size()));
+  b += name_obj;
+  std::string const name_gbm = "gbtree";
+  put(static_cast<std::uint64_t>(name_gbm.size()));
+  b += name_gbm;
+  GBTreeModelParam gbm{};
+  gbm.num_trees = spec.num_tree;
+  gbm.num_roots = 1;
+  gbm.num_feature = spec.num_feature;
+  gbm.num_output_group = 1;
+  put(gbm);
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    TreeParam tparam{};
+    tparam.num_roots = 1;
+    tparam.num_nodes = num_nodes;
+    tparam.max_depth = spec.depth;
+    tparam.num_feature = spec.num_feature;
+    put(tparam);
+    for (int nid = 0; nid < num_nodes; ++nid) {
+      Node node{};
+      node.parent_ = (nid == 0) ? -1 : ((nid - 1) / 2 | ((nid % 2 == 1) ? (1 << 31) : 0));
+      if (nid < num_internal) {
+        node.cleft_ = 2 * nid + 1;
+        node.cright_ = 2 * nid + 2;
+        node.sindex_ = static_cast<std::uint32_t>(feature_dist(rng)) | (1U << 31);
+        node.info_ = value_dist(rng);
+      } else {
+        node.cleft_ = -1;
+        node.cright_ = -1;
+        node.info_ = value_dist(rng);  // leaf output
+      }
+      put(node);
+    }
+    for (int nid = 0; nid < num_nodes; ++nid) {
+      NodeStat stat{1.0f, 1.0f, 0.0f, 0};
+      put(stat);
+    }
+  }
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    put(static_cast<std::int32_t>(0));  // tree_info
+  }
+  return b;
+}
+
+/*!
+ * \brief Columnar arrays in the layout passed by the scikit-learn importer.
+ *        The pointer vectors alias the backing vectors; keep the struct alive while loading.
+ */
+struct SKLearnArrays {
+  std::vector<std::int64_t> node_count;
+  std::vector<std::vector<std::int64_t>> children_left, children_right, feature, n_node_samples;
+  std::vector<std::vector<double>> threshold, value, weighted_n_node_samples, impurity;
+  std::vector<std::int64_t const*> children_left_ptr, children_right_ptr, feature_ptr,
+      n_node_samples_ptr;
+  std::vector<double const*> threshold_ptr, value_ptr, weighted_n_node_samples_ptr, impurity_ptr;
+};
+
+/*! \brief Generate columnar arrays for a scikit-learn random forest (numerical tests only) */
+inline SKLearnArrays GenerateSKLearnArrays(FileModelSpec const& spec) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+  std::uniform_int_distribution<std::int64_t> feature_dist(0, spec.num_feature - 1);
+  int const num_internal = (1 << spec.depth) - 1;
+  int const num_nodes = (1 << (spec.depth + 1)) - 1;
+  SKLearnArrays arrays;
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    arrays.node_count.push_back(num_nodes);
+    std::vector<std::int64_t> children_left(num_nodes), children_right(num_nodes),
+        feature(num_nodes), n_node_samples(num_nodes);
+    std::vector<double> threshold(num_nodes), value(num_nodes), weighted_n_node_samples(num_nodes),
+        impurity(num_nodes);
+    for (int nid = 0; nid < num_nodes; ++nid) {
+      bool const is_leaf = (nid >= num_internal);
+      children_left[nid] = is_leaf ? -1 : 2 * nid + 1;
+      children_right[nid] = is_leaf ? -1 : 2 * nid + 2;
+      feature[nid] = is_leaf ? -2 : feature_dist(rng);
+      threshold[nid] = is_leaf ? -2.0 : value_dist(rng);
+      value[nid] = value_dist(rng);
+      // A node at depth d covers 2^(depth - d) leaves; give each leaf 10 samples
+      int depth_of_node = 0;
+      for (int i = nid; i > 0; i = (i - 1) / 2) {
+        ++depth_of_node;
+      }
+      n_node_samples[nid] = static_cast<std::int64_t>(10) << (spec.depth - depth_of_node);
+      weighted_n_node_samples[nid] = static_cast<double>(n_node_samples[nid]);
+      impurity[nid] = 0.5;
+    }
+    arrays.children_left.push_back(std::move(children_left));
+    arrays.children_right.push_back(std::move(children_right));
+    arrays.feature.push_back(std::move(feature));
+    arrays.n_node_samples.push_back(std::move(n_node_samples));
+    arrays.threshold.push_back(std::move(threshold));
+    arrays.value.push_back(std::move(value));
+    arrays.weighted_n_node_samples.push_back(std::move(weighted_n_node_samples));
+    arrays.impurity.push_back(std::move(impurity));
+  }
+  for (std::int32_t tree_id = 0; tree_id < spec.num_tree; ++tree_id) {
+    arrays.children_left_ptr.push_back(arrays.children_left[tree_id].data());
+    arrays.children_right_ptr.push_back(arrays.children_right[tree_id].data());
+    arrays.feature_ptr.push_back(arrays.feature[tree_id].data());
+    arrays.n_node_samples_ptr.push_back(arrays.n_node_samples[tree_id].data());
+    arrays.threshold_ptr.push_back(arrays.threshold[tree_id].data());
+    arrays.value_ptr.push_back(arrays.value[tree_id].data());
+    arrays.weighted_n_node_samples_ptr.push_back(arrays.weighted_n_node_samples[tree_id].data());
+    arrays.impurity_ptr.push_back(arrays.impurity[tree_id].data());
+  }
+  return arrays;
+}
+
+}  // namespace treelite::bench
+
+#endif  // TESTS_BENCHMARK_GENERATE_MODEL_FILES_H_
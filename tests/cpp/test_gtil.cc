@@ -22,6 +22,8 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -234,4 +236,1347 @@ TEST(GTIL, InvalidCategoricalInput) {
   EXPECT_EQ(output, expected_output);
 }
 
+TEST(GTIL, ColumnMajorInputParity) {
+  // Column-major batches must predict identically to their row-major transpose
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::size_t const n_rows = 50;
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> row_major(n_rows * 2), col_major(n_rows * 2);
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    row_major[i * 2] = static_cast<double>(i % 7) * 0.2;
+    row_major[i * 2 + 1] = (i % 5 == 0) ? nan : static_cast<double>(i % 11) * 0.1;
+    col_major[i] = row_major[i * 2];
+    col_major[n_rows + i] = row_major[i * 2 + 1];
+  }
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  for (auto kind : {gtil::PredictKind::kPredictRaw, gtil::PredictKind::kPredictDefault,
+           gtil::PredictKind::kPredictLeafID, gtil::PredictKind::kPredictPerTree}) {
+    config.pred_kind = kind;
+    auto output_shape = gtil::GetOutputShape(*model, n_rows, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<double> expected(output_size), actual(output_size);
+    gtil::Predict(*model, row_major.data(), n_rows, expected.data(), config);
+    gtil::Predict(
+        *model, col_major.data(), gtil::InputLayout::kColMajor, n_rows, actual.data(), config);
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+TEST(GTIL, StridedInputParity) {
+  // Rows embedded in larger fixed-stride records must predict identically to a compacted
+  // row-major copy
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::size_t const n_rows = 50;
+  std::vector<double> row_major(n_rows * 2);
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    row_major[i * 2] = static_cast<double>(i % 7) * 0.2;
+    row_major[i * 2 + 1] = static_cast<double>(i % 11) * 0.1;
+  }
+  // Features at offset 3 of 8-element records; the padding must never be read
+  std::size_t const record_stride = 8, offset = 3;
+  std::vector<double> records(n_rows * record_stride, -999.0);
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    records[i * record_stride + offset] = row_major[i * 2];
+    records[i * record_stride + offset + 1] = row_major[i * 2 + 1];
+  }
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  for (auto kind : {gtil::PredictKind::kPredictRaw, gtil::PredictKind::kPredictDefault,
+           gtil::PredictKind::kPredictLeafID, gtil::PredictKind::kPredictPerTree}) {
+    config.pred_kind = kind;
+    auto output_shape = gtil::GetOutputShape(*model, n_rows, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<double> expected(output_size), actual(output_size);
+    gtil::Predict(*model, row_major.data(), n_rows, expected.data(), config);
+    gtil::Predict(*model, records.data() + offset, n_rows, record_stride, std::uint64_t{1},
+        actual.data(), config);
+    EXPECT_EQ(expected, actual);
+    // (row_stride = num_feature, elem_stride = 1) is exactly the contiguous row-major case
+    std::fill(actual.begin(), actual.end(), 0.0);
+    gtil::Predict(*model, row_major.data(), n_rows, std::uint64_t{2}, std::uint64_t{1},
+        actual.data(), config);
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+TEST(GTIL, PredictMultiParity) {
+  // The fused multi-model pass must agree with scoring each model independently
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  std::vector<double> base_scores{0.5};
+  std::vector<std::unique_ptr<Model>> owned_models;
+  for (double threshold : {0.0, 0.25}) {
+    std::unique_ptr<model_builder::ModelBuilder> builder
+        = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+            tree_annotation, model_builder::PostProcessorFunc{"sigmoid"}, base_scores);
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, threshold, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(-1.0 + threshold);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(1.0 + threshold);
+    builder->EndNode();
+    builder->EndTree();
+    owned_models.push_back(builder->CommitModel());
+  }
+  std::vector<Model const*> models{owned_models[0].get(), owned_models[1].get()};
+
+  std::size_t const n_rows = 70;
+  std::vector<double> elems(n_rows * 2);
+  for (std::size_t i = 0; i < elems.size(); ++i) {
+    elems[i] = static_cast<double>(i % 13) * 0.1 - 0.6;
+  }
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  for (auto kind : {gtil::PredictKind::kPredictRaw, gtil::PredictKind::kPredictDefault}) {
+    config.pred_kind = kind;
+    auto output_shape = gtil::GetOutputShape(*models[0], n_rows, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<std::vector<double>> expected(2, std::vector<double>(output_size));
+    std::vector<std::vector<double>> actual(2, std::vector<double>(output_size));
+    for (std::size_t i = 0; i < models.size(); ++i) {
+      gtil::Predict(*models[i], elems.data(), n_rows, expected[i].data(), config);
+    }
+    gtil::PredictMulti(
+        models, elems.data(), n_rows, std::vector<double*>{actual[0].data(), actual[1].data()},
+        config);
+    EXPECT_EQ(expected[0], actual[0]);
+    EXPECT_EQ(expected[1], actual[1]);
+  }
+}
+
+TEST(GTIL, CompiledBranchlessParity) {
+  // A uniform-operator numerical tree that is not complete takes the branchless predicated
+  // kernel; it must agree with the reference traversal, including on missing values
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kGE, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, -0.25, false, Operator::kGE, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(-3.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> elems{0.0, 0.0, 1.0, -1.0, nan, -1.0, 1.0, nan, nan, nan, 0.5, -0.25};
+  std::size_t const n_rows = elems.size() / 2;
+
+  gtil::CompiledModel compiled_model{*model};
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, n_rows, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output(output_size), output_compiled(output_size);
+  gtil::Predict(*model, elems.data(), n_rows, output.data(), config);
+  gtil::Predict(compiled_model, elems.data(), n_rows, output_compiled.data(), config);
+  EXPECT_EQ(output, output_compiled);
+}
+
+TEST(GTIL, CompiledCategoricalDecodeParity) {
+  // The compiled model decodes categorical columns once per batch into validated codes;
+  // the decoded path must agree with the reference traversal on every edge value
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->CategoricalTest(1, true, {0, 2, 65}, false, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::vector<double> categorical_column{-1.0, -0.5, 0.0, 0.7, 2.0, 3.0, 64.0, 65.0,
+      std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(), 1e10,
+      4.0e9, -1e10};
+  std::size_t const n_rows = categorical_column.size();
+  std::vector<double> elems(n_rows * 2);
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    elems[i * 2] = 0.0;
+    elems[i * 2 + 1] = categorical_column[i];
+  }
+
+  gtil::CompiledModel compiled_model{*model};
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, n_rows, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output(output_size), output_compiled(output_size);
+  gtil::Predict(*model, elems.data(), n_rows, output.data(), config);
+  gtil::Predict(compiled_model, elems.data(), n_rows, output_compiled.data(), config);
+  EXPECT_EQ(output, output_compiled);
+}
+
+TEST(GTIL, CSRInputParity) {
+  model_builder::Metadata metadata{3, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  // Dense representation of the CSR input below; absent entries are missing values
+  std::vector<double> dense{nan, -1.0, nan, nan, nan, 2.0, nan, nan, nan};
+  std::vector<double> data{-1.0, 2.0};
+  std::vector<std::uint64_t> col_ind{1, 2};
+  std::vector<std::uint64_t> row_ptr{0, 1, 2, 2};
+  std::uint64_t const num_row = 3;
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_dense(output_size), output_csr(output_size);
+  gtil::Predict(*model, dense.data(), num_row, output_dense.data(), config);
+  gtil::CSRView<double> csr{data.data(), col_ind.data(), row_ptr.data(), num_row};
+  gtil::Predict(*model, csr, output_csr.data(), config);
+  EXPECT_EQ(output_dense, output_csr);
+}
+
+TEST(GTIL, CompiledModelParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->CategoricalTest(1, false, {0, 2}, true, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-0.5);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(0.5);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::CompiledModel compiled_model{*model};
+  gtil::Configuration config;
+  config.nthread = 1;
+
+  std::vector<double> input{-1.0, 0.0, 1.0, 2.0, std::numeric_limits<double>::quiet_NaN(), 0.0};
+  std::uint64_t const num_row = 3;
+  for (auto pred_kind : {gtil::PredictKind::kPredictRaw, gtil::PredictKind::kPredictDefault}) {
+    config.pred_kind = pred_kind;
+    auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<double> output(output_size), output_compiled(output_size);
+    gtil::Predict(*model, input.data(), num_row, output.data(), config);
+    gtil::Predict(compiled_model, input.data(), num_row, output_compiled.data(), config);
+    EXPECT_EQ(output, output_compiled);
+  }
+}
+
+TEST(GTIL, NumaReplicatedModelParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 0.5, false, Operator::kGE, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-0.5);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(0.5);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::NumaReplicatedModel replicated_model{*model};
+  EXPECT_GE(replicated_model.GetNumNode(), 1);
+  gtil::Configuration config;
+  config.nthread = 1;
+
+  // Large enough batch to take the row-parallel schedule, where replica routing applies
+  std::uint64_t const num_row = 500;
+  std::vector<double> input(num_row * 2);
+  for (std::uint64_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<double>(i % 7) - 3.0;
+  }
+  for (auto pred_kind : {gtil::PredictKind::kPredictRaw, gtil::PredictKind::kPredictDefault,
+           gtil::PredictKind::kPredictLeafID}) {
+    config.pred_kind = pred_kind;
+    auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<double> output(output_size), output_replicated(output_size);
+    gtil::Predict(*model, input.data(), num_row, output.data(), config);
+    gtil::Predict(replicated_model, input.data(), num_row, output_replicated.data(), config);
+    EXPECT_EQ(output, output_replicated);
+  }
+}
+
+TEST(GTIL, TreeParallelSmallBatch) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  for (int tree_id = 0; tree_id < 2; ++tree_id) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(tree_id, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(-1.0 - tree_id);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(1.0 + tree_id);
+    builder->EndNode();
+    builder->EndTree();
+  }
+  auto model = builder->CommitModel();
+
+  // A single row with all threads triggers the tree-parallel schedule; it must agree with
+  // the single-threaded (row-parallel) result
+  std::vector<double> input{-1.0, 1.0};
+  gtil::Configuration config;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  config.nthread = 1;
+  auto output_shape = gtil::GetOutputShape(*model, 1, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_st(output_size), output_mt(output_size);
+  gtil::Predict(*model, input.data(), 1, output_st.data(), config);
+  config.nthread = 0;  // use all threads
+  gtil::Predict(*model, input.data(), 1, output_mt.data(), config);
+  EXPECT_EQ(output_st, output_mt);
+
+  // The persistent thread pool backend must agree as well
+  config.use_thread_pool = true;
+  std::vector<double> output_pool(output_size);
+  gtil::Predict(*model, input.data(), 1, output_pool.data(), config);
+  EXPECT_EQ(output_st, output_pool);
+}
+
+TEST(GTIL, PredictSessionParity) {
+  model_builder::Metadata metadata{1, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::Configuration config;
+  config.nthread = 1;
+
+  std::vector<float> input{-1.0f, 0.5f, std::numeric_limits<float>::quiet_NaN()};
+  std::uint64_t const num_row = 3;
+  for (auto pred_kind : {gtil::PredictKind::kPredictDefault, gtil::PredictKind::kPredictRaw,
+           gtil::PredictKind::kPredictLeafID, gtil::PredictKind::kPredictPerTree}) {
+    config.pred_kind = pred_kind;
+    gtil::PredictSession session{*model, config};
+    auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+    EXPECT_EQ(session.GetOutputShape(num_row), output_shape);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<float> output(output_size), output_session(output_size);
+    gtil::Predict(*model, input.data(), num_row, output.data(), config);
+    session.Predict(input.data(), num_row, output_session.data());
+    EXPECT_EQ(output, output_session);
+  }
+}
+
+TEST(GTIL, OutputBufferFullyWritten) {
+  // Predict() no longer zeroes the output buffer upfront, so every cell (including the
+  // padding of per-tree leaf vector slots) must be written during the traversal. A buffer
+  // poisoned with garbage must yield the same result as a zero-initialized one.
+  model_builder::Metadata metadata{2, TaskType::kMultiClf, true, 1, {3}, {1, 3}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {-1, -1}};
+  model_builder::PostProcessorFunc postprocessor{"identity_multiclass"};
+  std::vector<double> base_scores{0.0, 0.0, 0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  for (int tree_id = 0; tree_id < 2; ++tree_id) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(tree_id, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafVector(std::vector<float>{0.7f, 0.2f, 0.1f});
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafVector(std::vector<float>{0.1f, 0.3f, 0.6f});
+    builder->EndNode();
+    builder->EndTree();
+  }
+  auto model = builder->CommitModel();
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::vector<float> input{-1.0f, 0.5f, std::numeric_limits<float>::quiet_NaN(), 0.25f};
+  std::uint64_t const num_row = 2;
+  for (auto pred_kind : {gtil::PredictKind::kPredictDefault, gtil::PredictKind::kPredictRaw,
+           gtil::PredictKind::kPredictPerTree}) {
+    config.pred_kind = pred_kind;
+    auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<float> output(output_size, 0.0f), output_poisoned(output_size, 123.0f);
+    gtil::Predict(*model, input.data(), num_row, output.data(), config);
+    gtil::Predict(*model, input.data(), num_row, output_poisoned.data(), config);
+    EXPECT_EQ(output, output_poisoned);
+  }
+}
+
+TEST(GTIL, CascadeEarlyExit) {
+  // Binary classifier where every tree votes +1/-1; rows with all-negative features reach
+  // a decided margin after the first stage and must be retired without changing decisions.
+  int const num_tree = 32;
+  std::vector<std::int32_t> target_ids(num_tree, 0), class_ids(num_tree, 0);
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{
+      static_cast<std::uint32_t>(num_tree), target_ids, class_ids};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  for (int tree_id = 0; tree_id < num_tree; ++tree_id) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(tree_id % 2, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(-1.0);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(1.0);
+    builder->EndNode();
+    builder->EndTree();
+  }
+  auto model = builder->CommitModel();
+
+  std::uint64_t const num_row = 100;
+  std::vector<float> input(num_row * 2);
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (auto& e : input) {
+    e = dist(rng);
+  }
+  for (std::uint64_t row_id = 0; row_id < 40; ++row_id) {  // strongly negative rows
+    input[row_id * 2] = input[row_id * 2 + 1] = -0.5f;
+  }
+
+  gtil::Configuration config{
+      R"({"predict_type": "raw", "nthread": 1, "cascade_stage_size": 8,
+          "cascade_threshold_low": -6.0, "cascade_threshold_high": 6.0})"};
+  EXPECT_EQ(config.cascade_stage_size, 8);
+  EXPECT_EQ(config.cascade_threshold_low, -6.0);
+  EXPECT_EQ(config.cascade_threshold_high, 6.0);
+
+  std::vector<float> full(num_row), cascade(num_row);
+  gtil::Configuration full_config = config;
+  full_config.cascade_stage_size = 0;
+  gtil::Predict(*model, input.data(), num_row, full.data(), full_config);
+  gtil::Predict(*model, input.data(), num_row, cascade.data(), config);
+  int num_retired = 0;
+  for (std::uint64_t row_id = 0; row_id < num_row; ++row_id) {
+    if (cascade[row_id] != full[row_id]) {
+      ++num_retired;
+      // Retired rows keep a partial score on the same side of the decision boundary
+      EXPECT_EQ(cascade[row_id] > 0.0f, full[row_id] > 0.0f);
+    }
+  }
+  EXPECT_GE(num_retired, 40);
+}
+
+TEST(GTIL, WarmupDoesNotAffectResults) {
+  // Warming up pre-faults pages and runs synthetic rows; predictions must be unchanged,
+  // for heap- and arena-backed models alike
+  model_builder::Metadata metadata{2, TaskType::kRegressor, true, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::vector<float> input{0.2f, 0.8f, 0.7f, 0.1f};
+  std::vector<float> expected(2), actual(2);
+  gtil::Predict(*model, input.data(), 2, expected.data(), config);
+
+  gtil::Warmup(*model, config);
+  gtil::Predict(*model, input.data(), 2, actual.data(), config);
+  EXPECT_EQ(expected, actual);
+
+  std::stringstream ss;
+  model->SerializeToStream(ss);
+  auto arena_model = Model::DeserializeFromStream(ss);
+  gtil::Warmup(*arena_model, config);
+  gtil::Predict(*arena_model, input.data(), 2, actual.data(), config);
+  EXPECT_EQ(expected, actual);
+}
+
+TEST(GTIL, ThreadAffinity) {
+  gtil::Configuration config(
+      "{\"predict_type\": \"default\", \"nthread\": 1, \"thread_affinity\": \"explicit\", "
+      "\"affinity_cpu_list\": [0]}");
+  EXPECT_EQ(config.thread_affinity, gtil::ThreadAffinity::kExplicit);
+  EXPECT_EQ(config.affinity_cpu_list, std::vector<int>{0});
+  // Unknown policies and an explicit policy without a CPU list are rejected
+  EXPECT_THROW(
+      gtil::Configuration("{\"predict_type\": \"default\", \"thread_affinity\": \"bogus\"}"),
+      Error);
+  EXPECT_THROW(
+      gtil::Configuration("{\"predict_type\": \"default\", \"thread_affinity\": \"explicit\"}"),
+      Error);
+
+  // Pinned prediction must produce the same results as unpinned
+  model_builder::Metadata metadata{2, TaskType::kRegressor, true, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::vector<float> input{0.2f, 0.8f, 0.7f, 0.1f};
+  std::vector<float> expected(2), actual(2);
+  gtil::Configuration unpinned_config;
+  unpinned_config.nthread = 1;
+  gtil::Predict(*model, input.data(), 2, expected.data(), unpinned_config);
+  for (auto policy : {gtil::ThreadAffinity::kCompact, gtil::ThreadAffinity::kScatter,
+           gtil::ThreadAffinity::kExplicit}) {
+    gtil::Configuration pinned_config;
+    pinned_config.nthread = 1;
+    pinned_config.thread_affinity = policy;
+    pinned_config.affinity_cpu_list = {0};
+    gtil::Predict(*model, input.data(), 2, actual.data(), pinned_config);
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+TEST(GTIL, ValidityBitmapParity) {
+  // A tree that routes missing values differently per node, so masked cells are
+  // distinguishable from any in-range payload
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, 0.5, false, Operator::kLT, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(10.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(20.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(30.0);
+  builder->EndNode();
+  builder->EndTree();
+  std::unique_ptr<Model> model = builder->CommitModel();
+
+  constexpr std::uint64_t kNumRow = 3;
+  float const kGarbage = 777.0f;  // payload under a cleared bit; must be ignored
+  std::vector<float> input{0.2f, kGarbage, kGarbage, 0.8f, 0.3f, 0.1f};
+  std::vector<float> reference_input{0.2f, std::numeric_limits<float>::quiet_NaN(),
+      std::numeric_limits<float>::quiet_NaN(), 0.8f, 0.3f, 0.1f};
+  // Cells 1 and 2 are invalid: bits (1 % 8) and (2 % 8) of byte 0 cleared
+  std::vector<std::uint8_t> validity{static_cast<std::uint8_t>(0xFF & ~0x02 & ~0x04)};
+
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::vector<float> expected(kNumRow), actual(kNumRow);
+  gtil::Predict(*model, reference_input.data(), kNumRow, expected.data(), config);
+  gtil::Predict(*model, input.data(), validity.data(), kNumRow, actual.data(), config);
+  EXPECT_EQ(expected, actual);
+
+  // A null bitmap asserts all cells valid and runs the NaN-check-free kernels; on a
+  // NaN-free batch they must agree with the ordinary kernels
+  gtil::Predict(*model, input.data(), static_cast<std::uint8_t const*>(nullptr), kNumRow,
+      actual.data(), config);
+  std::vector<float> all_valid(kNumRow);
+  gtil::Predict(*model, input.data(), kNumRow, all_valid.data(), config);
+  EXPECT_EQ(all_valid, actual);
+}
+
+TEST(GTIL, MixedPrecisionInput) {
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.25};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->NumericalTest(1, 2.0, false, Operator::kGE, 3, 4);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(0.5);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::Configuration config;
+  config.nthread = 1;
+
+  // All values exactly representable in float32, including the boundary values
+  std::vector<float> input32{-1.0f, 3.0f, 0.5f, 2.0f, 0.75f, 1.5f,
+      std::numeric_limits<float>::quiet_NaN(), 2.0f};
+  std::vector<double> input64(input32.begin(), input32.end());
+  std::uint64_t const num_row = 4;
+  for (auto pred_kind : {gtil::PredictKind::kPredictDefault, gtil::PredictKind::kPredictRaw,
+           gtil::PredictKind::kPredictLeafID, gtil::PredictKind::kPredictPerTree}) {
+    config.pred_kind = pred_kind;
+    auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+    std::size_t const output_size = std::accumulate(
+        output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+    std::vector<double> expected(output_size), output(output_size);
+    gtil::Predict(*model, input64.data(), num_row, expected.data(), config);
+    gtil::Predict(*model, input32.data(), num_row, output.data(), config);
+    EXPECT_EQ(output, expected);
+  }
+}
+
+TEST(GTIL, StreamingPredictParity) {
+  model_builder::Metadata metadata{1, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  gtil::Configuration config;
+  config.nthread = 1;
+
+  // 10 rows streamed in chunks of 4: two full chunks, one partial chunk
+  std::vector<float> input{-2.0f, -1.0f, 0.5f, 1.0f, std::numeric_limits<float>::quiet_NaN(),
+      -0.5f, 3.0f, -4.0f, 0.0f, 2.0f};
+  std::uint64_t const num_row = input.size();
+  std::vector<float> expected(num_row);
+  gtil::Predict(*model, input.data(), num_row, expected.data(), config);
+
+  std::uint64_t rows_consumed = 0;
+  std::vector<float> streamed;
+  gtil::ChunkReadFunc<float> reader
+      = [&input, &rows_consumed, num_row](float* buffer, std::uint64_t max_rows) {
+          std::uint64_t const n = std::min(max_rows, num_row - rows_consumed);
+          std::copy_n(input.begin() + rows_consumed, n, buffer);
+          rows_consumed += n;
+          return n;
+        };
+  gtil::ChunkWriteFunc<float> writer = [&streamed](float const* output, std::uint64_t n) {
+    streamed.insert(streamed.end(), output, output + n);
+  };
+  gtil::PredictStream<float>(*model, reader, writer, 4, config);
+
+  EXPECT_EQ(rows_consumed, num_row);
+  EXPECT_EQ(streamed, expected);
+}
+
+TEST(GTIL, WorkStealingParity) {
+  model_builder::Metadata metadata{1, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  // Enough rows to span several row blocks, so stealing can actually occur
+  std::uint64_t const num_row = 300;
+  std::vector<double> input(num_row);
+  for (std::uint64_t i = 0; i < num_row; ++i) {
+    input[i] = (i % 2 == 0 ? -1.0 : 1.0);
+  }
+  gtil::Configuration config;
+  config.nthread = 0;  // use all threads
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  std::vector<double> output_static(num_row), output_ws(num_row);
+  gtil::Predict(*model, input.data(), num_row, output_static.data(), config);
+  config.use_work_stealing = true;
+  gtil::Predict(*model, input.data(), num_row, output_ws.data(), config);
+  EXPECT_EQ(output_static, output_ws);
+}
+
+TEST(GTIL, IntegerLeafOutput) {
+  model_builder::Metadata metadata{1, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::vector<double> input{-1.0, 1.0, std::numeric_limits<double>::quiet_NaN()};
+  std::uint64_t const num_row = 3;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictLeafID;
+  std::vector<double> output_float(num_row);
+  std::vector<std::int32_t> output_int(num_row);
+  gtil::Predict(*model, input.data(), num_row, output_float.data(), config);
+  gtil::PredictLeaf(*model, input.data(), num_row, output_int.data(), config);
+  for (std::uint64_t i = 0; i < num_row; ++i) {
+    EXPECT_EQ(output_int[i], static_cast<std::int32_t>(output_float[i]));
+  }
+}
+
+TEST(GTIL, FastMathPostProcessor) {
+  model_builder::Metadata metadata{1, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-2.5);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.5);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::vector<float> input{-1.0f, 0.5f, std::numeric_limits<float>::quiet_NaN()};
+  std::uint64_t const num_row = 3;
+  gtil::Configuration config;
+  config.nthread = 1;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<float> output_exact(output_size), output_fast(output_size);
+  gtil::Predict(*model, input.data(), num_row, output_exact.data(), config);
+  config.use_fast_math = true;
+  gtil::Predict(*model, input.data(), num_row, output_fast.data(), config);
+  // The batch kernels use a polynomial exp approximation; results agree to a few ulps
+  for (std::size_t i = 0; i < output_size; ++i) {
+    EXPECT_NEAR(output_fast[i], output_exact[i], 1e-6);
+  }
+}
+
+TEST(GTIL, PredictionStatsCollection) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->CategoricalTest(1, true, {0}, false, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-2.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> input{-1.0, 0.0, 1.0, 1.0, nan, 0.0};
+  std::uint64_t const num_row = 3;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_plain(output_size), output_stats(output_size);
+  gtil::Predict(*model, input.data(), num_row, output_plain.data(), config);
+  gtil::PredictionStats stats;
+  gtil::Predict(*model, input.data(), num_row, output_stats.data(), config, &stats);
+  EXPECT_EQ(output_plain, output_stats);
+  EXPECT_EQ(stats.num_row, 3U);
+  EXPECT_EQ(stats.num_tree_traversal, 6U);  // 3 rows x 2 trees, both depth-1 stumps
+  EXPECT_EQ(stats.num_node_visit, 6U);
+  EXPECT_EQ(stats.num_missing_branch, 1U);  // only the NaN in the last row's feature 0
+  EXPECT_EQ(stats.num_categorical_visit, 3U);  // every row visits the categorical stump
+  std::vector<std::uint64_t> const expected_per_tree{3, 3};
+  EXPECT_EQ(stats.node_visit_per_tree, expected_per_tree);
+}
+
+TEST(GTIL, QuantizedModelParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{3, {0, 0, 0}, {0, 0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 2.0, false, Operator::kGE, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-3.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(3.0);
+  builder->EndNode();
+  builder->EndTree();
+  // A tree with a categorical test keeps the full-precision records
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->CategoricalTest(1, true, {0, 2}, false, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-5.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(5.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  // Boundary-equal values exercise exactness of the rank encoding for kLT / kGE
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> input{
+      0.5, 2.0, 0.0, 2.5, 1.0, 0.0, nan, nan, -1.0, 1.9999999, 0.5000001, 2.0000001};
+  std::uint64_t const num_row = 6;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_full(output_size), output_quantized(output_size);
+  gtil::CompiledModel compiled{*model};
+  gtil::CompiledModel compiled_quantized{*model, true};
+  gtil::Predict(compiled, input.data(), num_row, output_full.data(), config);
+  gtil::Predict(compiled_quantized, input.data(), num_row, output_quantized.data(), config);
+  EXPECT_EQ(output_full, output_quantized);
+}
+
+TEST(GTIL, CompactEncodingParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  // An unbalanced numerical tree, eligible for the compact encoding
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, -1.0, false, Operator::kGE, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(3.0);
+  builder->EndNode();
+  builder->EndTree();
+  // A tree with a categorical test keeps the full-width records
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->CategoricalTest(1, true, {0, 2}, false, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-5.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(5.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> input{0.0, -1.0, 1.0, 2.0, nan, 0.0, 0.0, nan, nan, nan, 0.5, -2.0};
+  std::uint64_t const num_row = 6;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_full(output_size), output_compact(output_size);
+  gtil::CompiledModel compiled{*model};
+  gtil::CompiledModel compiled_compact{*model, /*quantize=*/false, /*compact=*/true};
+  gtil::Predict(compiled, input.data(), num_row, output_full.data(), config);
+  gtil::Predict(compiled_compact, input.data(), num_row, output_compact.data(), config);
+  EXPECT_EQ(output_full, output_compact);
+}
+
+TEST(GTIL, ReducedPrecisionLeafParity) {
+  model_builder::Metadata metadata{1, TaskType::kMultiClf, false, 1, {3}, {1, 3}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {-1, -1}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0, 0.0, 0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  // Leaf values exactly representable in bfloat16 (8 mantissa bits), so the reduced-
+  // precision store must reproduce the full-precision predictions bit for bit
+  for (int i = 0; i < 2; ++i) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, 0.5f, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafVector(std::vector<float>{0.5f, 0.25f, -0.75f});
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafVector(std::vector<float>{-1.5f, 2.0f, 0.125f});
+    builder->EndNode();
+    builder->EndTree();
+  }
+  auto model = builder->CommitModel();
+
+  std::vector<float> input{0.0f, 1.0f, std::numeric_limits<float>::quiet_NaN()};
+  std::uint64_t const num_row = 3;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<float> output_full(output_size), output_half(output_size);
+  gtil::CompiledModel compiled{*model};
+  gtil::CompiledModel compiled_half{
+      *model, /*quantize=*/false, /*compact=*/false, /*reduced_precision_leaf=*/true};
+  gtil::Predict(compiled, input.data(), num_row, output_full.data(), config);
+  gtil::Predict(compiled_half, input.data(), num_row, output_half.data(), config);
+  EXPECT_EQ(output_full, output_half);
+}
+
+TEST(GTIL, SubtreeDeduplicationParity) {
+  // Several trees sharing identical subtrees (tree 0 repeated verbatim, plus a common
+  // right branch); the deduplicated compiled model must reproduce the reference exactly
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{4, {0, 0, 0, 0}, {0, 0, 0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  for (int i = 0; i < 4; ++i) {
+    float const left_leaf = (i % 2 == 0) ? 1.0f : static_cast<float>(i);
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, 0.5f, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(left_leaf);
+    builder->EndNode();
+    // The right subtree is identical across all four trees
+    builder->StartNode(2);
+    builder->NumericalTest(1, 0.25f, false, Operator::kLT, 3, 4);
+    builder->EndNode();
+    builder->StartNode(3);
+    builder->LeafScalar(-2.0f);
+    builder->EndNode();
+    builder->StartNode(4);
+    builder->LeafScalar(3.0f);
+    builder->EndNode();
+    builder->EndTree();
+  }
+  auto model = builder->CommitModel();
+
+  float const nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> input{0.2f, 0.1f, 0.8f, 0.9f, nan, 0.1f, 0.7f, nan};
+  std::uint64_t const num_row = 4;
+  gtil::Configuration config;
+  config.nthread = 1;
+  std::vector<float> expected(num_row), actual(num_row);
+  gtil::Predict(*model, input.data(), num_row, expected.data(), config);
+  gtil::CompiledModel deduped{*model, /*quantize=*/false, /*compact=*/false,
+      /*reduced_precision_leaf=*/false, /*deduplicate=*/true};
+  gtil::Predict(deduped, input.data(), num_row, actual.data(), config);
+  EXPECT_EQ(expected, actual);
+}
+
+TEST(GTIL, FixedDepthKernelParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  // A complete depth-2 tree, eligible for the fixed-depth kernel
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, 1.0, false, Operator::kLT, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->NumericalTest(1, -1.0, true, Operator::kLT, 5, 6);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->StartNode(5);
+  builder->LeafScalar(3.0);
+  builder->EndNode();
+  builder->StartNode(6);
+  builder->LeafScalar(4.0);
+  builder->EndNode();
+  builder->EndTree();
+  // An unbalanced tree, kept on the generic traversal
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 1.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, 0.0, true, Operator::kLT, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(-2.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(-3.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> input{-1.0, 0.5, 1.0, -2.0, nan, 1.5, 0.5, nan, nan, nan, 0.0, -1.0};
+  std::uint64_t const num_row = 6;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_model(output_size), output_compiled(output_size);
+  gtil::Predict(*model, input.data(), num_row, output_model.data(), config);
+  gtil::CompiledModel compiled{*model};
+  gtil::Predict(compiled, input.data(), num_row, output_compiled.data(), config);
+  EXPECT_EQ(output_model, output_compiled);
+}
+
+TEST(GTIL, OptimizeLayoutParity) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat64, TypeInfo::kFloat64, metadata,
+          tree_annotation, postprocessor, base_scores);
+
+  // Nodes are laid out in depth-first order, so the breadth-first reordering is a
+  // genuine permutation
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 4);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->CategoricalTest(1, false, {0, 2}, false, 2, 3);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(-2.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->NumericalTest(1, 1.5, false, Operator::kLT, 5, 6);
+  builder->EndNode();
+  builder->StartNode(5);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(6);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> input{
+      -1.0, 0.0, -1.0, 1.0, -1.0, nan, 1.0, 0.5, 1.0, 2.5, nan, nan, 1.0, nan};
+  std::uint64_t const num_row = 7;
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+  auto output_shape = gtil::GetOutputShape(*model, num_row, config);
+  std::size_t const output_size = std::accumulate(
+      output_shape.begin(), output_shape.end(), std::uint64_t(1), std::multiplies<>());
+  std::vector<double> output_before(output_size), output_after(output_size);
+  gtil::Predict(*model, input.data(), num_row, output_before.data(), config);
+  model->OptimizeLayout();
+  gtil::Predict(*model, input.data(), num_row, output_after.data(), config);
+  EXPECT_EQ(output_before, output_after);
+}
+
 }  // namespace treelite
@@ -192,6 +192,156 @@ TEST(ModelBuilder, NodeMapping) {
       [&](int i, int) { TREELITE_CHECK_EQ(dump[0], dump[i]); });
 }
 
+TEST(ModelBuilder, BulkTree) {
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+
+  // Reference model, built with the per-node protocol
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->NumericalTest(1, -0.5, false, Operator::kLT, 3, 4);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(3.0);
+  builder->EndNode();
+  builder->StartNode(3);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(4);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  std::unique_ptr<Model> expected_model = builder->CommitModel();
+
+  // Same tree, ingested as whole per-node arrays
+  std::unique_ptr<model_builder::ModelBuilder> bulk_builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  bulk_builder->BulkTree(5, {1, 3, -1, -1, -1}, {2, 4, -1, -1, -1}, {0, 1, -1, -1, -1},
+      {0.5, -0.5, 0.0, 0.0, 0.0}, {true, false, false, false, false}, Operator::kLT,
+      {0.0, 0.0, 3.0, 1.0, 2.0});
+  std::unique_ptr<Model> model = bulk_builder->CommitModel();
+
+  AssertJSONStringsEqual(model->DumpAsJSON(false), expected_model->DumpAsJSON(false));
+}
+
+TEST(ModelBuilder, TreeArrayViews) {
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(1, 0.5, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(-1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->EndTree();
+  std::unique_ptr<Model> model = builder->CommitModel();
+
+  TreeArrayViews const views = model->GetTreeArrayViews(0);
+  ASSERT_EQ(views.num_nodes, 3);
+  EXPECT_EQ(views.node_type[0], TreeNodeType::kNumericalTestNode);
+  EXPECT_EQ(views.node_type[1], TreeNodeType::kLeafNode);
+  EXPECT_EQ(views.cleft[0], 1);
+  EXPECT_EQ(views.cright[0], 2);
+  EXPECT_EQ(views.cleft[1], -1);
+  EXPECT_EQ(views.split_index[0], 1);
+  EXPECT_EQ(static_cast<float const*>(views.threshold)[0], 0.5f);
+  EXPECT_EQ(static_cast<float const*>(views.leaf_value)[1], -1.0f);
+  EXPECT_EQ(static_cast<float const*>(views.leaf_value)[2], 1.0f);
+  // The builder records no node statistics, so the stats pointers must be null
+  EXPECT_EQ(views.data_count, nullptr);
+  EXPECT_EQ(views.sum_hess, nullptr);
+  EXPECT_EQ(views.gain, nullptr);
+  EXPECT_THROW(model->GetTreeArrayViews(1), Error);
+}
+
+TEST(ModelBuilder, NodeCountHint) {
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{2, {0, 0}, {0, 0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+
+  auto build_tree = [](model_builder::ModelBuilder& builder) {
+    builder.StartNode(0);
+    builder.NumericalTest(0, 0.5, true, Operator::kLT, 1, 2);
+    builder.EndNode();
+    builder.StartNode(1);
+    builder.LeafScalar(1.0);
+    builder.EndNode();
+    builder.StartNode(2);
+    builder.LeafScalar(2.0);
+    builder.EndNode();
+    builder.EndTree();
+  };
+
+  // Reference model, built without hints
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  for (int i = 0; i < 2; ++i) {
+    builder->StartTree();
+    build_tree(*builder);
+  }
+  std::unique_ptr<Model> expected_model = builder->CommitModel();
+
+  // Hints must not affect the resulting model
+  std::unique_ptr<model_builder::ModelBuilder> hinted_builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  hinted_builder->TotalNodeCountHint(6);
+  hinted_builder->StartTree(3);  // Exact per-tree hint
+  build_tree(*hinted_builder);
+  hinted_builder->StartTree();  // Falls back to the model-level hint
+  build_tree(*hinted_builder);
+  std::unique_ptr<Model> model = hinted_builder->CommitModel();
+
+  AssertJSONStringsEqual(model->DumpAsJSON(false), expected_model->DumpAsJSON(false));
+}
+
+TEST(ModelBuilder, BulkTreeInvalid) {
+  model_builder::Metadata metadata{2, TaskType::kBinaryClf, false, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"sigmoid"};
+  std::vector<double> base_scores{0.0};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  // Mismatched array length
+  EXPECT_THROW(builder->BulkTree(3, {1, -1, -1}, {2, -1, -1}, {0, -1}, {0.5, 0.0, 0.0},
+                   {true, false, false}, Operator::kLT, {0.0, 1.0, 2.0}),
+      Error);
+  // Child index out of range
+  EXPECT_THROW(builder->BulkTree(3, {1, -1, -1}, {3, -1, -1}, {0, -1, -1}, {0.5, 0.0, 0.0},
+                   {true, false, false}, Operator::kLT, {0.0, 1.0, 2.0}),
+      Error);
+  // Orphaned node
+  EXPECT_THROW(builder->BulkTree(4, {1, -1, -1, -1}, {2, -1, -1, -1}, {0, -1, -1, -1},
+                   {0.5, 0.0, 0.0, 0.0}, {true, false, false, false}, Operator::kLT,
+                   {0.0, 1.0, 2.0, 3.0}),
+      Error);
+  // split_index out of range
+  EXPECT_THROW(builder->BulkTree(3, {1, -1, -1}, {2, -1, -1}, {2, -1, -1}, {0.5, 0.0, 0.0},
+                   {true, false, false}, Operator::kLT, {0.0, 1.0, 2.0}),
+      Error);
+}
+
 TEST(ModelBuilderJSONParsing, Metadata) {
   std::string const json_str = R"(
     {
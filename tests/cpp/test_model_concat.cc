@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <variant>
 #include <vector>
 
@@ -87,6 +88,177 @@ TEST(ModelConcatenation, TreeStump) {
   }
 }
 
+TEST(ModelConcatenation, ManyTrees) {
+  // Enough trees that the parallel cloning path runs multi-threaded; tree order and
+  // content must match the source models exactly
+  constexpr int kNumModelObjs = 4;
+  constexpr int kNumTreePerObj = 50;
+  std::vector<std::unique_ptr<Model>> model_objs;
+  for (int i = 0; i < kNumModelObjs; ++i) {
+    auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+        model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+        model_builder::TreeAnnotation{
+            kNumTreePerObj, std::vector<std::int32_t>(kNumTreePerObj, 0),
+            std::vector<std::int32_t>(kNumTreePerObj, 0)},
+        model_builder::PostProcessorFunc{"identity"}, {0.0});
+    for (int j = 0; j < kNumTreePerObj; ++j) {
+      builder->StartTree();
+      builder->StartNode(0);
+      builder->NumericalTest(0, static_cast<float>(i), true, Operator::kLT, 1, 2);
+      builder->EndNode();
+      builder->StartNode(1);
+      builder->LeafScalar(static_cast<float>(i * kNumTreePerObj + j));
+      builder->EndNode();
+      builder->StartNode(2);
+      builder->LeafScalar(-1.0);
+      builder->EndNode();
+      builder->EndTree();
+    }
+    model_objs.push_back(builder->CommitModel());
+  }
+  std::vector<Model const*> model_obj_refs;
+  std::transform(model_objs.begin(), model_objs.end(), std::back_inserter(model_obj_refs),
+      [](auto const& obj) { return obj.get(); });
+
+  std::unique_ptr<Model> concatenated_model = ConcatenateModelObjects(model_obj_refs);
+  ASSERT_EQ(concatenated_model->GetNumTree(), kNumModelObjs * kNumTreePerObj);
+  auto& trees = std::get<ModelPreset<float, float>>(concatenated_model->variant_).trees;
+  for (int i = 0; i < kNumModelObjs; ++i) {
+    for (int j = 0; j < kNumTreePerObj; ++j) {
+      auto const& tree = trees[i * kNumTreePerObj + j];
+      EXPECT_EQ(tree.Threshold(0), static_cast<float>(i));
+      EXPECT_EQ(tree.LeafValue(1), static_cast<float>(i * kNumTreePerObj + j));
+    }
+  }
+}
+
+TEST(ModelConcatenation, MoveTreeStump) {
+  std::vector<std::unique_ptr<Model>> model_objs;
+  constexpr int kNumModelObjs = 5;
+
+  for (int i = 0; i < kNumModelObjs; ++i) {
+    auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+        model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+        model_builder::TreeAnnotation{1, {0}, {0}}, model_builder::PostProcessorFunc{"identity"},
+        {0.0});
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(1.0);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(2.0);
+    builder->EndNode();
+    builder->EndTree();
+    model_objs.push_back(builder->CommitModel());
+  }
+
+  // The copying overload gives the reference result
+  std::vector<Model const*> model_obj_refs;
+  std::transform(model_objs.begin(), model_objs.end(), std::back_inserter(model_obj_refs),
+      [](auto const& obj) { return obj.get(); });
+  std::unique_ptr<Model> expected_model = ConcatenateModelObjects(model_obj_refs);
+
+  std::unique_ptr<Model> concatenated_model = ConcatenateModelObjects(std::move(model_objs));
+  ASSERT_TRUE(model_objs.empty());
+  ASSERT_EQ(concatenated_model->GetNumTree(), kNumModelObjs);
+  ASSERT_TRUE(concatenated_model->DumpAsJSON(false) == expected_model->DumpAsJSON(false));
+  TestRoundTrip(concatenated_model.get());
+}
+
+TEST(ModelConcatenation, MoveSharedMemoryBacked) {
+  // A model attached from shared memory has its tree arrays pointing into the region;
+  // move-concatenation must take over the region so the trees outlive the source model
+  std::string const shm_name = "treelite_test_concat_move";
+  {
+    auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+        model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+        model_builder::TreeAnnotation{1, {0}, {0}}, model_builder::PostProcessorFunc{"identity"},
+        {0.0});
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(1.0);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(2.0);
+    builder->EndNode();
+    builder->EndTree();
+    std::unique_ptr<Model> published = builder->CommitModel();
+    published->SerializeToSharedMemory(shm_name);
+    // The publishing model goes out of scope here; the attached copies keep the region open
+  }
+
+  std::vector<std::unique_ptr<Model>> model_objs;
+  constexpr int kNumModelObjs = 3;
+  for (int i = 0; i < kNumModelObjs; ++i) {
+    model_objs.push_back(Model::AttachFromSharedMemory(shm_name));
+  }
+  std::unique_ptr<Model> concatenated_model = ConcatenateModelObjects(std::move(model_objs));
+  ASSERT_TRUE(model_objs.empty());
+  ASSERT_EQ(concatenated_model->GetNumTree(), kNumModelObjs);
+  // The sources are destroyed; the trees must still be readable through the retained
+  // region. Dump the whole model, so every node array is read, including those referencing
+  // the region in place
+  auto& trees = std::get<ModelPreset<float, float>>(concatenated_model->variant_).trees;
+  for (int i = 0; i < kNumModelObjs; ++i) {
+    EXPECT_EQ(trees[i].LeafValue(1), 1.0f);
+    EXPECT_EQ(trees[i].LeafValue(2), 2.0f);
+  }
+  ASSERT_GT(concatenated_model->DumpAsJSON(false).size(), 0);
+  Model::RemoveSharedMemory(shm_name);
+}
+
+TEST(ModelSlice, SharedStorageView) {
+  constexpr int kNumTree = 4;
+  auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+      model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+      model_builder::TreeAnnotation{
+          kNumTree, std::vector<std::int32_t>(kNumTree, 0), std::vector<std::int32_t>(kNumTree, 0)},
+      model_builder::PostProcessorFunc{"identity"}, {0.0});
+  for (int i = 0; i < kNumTree; ++i) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, static_cast<double>(i), true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(i * 10.0 + 1.0);
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(i * 10.0 + 2.0);
+    builder->EndNode();
+    builder->EndTree();
+  }
+  std::unique_ptr<Model> model = builder->CommitModel();
+
+  std::unique_ptr<Model> sliced = model->Slice(1, 3);
+  ASSERT_EQ(sliced->GetNumTree(), 2);
+  EXPECT_EQ(sliced->GetThresholdType(), TypeInfo::kFloat32);
+  EXPECT_EQ(sliced->num_feature, model->num_feature);
+  EXPECT_TRUE(
+      sliced->target_id == ContiguousArray<std::int32_t>(std::vector<std::int32_t>(2, 0)));
+  auto& sliced_trees = std::get<ModelPreset<float, float>>(sliced->variant_).trees;
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(sliced_trees[i].Threshold(0), static_cast<float>(i + 1));
+    EXPECT_EQ(sliced_trees[i].LeafValue(1), (i + 1) * 10.0f + 1.0f);
+    EXPECT_EQ(sliced_trees[i].LeafValue(2), (i + 1) * 10.0f + 2.0f);
+  }
+
+  // The slice shares storage with the source model: a write to the source is observed
+  // through the slice
+  auto& trees = std::get<ModelPreset<float, float>>(model->variant_).trees;
+  trees[1].SetLeaf(1, 100.0f);
+  EXPECT_EQ(sliced_trees[0].LeafValue(1), 100.0f);
+
+  // Out-of-bounds ranges are rejected
+  ASSERT_THROW(model->Slice(3, 2), treelite::Error);
+  ASSERT_THROW(model->Slice(0, kNumTree + 1), treelite::Error);
+}
+
 TEST(ModelConcatenation, MismatchedTreeType) {
   std::vector<std::unique_ptr<Model>> model_objs;
 
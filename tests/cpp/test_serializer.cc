@@ -9,7 +9,9 @@
 #include <rapidjson/document.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/writer.h>
+#include <treelite/detail/compression.h>
 #include <treelite/detail/file_utils.h>
+#include <treelite/enum/codec.h>
 #include <treelite/enum/task_type.h>
 #include <treelite/enum/typeinfo.h>
 #include <treelite/error.h>
@@ -21,9 +23,11 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace fmt::literals;
 
@@ -76,6 +80,41 @@ inline void TestRoundTrip(treelite::Model* model) {
 
     std::filesystem::remove(filepath);
   }
+
+  for (int i = 0; i < 2; ++i) {
+    // Test round trip with LZ4-compressed serialization
+    std::ostringstream oss;
+    oss.exceptions(std::ios::failbit | std::ios::badbit);
+    model->SerializeToStream(oss, treelite::Codec::kLZ4);
+
+    std::istringstream iss(oss.str());
+    iss.exceptions(std::ios::failbit | std::ios::badbit);
+    std::unique_ptr<treelite::Model> received_model = treelite::Model::DeserializeFromStream(iss);
+
+    // Use ASSERT_TRUE, since ASSERT_EQ will dump all the raw bytes into a string, potentially
+    // causing an OOM error
+    ASSERT_TRUE(model->DumpAsJSON(false) == received_model->DumpAsJSON(false));
+  }
+
+  for (int i = 0; i < 2; ++i) {
+    // Test round trip with memory-mapped deserialization
+    std::filesystem::path tmpdir = std::filesystem::temp_directory_path();
+    std::filesystem::path filepath = tmpdir / (std::string("mapped") + std::to_string(i) + ".bin");
+    {
+      std::ofstream ofs = treelite::detail::OpenFileForWriteAsStream(filepath);
+      model->SerializeToStream(ofs);
+    }
+    {
+      std::unique_ptr<treelite::Model> received_model
+          = treelite::Model::DeserializeFromMappedFile(filepath.string());
+
+      // Use ASSERT_TRUE, since ASSERT_EQ will dump all the raw bytes into a string, potentially
+      // causing an OOM error
+      ASSERT_TRUE(model->DumpAsJSON(false) == received_model->DumpAsJSON(false));
+    }
+
+    std::filesystem::remove(filepath);
+  }
 }
 
 }  // anonymous namespace
@@ -609,6 +648,255 @@ TEST(SerializerRoundTrip, DeepFullTree) {
   SerializerRoundTrip_DeepFullTree<double, double>();
 }
 
+TEST(Compression, LZ4BlockRoundTrip) {
+  std::mt19937 rng(0);
+  std::vector<std::size_t> sizes{0, 1, 4, 11, 12, 13, 100, 4096, 100000};
+  for (std::size_t n : sizes) {
+    for (int mode = 0; mode < 3; ++mode) {
+      std::vector<char> data(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (mode == 0) {  // incompressible
+          data[i] = static_cast<char>(rng() & 0xFF);
+        } else if (mode == 1) {  // constant
+          data[i] = 'x';
+        } else {  // short repeating pattern
+          data[i] = static_cast<char>(i % 7);
+        }
+      }
+      std::vector<char> compressed(treelite::detail::compression::MaxCompressedSize(n));
+      std::uint64_t const compressed_size
+          = treelite::detail::compression::CompressLZ4(data.data(), n, compressed.data());
+      ASSERT_LE(compressed_size, compressed.size());
+      std::vector<char> decompressed(n);
+      treelite::detail::compression::DecompressLZ4(
+          compressed.data(), compressed_size, decompressed.data(), n);
+      ASSERT_TRUE(decompressed == data);
+    }
+  }
+}
+
+TEST(Serializer, SkipNodeStats) {
+  auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+      model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+      model_builder::TreeAnnotation{1, {0}, {0}}, model_builder::PostProcessorFunc{"identity"},
+      {0.0});
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  std::unique_ptr<Model> model = builder->CommitModel();
+
+  auto& tree = std::get<ModelPreset<float, float>>(model->variant_).trees[0];
+  tree.SetDataCount(0, 500);
+  tree.SetSumHess(0, 125.0);
+  tree.SetGain(0, 0.75);
+
+  std::ostringstream oss;
+  oss.exceptions(std::ios::failbit | std::ios::badbit);
+  model->SerializeToStream(oss);
+
+  // Without the flag, the statistics come back
+  {
+    std::istringstream iss(oss.str());
+    iss.exceptions(std::ios::failbit | std::ios::badbit);
+    std::unique_ptr<Model> received_model = Model::DeserializeFromStream(iss);
+    auto& received_tree = std::get<ModelPreset<float, float>>(received_model->variant_).trees[0];
+    ASSERT_TRUE(received_tree.HasDataCount(0));
+    ASSERT_EQ(received_tree.DataCount(0), 500);
+  }
+
+  // With the flag, the statistics are dropped but the tree structure is intact
+  {
+    std::istringstream iss(oss.str());
+    iss.exceptions(std::ios::failbit | std::ios::badbit);
+    std::unique_ptr<Model> received_model
+        = Model::DeserializeFromStream(iss, /*skip_node_stats=*/true);
+    auto& received_tree = std::get<ModelPreset<float, float>>(received_model->variant_).trees[0];
+    ASSERT_FALSE(received_tree.HasDataCount(0));
+    ASSERT_FALSE(received_tree.HasSumHess(0));
+    ASSERT_FALSE(received_tree.HasGain(0));
+    ASSERT_EQ(received_tree.num_nodes, 3);
+    ASSERT_EQ(received_tree.Threshold(0), 0.0f);
+    ASSERT_EQ(received_tree.LeafValue(1), 1.0f);
+    ASSERT_EQ(received_tree.LeafValue(2), 2.0f);
+  }
+}
+
+TEST(Model, MemoryFootprint) {
+  auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+      model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+      model_builder::TreeAnnotation{1, {0}, {0}}, model_builder::PostProcessorFunc{"identity"},
+      {0.0});
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  std::unique_ptr<Model> model = builder->CommitModel();
+  auto& tree = std::get<ModelPreset<float, float>>(model->variant_).trees[0];
+  tree.SetDataCount(0, 500);
+  tree.SetSumHess(0, 125.0);
+  tree.SetGain(0, 0.75);
+
+  MemoryFootprint const footprint = model->GetMemoryFootprint();
+  ASSERT_EQ(footprint.thresholds, 3 * sizeof(float));
+  ASSERT_GT(footprint.node_structure, 0);
+  ASSERT_GT(footprint.node_stats, 0);
+  ASSERT_GT(footprint.metadata, 0);
+  ASSERT_EQ(footprint.total,
+      footprint.node_structure + footprint.thresholds + footprint.leaf_outputs
+          + footprint.category_lists + footprint.node_stats + footprint.metadata);
+
+  // Loading with skip_node_stats must zero the node-statistics component only
+  std::ostringstream oss;
+  oss.exceptions(std::ios::failbit | std::ios::badbit);
+  model->SerializeToStream(oss);
+  std::istringstream iss(oss.str());
+  iss.exceptions(std::ios::failbit | std::ios::badbit);
+  std::unique_ptr<Model> slim_model = Model::DeserializeFromStream(iss, /*skip_node_stats=*/true);
+  MemoryFootprint const slim = slim_model->GetMemoryFootprint();
+  ASSERT_EQ(slim.node_stats, 0);
+  ASSERT_EQ(slim.thresholds, footprint.thresholds);
+  ASSERT_EQ(slim.node_structure, footprint.node_structure);
+  ASSERT_EQ(slim.total, footprint.total - footprint.node_stats);
+}
+
+TEST(ModelReader, LazyLoading) {
+  constexpr int num_tree = 5;
+  auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+      model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+      model_builder::TreeAnnotation{num_tree, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+      model_builder::PostProcessorFunc{"identity"}, {0.0});
+
+  for (int i = 0; i < num_tree; ++i) {
+    builder->StartTree();
+    builder->StartNode(0);
+    builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+    builder->EndNode();
+    builder->StartNode(1);
+    builder->LeafScalar(-1.0 * (i + 1));
+    builder->EndNode();
+    builder->StartNode(2);
+    builder->LeafScalar(1.0 * (i + 1));
+    builder->EndNode();
+    builder->EndTree();
+  }
+
+  std::unique_ptr<Model> model = builder->CommitModel();
+
+  std::filesystem::path tmpdir = std::filesystem::temp_directory_path();
+  std::filesystem::path filepath = tmpdir / std::string("lazy.bin");
+  {
+    std::ofstream ofs = treelite::detail::OpenFileForWriteAsStream(filepath);
+    model->SerializeToStream(ofs);
+  }
+  {
+    ModelReader reader{filepath.string()};
+    ASSERT_EQ(reader.NumTree(), num_tree);
+
+    // Materialize only the first two trees
+    std::unique_ptr<Model> partial_model = reader.LoadModel(2);
+    ASSERT_EQ(partial_model->GetNumTree(), 2);
+
+    // The materialized trees must match the corresponding trees of the original model
+    rapidjson::Document full_dump, partial_dump;
+    full_dump.Parse(model->DumpAsJSON(false).c_str());
+    partial_dump.Parse(partial_model->DumpAsJSON(false).c_str());
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_TRUE(full_dump["trees"][i] == partial_dump["trees"][i]);
+    }
+
+    // Extending to the full tree count must reproduce the original model exactly
+    reader.ExtendModel(*partial_model, num_tree);
+    ASSERT_EQ(partial_model->GetNumTree(), num_tree);
+    ASSERT_TRUE(model->DumpAsJSON(false) == partial_model->DumpAsJSON(false));
+
+    // Extending to a smaller tree count is a no-op
+    reader.ExtendModel(*partial_model, 2);
+    ASSERT_EQ(partial_model->GetNumTree(), num_tree);
+  }
+  std::filesystem::remove(filepath);
+}
+
+TEST(Serializer, IncrementalAppend) {
+  auto make_model = [](int num_tree, double leaf_base) {
+    auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
+        model_builder::Metadata{2, TaskType::kRegressor, false, 1, {1}, {1, 1}},
+        model_builder::TreeAnnotation{num_tree, std::vector<std::int32_t>(num_tree, 0),
+            std::vector<std::int32_t>(num_tree, 0)},
+        model_builder::PostProcessorFunc{"identity"}, {0.0});
+    for (int i = 0; i < num_tree; ++i) {
+      builder->StartTree();
+      builder->StartNode(0);
+      builder->NumericalTest(i % 2, 0.5, true, Operator::kLT, 1, 2);
+      builder->EndNode();
+      builder->StartNode(1);
+      builder->LeafScalar(leaf_base + i);
+      builder->EndNode();
+      builder->StartNode(2);
+      builder->LeafScalar(-leaf_base - i);
+      builder->EndNode();
+      builder->EndTree();
+    }
+    return builder->CommitModel();
+  };
+
+  for (auto codec : {Codec::kUncompressed, Codec::kLZ4}) {
+    auto base = make_model(8, 1.0);
+    auto extra = make_model(4, 9.0);
+    std::vector<Model const*> parts{base.get(), extra.get()};
+    auto full = ConcatenateModelObjects(parts);
+
+    std::filesystem::path tmpdir = std::filesystem::temp_directory_path();
+    std::filesystem::path filepath = tmpdir / std::string("append.bin");
+    {
+      std::ofstream ofs = treelite::detail::OpenFileForWriteAsStream(filepath);
+      base->SerializeToStream(ofs, codec, /*reserve_num_tree=*/16);
+    }
+
+    // Appending the 4 new trees must reproduce serializing the full model
+    full->AppendTreesToCheckpoint(filepath.string());
+    {
+      std::ifstream ifs = treelite::detail::OpenFileForReadAsStream(filepath);
+      auto roundtrip = Model::DeserializeFromStream(ifs);
+      ASSERT_EQ(roundtrip->GetNumTree(), 12);
+      ASSERT_TRUE(full->DumpAsJSON(false) == roundtrip->DumpAsJSON(false));
+    }
+    // Appending again with no new trees is a no-op
+    full->AppendTreesToCheckpoint(filepath.string());
+    // Exhausting the reservation exactly still works
+    auto extra2 = make_model(4, 50.0);
+    std::vector<Model const*> parts2{full.get(), extra2.get()};
+    auto full2 = ConcatenateModelObjects(parts2);
+    full2->AppendTreesToCheckpoint(filepath.string());
+    {
+      // The appended checkpoint remains memory-mappable
+      auto mapped = Model::DeserializeFromMappedFile(filepath.string());
+      ASSERT_EQ(mapped->GetNumTree(), 16);
+      ASSERT_TRUE(full2->DumpAsJSON(false) == mapped->DumpAsJSON(false));
+    }
+    // Growing past the reservation must fail
+    auto extra3 = make_model(1, 99.0);
+    std::vector<Model const*> parts3{full2.get(), extra3.get()};
+    auto full3 = ConcatenateModelObjects(parts3);
+    ASSERT_THROW(full3->AppendTreesToCheckpoint(filepath.string()), treelite::Error);
+    std::filesystem::remove(filepath);
+  }
+}
+
 TEST(SerializerForwardCompatibility, TreeStump) {
   constexpr int num_tree = 3;
   auto builder = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32,
@@ -0,0 +1,47 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file test_threading_utils.cc
+ * \author Hyunsu Cho
+ * \brief C++ tests for threading utilities
+ */
+#include <gtest/gtest.h>
+#include <treelite/detail/threading_utils.h>
+#include <treelite/error.h>
+
+#include <cstddef>
+#include <vector>
+
+using treelite::detail::threading_utils::ParallelBackend;
+using treelite::detail::threading_utils::ParallelFor;
+using treelite::detail::threading_utils::ParallelSchedule;
+using treelite::detail::threading_utils::ThreadConfig;
+
+TEST(ThreadingUtils, ParallelForCoversEveryIteration) {
+  ThreadConfig config{0, ParallelBackend::kOpenMP};
+  std::size_t const n = 4096;
+  for (auto sched : {ParallelSchedule::Static(), ParallelSchedule::Static(7),
+           ParallelSchedule::Dynamic(), ParallelSchedule::Dynamic(16), ParallelSchedule::Auto(),
+           ParallelSchedule::Guided(), ParallelSchedule::WorkStealing(8)}) {
+    std::vector<int> hits(n, 0);
+    ParallelFor(std::size_t(0), n, config, sched, [&](std::size_t i, int) { ++hits[i]; });
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(hits[i], 1);
+    }
+  }
+}
+
+TEST(ThreadingUtils, ParallelForPropagatesException) {
+  // The first exception thrown inside any chunk must reach the caller
+  ThreadConfig config{0, ParallelBackend::kOpenMP};
+  for (auto sched : {ParallelSchedule::Static(), ParallelSchedule::Dynamic(),
+           ParallelSchedule::WorkStealing(8)}) {
+    auto throwing_loop = [&] {
+      ParallelFor(std::size_t(0), std::size_t(4096), config, sched, [&](std::size_t i, int) {
+        if (i == 1234) {
+          throw treelite::Error("expected failure");
+        }
+      });
+    };
+    ASSERT_THROW(throwing_loop(), treelite::Error);
+  }
+}
@@ -0,0 +1,67 @@
+/*!
+ * Copyright (c) 2023 by Contributors
+ * \file test_trace.cc
+ * \author Hyunsu Cho
+ * \brief C++ tests for the phase-level tracing facility
+ */
+#include <gtest/gtest.h>
+#include <treelite/enum/operator.h>
+#include <treelite/enum/task_type.h>
+#include <treelite/enum/typeinfo.h>
+#include <treelite/gtil.h>
+#include <treelite/model_builder.h>
+#include <treelite/trace.h>
+#include <treelite/tree.h>
+
+#include <memory>
+#include <vector>
+
+using namespace treelite;  // NOLINT(build/namespaces)
+
+TEST(Trace, PredictPhaseBreakdown) {
+  model_builder::Metadata metadata{2, TaskType::kRegressor, true, 1, {1}, {1, 1}};
+  model_builder::TreeAnnotation tree_annotation{1, {0}, {0}};
+  model_builder::PostProcessorFunc postprocessor{"identity"};
+  std::vector<double> base_scores{0.5};
+  std::unique_ptr<model_builder::ModelBuilder> builder
+      = model_builder::GetModelBuilder(TypeInfo::kFloat32, TypeInfo::kFloat32, metadata,
+          tree_annotation, postprocessor, base_scores);
+  builder->StartTree();
+  builder->StartNode(0);
+  builder->NumericalTest(0, 0.0, true, Operator::kLT, 1, 2);
+  builder->EndNode();
+  builder->StartNode(1);
+  builder->LeafScalar(1.0);
+  builder->EndNode();
+  builder->StartNode(2);
+  builder->LeafScalar(2.0);
+  builder->EndNode();
+  builder->EndTree();
+  auto model = builder->CommitModel();
+
+  std::vector<float> input{-1.0f, 0.0f, 1.0f, 0.0f};
+  std::vector<float> output(2);
+  gtil::Configuration config;
+  config.nthread = 1;
+  config.pred_kind = gtil::PredictKind::kPredictRaw;
+
+  // Nothing is recorded while tracing is off (the default)
+  trace::NewReport();
+  gtil::Predict(*model, input.data(), 2, output.data(), config);
+  EXPECT_TRUE(trace::GetReport().empty());
+
+  trace::EnableTracing(true);
+  gtil::Predict(*model, input.data(), 2, output.data(), config);
+  trace::EnableTracing(false);
+  bool saw_predict = false, saw_traversal = false, saw_average = false;
+  for (auto const& stat : trace::GetReport()) {
+    EXPECT_EQ(stat.num_invocation, 1);
+    EXPECT_GE(stat.total_sec, 0.0);
+    saw_predict = saw_predict || stat.phase == "gtil::predict";
+    saw_traversal = saw_traversal || stat.phase == "gtil::traversal";
+    saw_average = saw_average || stat.phase == "gtil::average_base_scores";
+  }
+  EXPECT_TRUE(saw_predict);
+  EXPECT_TRUE(saw_traversal);
+  EXPECT_TRUE(saw_average);
+}
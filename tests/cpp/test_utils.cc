@@ -6,12 +6,17 @@
  */
 
 #include <gtest/gtest.h>
+#include <treelite/contiguous_array.h>
+#include <treelite/detail/aligned_alloc.h>
 #include <treelite/detail/file_utils.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <numeric>
 #include <string>
+#include <vector>
 
 TEST(FileUtils, StreamIO) {
   std::string s{"Hello world"};
@@ -56,3 +61,37 @@ TEST(FileUtils, OpenFileForReadAsFilePtr) {
 
   std::filesystem::remove(filepath);
 }
+
+TEST(AlignedAlloc, ContiguousArrayAlignment) {
+  auto const is_aligned = [](void const* ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % treelite::detail::kAllocAlignment == 0;
+  };
+  // Owned buffers stay cache-line aligned through every growth path
+  treelite::ContiguousArray<std::int32_t> array;
+  for (int i = 0; i < 1000; ++i) {
+    array.PushBack(i);
+  }
+  ASSERT_TRUE(is_aligned(array.Data()));
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(array[i], i);  // contents survive the aligned reallocations
+  }
+  array.Resize(1 << 16, -1);
+  ASSERT_TRUE(is_aligned(array.Data()));
+  ASSERT_EQ(array[999], 999);
+  ASSERT_EQ(array.Back(), -1);
+
+  std::vector<double> vec(12345);
+  std::iota(vec.begin(), vec.end(), 0.0);
+  treelite::ContiguousArray<double> from_vec{vec};
+  ASSERT_TRUE(is_aligned(from_vec.Data()));
+  auto clone = from_vec.Clone();
+  ASSERT_TRUE(is_aligned(clone.Data()));
+  ASSERT_TRUE(clone == from_vec);
+
+  // An array past the hugepage threshold is aligned to the hugepage size
+  treelite::ContiguousArray<std::uint8_t> big;
+  big.Resize(treelite::detail::kHugePageSize + 1);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(big.Data())
+                % treelite::detail::AllocAlignmentFor(big.Size()),
+      0);
+}